@@ -0,0 +1,54 @@
+#ifndef SIMPLE_CONTAINERS_BENCHMARK_UTILS_HPP
+#define SIMPLE_CONTAINERS_BENCHMARK_UTILS_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace benchmarkUtils {
+    /// @brief Number of times every benchmark is repeated, the fastest repetition is reported
+    constexpr int repetitions = 5;
+
+    /// @brief Make the compiler believe that value is used so the computation producing it is not optimized away
+    /// @details Stores a copy of value into a volatile object, so T should be an arithmetic type
+    template <typename T>
+    inline void do_not_optimize(const T value) {
+        static volatile T sink{};
+        sink = value;
+        // writes to a volatile object are observable, but -Wunused-but-set-variable does not count them as a use
+        static_cast<void>(sink);
+    }
+
+    /// @brief Run func repetitions times and return the fastest run in nanoseconds per operation
+    /// @param operationCount Number of operations performed by a single call to func
+    template <typename Func>
+    inline double measure_ns_per_op(const std::size_t operationCount, Func func) {
+        double best = 0.0;
+
+        for (int i = 0; i < repetitions; ++i) {
+            const auto start = std::chrono::steady_clock::now();
+            func();
+            const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+            const double nsPerOp = static_cast<double>(elapsed) / static_cast<double>(operationCount);
+            best = (i == 0) ? nsPerOp : std::min(best, nsPerOp);
+        }
+
+        return best;
+    }
+
+    inline void print_result(const std::string& name, const double nsPerOp) {
+        std::cout << std::left << std::setw(60) << name << std::right << std::setw(10) << std::fixed << std::setprecision(3) << nsPerOp << " ns/op" << std::endl;
+    }
+
+    /// @brief Print throughput of a benchmark that reads bytesPerOp bytes in every operation
+    inline void print_gb_per_s(const std::string& name, const double nsPerOp, const std::size_t bytesPerOp) {
+        std::cout << std::left << std::setw(60) << name << std::right << std::setw(10) << std::fixed << std::setprecision(3)
+            << static_cast<double>(bytesPerOp) / nsPerOp << " GB/s" << std::endl;
+    }
+} // namespace benchmarkUtils
+
+#endif // SIMPLE_CONTAINERS_BENCHMARK_UTILS_HPP
@@ -0,0 +1,164 @@
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "simpleContainers/simpleRingBuffer.hpp"
+
+#include "benchmarkUtils.hpp"
+
+// buffers with exact capacity wrap indices with a compare and subtract, buffers with power of two capacity use a mask
+using ExactRingBuffer = simpleContainers::RingBuffer<std::uint64_t, std::allocator<std::uint64_t>, simpleContainers::ExactCapacity>;
+using Pow2RingBuffer = simpleContainers::RingBuffer<std::uint64_t, std::allocator<std::uint64_t>, simpleContainers::PowerOfTwoCapacity>;
+// buffers with a rejecting overflow policy drop new elements while full
+using RejectingRingBuffer = simpleContainers::RingBuffer<std::uint64_t, std::allocator<std::uint64_t>, simpleContainers::ExactCapacity, simpleContainers::RejectNew>;
+using CountingRingBuffer = simpleContainers::RingBuffer<std::uint64_t, std::allocator<std::uint64_t>, simpleContainers::ExactCapacity, simpleContainers::CountRejectedNew>;
+
+constexpr std::size_t operationCount = 10000000;
+
+template <typename RingBufferType>
+void benchmark_push_back(const std::string& name, const std::size_t capacity);
+template <typename RingBufferType>
+void benchmark_try_push_back(const std::string& name, const std::size_t capacity);
+template <typename RingBufferType>
+void benchmark_random_access(const std::string& name, const std::size_t capacity, const std::vector<std::size_t>& positions);
+template <typename RingBufferType>
+void benchmark_sequential_access(const std::string& name, const std::size_t capacity);
+void benchmark_bulk_push_back(const std::size_t capacity, const std::size_t batchSize);
+
+int main() {
+    // 1000 is the capacity a user would typically ask for, PowerOfTwoCapacity rounds it up to 1024
+    const std::size_t capacities[] = {1000, 1024, 100000};
+
+    for (const std::size_t capacity : capacities) {
+        std::cout << "================= CAPACITY " << capacity << " =================" << std::endl;
+
+        std::mt19937_64 rng{capacity};
+        std::uniform_int_distribution<std::size_t> dist(0, capacity - 1);
+        std::vector<std::size_t> positions(operationCount);
+        for (auto& pos : positions) { pos = dist(rng); }
+
+        benchmark_push_back<ExactRingBuffer>("push_back (steady state), ExactCapacity", capacity);
+        benchmark_push_back<Pow2RingBuffer>("push_back (steady state), PowerOfTwoCapacity", capacity);
+        benchmark_try_push_back<ExactRingBuffer>("try_push_back (half rejected), OverwriteOldest", capacity);
+        benchmark_try_push_back<RejectingRingBuffer>("try_push_back (half rejected), RejectNew", capacity);
+        benchmark_try_push_back<CountingRingBuffer>("try_push_back (half rejected), CountRejectedNew", capacity);
+        benchmark_random_access<ExactRingBuffer>("operator[] (random positions), ExactCapacity", capacity, positions);
+        benchmark_random_access<Pow2RingBuffer>("operator[] (random positions), PowerOfTwoCapacity", capacity, positions);
+        benchmark_sequential_access<ExactRingBuffer>("operator[] (sequential positions), ExactCapacity", capacity);
+        benchmark_sequential_access<Pow2RingBuffer>("operator[] (sequential positions), PowerOfTwoCapacity", capacity);
+        benchmark_bulk_push_back(capacity, 256);
+        benchmark_bulk_push_back(capacity, 4096);
+    }
+
+    return 0;
+}
+
+template <typename RingBufferType>
+void benchmark_push_back(const std::string& name, const std::size_t capacity) {
+    RingBufferType rb(capacity);
+    // start measuring once the buffer is full, this is the state a ring buffer spends most of its time in
+    for (std::size_t i = 0; i < rb.capacity(); ++i) { rb.push_back(i); }
+
+    const double nsPerOp = benchmarkUtils::measure_ns_per_op(operationCount, [&rb]() {
+        for (std::uint64_t i = 0; i < operationCount; ++i) {
+            rb.push_back(i);
+        }
+        benchmarkUtils::do_not_optimize(rb[0]);
+    });
+
+    benchmarkUtils::print_result(name, nsPerOp);
+}
+
+template <typename RingBufferType>
+void benchmark_try_push_back(const std::string& name, const std::size_t capacity) {
+    RingBufferType rb(capacity);
+    // the buffer is drained every 2 * capacity insertions, so it accepts capacity elements and then rejects as many.
+    // A plain push_back on a full rejecting buffer does nothing the compiler has to keep, so that is not measured
+    const std::size_t period = 2 * rb.capacity();
+
+    const double nsPerOp = benchmarkUtils::measure_ns_per_op(operationCount, [&rb, period]() {
+        std::size_t acceptedCount = 0;
+        for (std::uint64_t i = 0; i < operationCount; ++i) {
+            if (i % period == 0) {
+                rb.clear();
+            }
+            acceptedCount += rb.try_push_back(i) ? 1u : 0u;
+        }
+        benchmarkUtils::do_not_optimize(acceptedCount);
+        rb.clear();
+    });
+
+    benchmarkUtils::print_result(name, nsPerOp);
+}
+
+template <typename RingBufferType>
+void benchmark_random_access(const std::string& name, const std::size_t capacity, const std::vector<std::size_t>& positions) {
+    RingBufferType rb(capacity);
+    // an odd number of laps leaves the oldest element in the middle of the storage so that indices really wrap
+    for (std::size_t i = 0; i < rb.capacity() + rb.capacity() / 2; ++i) { rb.push_back(i); }
+
+    const double nsPerOp = benchmarkUtils::measure_ns_per_op(positions.size(), [&rb, &positions]() {
+        std::uint64_t sum = 0;
+        for (const std::size_t pos : positions) {
+            sum += rb[pos];
+        }
+        benchmarkUtils::do_not_optimize(sum);
+    });
+
+    benchmarkUtils::print_result(name, nsPerOp);
+}
+
+template <typename RingBufferType>
+void benchmark_sequential_access(const std::string& name, const std::size_t capacity) {
+    RingBufferType rb(capacity);
+    for (std::size_t i = 0; i < rb.capacity() + rb.capacity() / 2; ++i) { rb.push_back(i); }
+
+    const std::size_t laps = operationCount / rb.size();
+
+    const double nsPerOp = benchmarkUtils::measure_ns_per_op(laps * rb.size(), [&rb, laps]() {
+        std::uint64_t sum = 0;
+        for (std::size_t lap = 0; lap < laps; ++lap) {
+            for (std::size_t pos = 0; pos < rb.size(); ++pos) {
+                sum += rb[pos];
+            }
+        }
+        benchmarkUtils::do_not_optimize(sum);
+    });
+
+    benchmarkUtils::print_result(name, nsPerOp);
+}
+
+void benchmark_bulk_push_back(const std::size_t capacity, const std::size_t batchSize) {
+    std::vector<std::uint64_t> batch(batchSize);
+    for (std::size_t i = 0; i < batchSize; ++i) { batch[i] = i; }
+    const std::size_t batchCount = operationCount / batchSize;
+
+    ExactRingBuffer rbSingle(capacity);
+    for (std::size_t i = 0; i < rbSingle.capacity(); ++i) { rbSingle.push_back(i); }
+
+    const double nsPerOpSingle = benchmarkUtils::measure_ns_per_op(batchCount * batchSize, [&rbSingle, &batch, batchCount]() {
+        for (std::size_t b = 0; b < batchCount; ++b) {
+            for (const std::uint64_t elem : batch) {
+                rbSingle.push_back(elem);
+            }
+        }
+        benchmarkUtils::do_not_optimize(rbSingle[0]);
+    });
+
+    ExactRingBuffer rbBulk(capacity);
+    for (std::size_t i = 0; i < rbBulk.capacity(); ++i) { rbBulk.push_back(i); }
+
+    const double nsPerOpBulk = benchmarkUtils::measure_ns_per_op(batchCount * batchSize, [&rbBulk, &batch, batchCount]() {
+        for (std::size_t b = 0; b < batchCount; ++b) {
+            rbBulk.append(batch.data(), batch.size());
+        }
+        benchmarkUtils::do_not_optimize(rbBulk[0]);
+    });
+
+    benchmarkUtils::print_result("push_back per element, batches of " + std::to_string(batchSize), nsPerOpSingle);
+    benchmarkUtils::print_result("append, batches of " + std::to_string(batchSize), nsPerOpBulk);
+}
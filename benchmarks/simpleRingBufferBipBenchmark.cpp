@@ -0,0 +1,90 @@
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "simpleContainers/simpleRingBuffer.hpp"
+#include "simpleContainers/simpleBipRingBuffer.hpp"
+
+#include "benchmarkUtils.hpp"
+
+constexpr std::size_t messageCount = 4 * 1024 * 1024;
+// about 1 MiB of log lines in flight, in both containers
+constexpr std::size_t linesInFlight = 8 * 1024;
+
+// log lines of 32 to 200 characters, long enough that std::string allocates for each of them
+std::vector<std::string> make_log_lines();
+
+void benchmark_string_ring_buffer(const std::vector<std::string>& lines);
+void benchmark_bip_ring_buffer(const std::vector<std::string>& lines);
+
+int main() {
+    const std::vector<std::string> lines = make_log_lines();
+
+    std::cout << "================= LOG LINES, " << linesInFlight << " IN FLIGHT =================" << std::endl;
+    benchmark_string_ring_buffer(lines);
+    benchmark_bip_ring_buffer(lines);
+
+    return 0;
+}
+
+std::vector<std::string> make_log_lines() {
+    std::mt19937_64 rng(7);
+    std::uniform_int_distribution<std::size_t> lengthDist(32, 200);
+    std::uniform_int_distribution<int> charDist('a', 'z');
+
+    std::vector<std::string> result(1024);
+    for (std::string& line : result) {
+        line.resize(lengthDist(rng));
+        for (char& c : line) {
+            c = static_cast<char>(charDist(rng));
+        }
+    }
+    return result;
+}
+
+void benchmark_string_ring_buffer(const std::vector<std::string>& lines) {
+    simpleContainers::RingBuffer<std::string> rb(linesInFlight);
+
+    // the producer formats a line into the buffer, the consumer reads the oldest line once the buffer is full
+    const double nsPerOp = benchmarkUtils::measure_ns_per_op(messageCount, [&]() {
+        std::size_t checksum = 0;
+        for (std::size_t i = 0; i < messageCount; ++i) {
+            if (rb.full()) {
+                checksum += static_cast<unsigned char>(rb.front()[0]) + rb.front().size();
+                rb.pop_front();
+            }
+            const std::string& line = lines[i % lines.size()];
+            rb.push_back(std::string(line.data(), line.size()));
+        }
+        benchmarkUtils::do_not_optimize(checksum);
+        rb.clear();
+    });
+    benchmarkUtils::print_result("produce + consume, RingBuffer<std::string>", nsPerOp);
+}
+
+void benchmark_bip_ring_buffer(const std::vector<std::string>& lines) {
+    // same number of lines in flight: average payload of 116 bytes plus length prefix
+    simpleContainers::BipRingBuffer rb(linesInFlight * 120);
+
+    const double nsPerOp = benchmarkUtils::measure_ns_per_op(messageCount, [&]() {
+        std::size_t checksum = 0;
+        for (std::size_t i = 0; i < messageCount; ++i) {
+            const std::string& line = lines[i % lines.size()];
+            simpleContainers::Segment<unsigned char> space = rb.reserve(line.size());
+            while (space.data() == nullptr) {
+                const simpleContainers::Segment<const unsigned char> oldest = rb.peek();
+                checksum += oldest[0] + oldest.size();
+                rb.release();
+                space = rb.reserve(line.size());
+            }
+            std::memcpy(space.data(), line.data(), line.size());
+            rb.commit(line.size());
+        }
+        benchmarkUtils::do_not_optimize(checksum);
+        rb.clear();
+    });
+    benchmarkUtils::print_result("produce + consume, BipRingBuffer", nsPerOp);
+}
@@ -0,0 +1,111 @@
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "simpleContainers/simpleRingBuffer.hpp"
+#include "simpleContainers/simpleCompressedRingBuffer.hpp"
+
+#include "benchmarkUtils.hpp"
+
+constexpr std::size_t windowSize = 1024 * 1024;
+constexpr std::size_t samplesPerSize = 4 * windowSize;
+
+// timestamps of a 15s scrape with a little jitter, and a gauge that moves in small steps, like typical monitoring data
+std::vector<std::int64_t> make_timestamps();
+std::vector<double> make_gauge();
+
+template <typename T>
+void benchmark_plain(const std::string& name, const std::vector<T>& samples);
+template <typename T>
+void benchmark_compressed(const std::string& name, const std::vector<T>& samples);
+
+int main() {
+    const std::vector<std::int64_t> timestamps = make_timestamps();
+    const std::vector<double> gauge = make_gauge();
+
+    std::cout << "================= TIMESTAMPS, WINDOW SIZE " << windowSize << " =================" << std::endl;
+    benchmark_plain("RingBuffer<std::int64_t>", timestamps);
+    benchmark_compressed("CompressedRingBuffer<std::int64_t>", timestamps);
+
+    std::cout << "================= GAUGE, WINDOW SIZE " << windowSize << " =================" << std::endl;
+    benchmark_plain("RingBuffer<double>", gauge);
+    benchmark_compressed("CompressedRingBuffer<double>", gauge);
+
+    return 0;
+}
+
+std::vector<std::int64_t> make_timestamps() {
+    std::mt19937_64 rng(15);
+    std::uniform_int_distribution<int> jitterDist(0, 99);
+
+    std::vector<std::int64_t> result(samplesPerSize);
+    std::int64_t timestamp = 1700000000000;
+    for (std::int64_t& sample : result) {
+        // most scrapes are exactly on time
+        const int jitter = jitterDist(rng);
+        timestamp += 15000 + (jitter < 90 ? 0 : jitter - 95);
+        sample = timestamp;
+    }
+    return result;
+}
+
+std::vector<double> make_gauge() {
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<int> stepDist(-2, 2);
+
+    std::vector<double> result(samplesPerSize);
+    int level = 5000;
+    for (double& sample : result) {
+        level += stepDist(rng);
+        sample = static_cast<double>(level) / 4.0;
+    }
+    return result;
+}
+
+template <typename T>
+void benchmark_plain(const std::string& name, const std::vector<T>& samples) {
+    simpleContainers::RingBuffer<T> rb(windowSize);
+
+    double nsPerOp = benchmarkUtils::measure_ns_per_op(samples.size(), [&]() {
+        for (const T sample : samples) {
+            rb.push_back(sample);
+        }
+        benchmarkUtils::do_not_optimize(rb.size());
+    });
+    benchmarkUtils::print_result("push_back, " + name, nsPerOp);
+
+    nsPerOp = benchmarkUtils::measure_ns_per_op(rb.size(), [&]() {
+        T result = 0;
+        for (const T sample : rb) { result += sample; }
+        benchmarkUtils::do_not_optimize(result);
+    });
+    benchmarkUtils::print_result("decode (sum), " + name, nsPerOp);
+    benchmarkUtils::print_gb_per_s("    decoded samples", nsPerOp, sizeof(T));
+    std::cout << "    bytes per sample: " << sizeof(T) << std::endl;
+}
+
+template <typename T>
+void benchmark_compressed(const std::string& name, const std::vector<T>& samples) {
+    simpleContainers::CompressedRingBuffer<T> rb(windowSize);
+
+    double nsPerOp = benchmarkUtils::measure_ns_per_op(samples.size(), [&]() {
+        for (const T sample : samples) {
+            rb.push_back(sample);
+        }
+        benchmarkUtils::do_not_optimize(rb.size());
+    });
+    benchmarkUtils::print_result("push_back, " + name, nsPerOp);
+
+    nsPerOp = benchmarkUtils::measure_ns_per_op(rb.size(), [&]() {
+        T result = 0;
+        for (const T sample : rb) { result += sample; }
+        benchmarkUtils::do_not_optimize(result);
+    });
+    benchmarkUtils::print_result("decode (sum), " + name, nsPerOp);
+    benchmarkUtils::print_gb_per_s("    decoded samples", nsPerOp, sizeof(T));
+    std::cout << "    bytes per sample: " << static_cast<double>(rb.encoded_bytes()) / static_cast<double>(rb.size()) << std::endl;
+}
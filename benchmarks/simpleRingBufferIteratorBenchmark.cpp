@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "simpleContainers/simpleRingBuffer.hpp"
+
+#include "benchmarkUtils.hpp"
+
+using RingBufferType = simpleContainers::RingBuffer<std::uint64_t>;
+
+/// @brief Iterator that stores a position and a pointer to the owning RingBuffer and dereferences through operator[]
+/// @details This is how RingBuffer iterators used to be implemented, it is kept here as a baseline for comparison
+class PositionIterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::uint64_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::uint64_t*;
+        using reference = const std::uint64_t&;
+
+        PositionIterator(const std::size_t pos, const RingBufferType* rb) : mPosition{pos}, mRingBufPtr{rb} {}
+
+        reference operator*() const { return (*mRingBufPtr)[mPosition]; }
+        reference operator[](const difference_type n) const { return (*mRingBufPtr)[mPosition + static_cast<std::size_t>(n)]; }
+
+        PositionIterator& operator++() { ++mPosition; return *this; }
+        PositionIterator operator++(int) { PositionIterator tmp = *this; ++mPosition; return tmp; }
+        PositionIterator& operator--() { --mPosition; return *this; }
+        PositionIterator operator--(int) { PositionIterator tmp = *this; --mPosition; return tmp; }
+        PositionIterator& operator+=(const difference_type n) { mPosition += static_cast<std::size_t>(n); return *this; }
+        PositionIterator& operator-=(const difference_type n) { mPosition -= static_cast<std::size_t>(n); return *this; }
+        PositionIterator operator+(const difference_type n) const { PositionIterator tmp = *this; return tmp += n; }
+        PositionIterator operator-(const difference_type n) const { PositionIterator tmp = *this; return tmp -= n; }
+        difference_type operator-(const PositionIterator& other) const { return static_cast<difference_type>(mPosition - other.mPosition); }
+
+        bool operator==(const PositionIterator& other) const { return mPosition == other.mPosition; }
+        bool operator!=(const PositionIterator& other) const { return mPosition != other.mPosition; }
+        bool operator<(const PositionIterator& other) const { return mPosition < other.mPosition; }
+
+    private:
+        std::size_t mPosition;
+        const RingBufferType* mRingBufPtr;
+};
+
+constexpr std::size_t elementsPerRun = 50000000;
+
+template <typename Iterator>
+void benchmark_algorithms(const std::string& suffix, const std::size_t size, Iterator first1, Iterator last1, Iterator first2, Iterator last2);
+
+int main() {
+    const std::size_t capacities[] = {1000, 100000};
+
+    for (const std::size_t capacity : capacities) {
+        std::cout << "================= CAPACITY " << capacity << " =================" << std::endl;
+
+        // the oldest element is in the middle of the storage, so every traversal crosses the end of the storage once
+        RingBufferType rb1(capacity);
+        RingBufferType rb2(capacity);
+        for (std::uint64_t i = 0; i < capacity + capacity / 2; ++i) {
+            rb1.push_back(i);
+            rb2.push_back(i);
+        }
+        const std::vector<std::uint64_t> vec1(rb1.begin(), rb1.end());
+        const std::vector<std::uint64_t> vec2(rb2.begin(), rb2.end());
+
+        const RingBufferType& rb1ConstRef = rb1;
+        const RingBufferType& rb2ConstRef = rb2;
+
+        benchmark_algorithms("std::vector (baseline)", capacity, vec1.begin(), vec1.end(), vec2.begin(), vec2.end());
+        benchmark_algorithms("position iterator", capacity, PositionIterator{0, &rb1}, PositionIterator{rb1.size(), &rb1},
+            PositionIterator{0, &rb2}, PositionIterator{rb2.size(), &rb2});
+        benchmark_algorithms("RingBuffer::const_iterator", capacity, rb1ConstRef.begin(), rb1ConstRef.end(), rb2ConstRef.begin(), rb2ConstRef.end());
+    }
+
+    return 0;
+}
+
+template <typename Iterator>
+void benchmark_algorithms(const std::string& suffix, const std::size_t size, Iterator first1, Iterator last1, Iterator first2, Iterator last2) {
+    const std::size_t runs = elementsPerRun / size;
+    double nsPerOp = 0.0;
+
+    nsPerOp = benchmarkUtils::measure_ns_per_op(runs * size, [&]() {
+        std::uint64_t sum = 0;
+        for (std::size_t run = 0; run < runs; ++run) {
+            for (Iterator it = first1; it != last1; ++it) {
+                sum += *it;
+            }
+        }
+        benchmarkUtils::do_not_optimize(sum);
+    });
+    benchmarkUtils::print_result("loop sum, " + suffix, nsPerOp);
+
+    nsPerOp = benchmarkUtils::measure_ns_per_op(runs * size, [&]() {
+        std::uint64_t sum = 0;
+        for (std::size_t run = 0; run < runs; ++run) {
+            sum += std::accumulate(first1, last1, std::uint64_t{run});
+        }
+        benchmarkUtils::do_not_optimize(sum);
+    });
+    benchmarkUtils::print_result("std::accumulate, " + suffix, nsPerOp);
+
+    nsPerOp = benchmarkUtils::measure_ns_per_op(runs * size, [&]() {
+        std::ptrdiff_t count = 0;
+        for (std::size_t run = 0; run < runs; ++run) {
+            count += std::count(first1, last1, static_cast<std::uint64_t>(run));
+        }
+        benchmarkUtils::do_not_optimize(count);
+    });
+    benchmarkUtils::print_result("std::count, " + suffix, nsPerOp);
+
+    nsPerOp = benchmarkUtils::measure_ns_per_op(runs * size, [&]() {
+        std::ptrdiff_t found = 0;
+        for (std::size_t run = 0; run < runs; ++run) {
+            // the searched value is not in the range, so every element is visited
+            found += std::distance(first1, std::find(first1, last1, static_cast<std::uint64_t>(size * 2 + run)));
+        }
+        benchmarkUtils::do_not_optimize(found);
+    });
+    benchmarkUtils::print_result("std::find, " + suffix, nsPerOp);
+
+    using difference_type = typename std::iterator_traits<Iterator>::difference_type;
+
+    nsPerOp = benchmarkUtils::measure_ns_per_op(runs * size, [&]() {
+        std::size_t equalCount = 0;
+        for (std::size_t run = 0; run < runs; ++run) {
+            // both ranges hold the same values, so the first range is shortened by a few elements that depend on run,
+            // otherwise the whole comparison does not depend on the loop and is hoisted out of it
+            const Iterator runLast1 = std::prev(last1, static_cast<difference_type>(run % 4));
+            equalCount += static_cast<std::size_t>(std::equal(first1, runLast1, first2) ? 1 : 0);
+        }
+        benchmarkUtils::do_not_optimize(equalCount);
+    });
+    benchmarkUtils::print_result("std::equal, " + suffix, nsPerOp);
+
+    nsPerOp = benchmarkUtils::measure_ns_per_op(runs * size, [&]() {
+        std::size_t lessCount = 0;
+        for (std::size_t run = 0; run < runs; ++run) {
+            const Iterator runLast1 = std::prev(last1, static_cast<difference_type>(run % 4));
+            lessCount += static_cast<std::size_t>(std::lexicographical_compare(first1, runLast1, first2, last2) ? 1 : 0);
+        }
+        benchmarkUtils::do_not_optimize(lessCount);
+    });
+    benchmarkUtils::print_result("std::lexicographical_compare, " + suffix, nsPerOp);
+}
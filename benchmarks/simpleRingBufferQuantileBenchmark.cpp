@@ -0,0 +1,112 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "simpleContainers/simpleRingBuffer.hpp"
+#include "simpleContainers/simpleQuantileRingBuffer.hpp"
+
+#include "benchmarkUtils.hpp"
+
+constexpr std::size_t windowSize = 100000;
+constexpr std::size_t queryCount = 1000;
+constexpr std::size_t insertCount = 10000000;
+
+const double reportedQuantiles[] = {0.5, 0.99, 0.999};
+
+std::vector<std::uint32_t> make_latencies(const std::size_t count);
+std::uint32_t exact_quantile(std::vector<std::uint32_t>& scratch, const double q);
+
+void benchmark_nth_element(const std::vector<std::uint32_t>& latencies);
+template <unsigned PrecisionBits>
+void benchmark_quantile_ring_buffer(const std::vector<std::uint32_t>& latencies);
+
+int main() {
+    // latency-like distribution: median around 400us with a long tail
+    const std::vector<std::uint32_t> latencies = make_latencies(insertCount);
+
+    std::cout << "================= WINDOW SIZE " << windowSize << " =================" << std::endl;
+    benchmark_nth_element(latencies);
+    benchmark_quantile_ring_buffer<3>(latencies);
+    benchmark_quantile_ring_buffer<5>(latencies);
+    benchmark_quantile_ring_buffer<7>(latencies);
+    benchmark_quantile_ring_buffer<10>(latencies);
+
+    return 0;
+}
+
+std::vector<std::uint32_t> make_latencies(const std::size_t count) {
+    std::mt19937_64 rng(1);
+    std::lognormal_distribution<double> dist(6.0, 1.2);
+
+    std::vector<std::uint32_t> result(count);
+    for (std::uint32_t& latency : result) {
+        latency = static_cast<std::uint32_t>(std::min(dist(rng), 4e9));
+    }
+    return result;
+}
+
+std::uint32_t exact_quantile(std::vector<std::uint32_t>& scratch, const double q) {
+    const double exactRank = std::ceil(q * static_cast<double>(scratch.size()));
+    const std::size_t rank = std::min(scratch.size(), std::max(std::size_t{1}, static_cast<std::size_t>(exactRank)));
+    std::nth_element(scratch.begin(), scratch.begin() + static_cast<std::ptrdiff_t>(rank - 1), scratch.end());
+    return scratch[rank - 1];
+}
+
+void benchmark_nth_element(const std::vector<std::uint32_t>& latencies) {
+    simpleContainers::RingBuffer<std::uint32_t> rb(windowSize);
+    for (std::size_t i = 0; i < windowSize; ++i) {
+        rb.push_back(latencies[i]);
+    }
+
+    // what we want to replace: copy the window out and partially sort it on every scrape
+    const double nsPerOp = benchmarkUtils::measure_ns_per_op(queryCount, [&]() {
+        std::uint64_t result = 0;
+        for (std::size_t i = 0; i < queryCount; ++i) {
+            std::vector<std::uint32_t> scratch = rb.get_elements();
+            result += exact_quantile(scratch, 0.99);
+        }
+        benchmarkUtils::do_not_optimize(result);
+    });
+    benchmarkUtils::print_result("p99 query, get_elements + nth_element", nsPerOp);
+}
+
+template <unsigned PrecisionBits>
+void benchmark_quantile_ring_buffer(const std::vector<std::uint32_t>& latencies) {
+    using QuantileBuffer = simpleContainers::QuantileRingBuffer<std::uint32_t, PrecisionBits>;
+    const std::string suffix = ", QuantileRingBuffer<uint32_t, " + std::to_string(PrecisionBits) + ">";
+
+    QuantileBuffer rb(windowSize);
+    double nsPerOp = benchmarkUtils::measure_ns_per_op(insertCount, [&]() {
+        for (const std::uint32_t latency : latencies) {
+            rb.push_back(latency);
+        }
+        benchmarkUtils::do_not_optimize(rb.size());
+    });
+    benchmarkUtils::print_result("push_back" + suffix, nsPerOp);
+
+    nsPerOp = benchmarkUtils::measure_ns_per_op(queryCount, [&]() {
+        std::uint64_t result = 0;
+        for (std::size_t i = 0; i < queryCount; ++i) {
+            result += rb.quantile(0.99);
+        }
+        benchmarkUtils::do_not_optimize(result);
+    });
+    benchmarkUtils::print_result("p99 query" + suffix, nsPerOp);
+
+    // accuracy against the exact quantiles of the same window
+    std::vector<std::uint32_t> scratch = rb.elements().get_elements();
+    std::cout << "    histogram " << QuantileBuffer::histogram_bytes() << " bytes, max relative error " << std::fixed << std::setprecision(4)
+        << QuantileBuffer::max_relative_error() * 100.0 << "%, observed:";
+    for (const double q : reportedQuantiles) {
+        const double exact = static_cast<double>(exact_quantile(scratch, q));
+        const double reported = static_cast<double>(rb.quantile(q));
+        std::cout << " p" << std::defaultfloat << q * 100.0 << " " << std::fixed << std::fabs(reported - exact) / exact * 100.0 << "%";
+    }
+    std::cout << std::endl;
+}
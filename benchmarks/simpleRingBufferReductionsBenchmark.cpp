@@ -0,0 +1,103 @@
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+#include "simpleContainers/simpleRingBuffer.hpp"
+#include "simpleContainers/simpleRingBufferReductions.hpp"
+
+#include "benchmarkUtils.hpp"
+
+constexpr std::size_t elementsPerRun = 100000000;
+
+const char* simd_level_name(const simpleContainers::SimdLevel level);
+
+template <typename T>
+void benchmark_reductions(const std::string& typeName, const std::size_t windowSize);
+
+int main() {
+    std::cout << "detected SIMD level: " << simd_level_name(simpleContainers::detected_simd_level()) << std::endl;
+
+    // from fitting in L1 cache to exceeding L2 cache
+    const std::size_t windowSizes[] = {256, 4096, 65536, 1048576};
+
+    for (const std::size_t windowSize : windowSizes) {
+        std::cout << "================= WINDOW SIZE " << windowSize << " =================" << std::endl;
+        benchmark_reductions<double>("double", windowSize);
+        benchmark_reductions<std::int64_t>("int64_t", windowSize);
+    }
+
+    return 0;
+}
+
+const char* simd_level_name(const simpleContainers::SimdLevel level) {
+    switch (level) {
+        case simpleContainers::SimdLevel::Avx2:
+            return "AVX2";
+        case simpleContainers::SimdLevel::Sse2:
+            return "SSE2";
+        case simpleContainers::SimdLevel::Scalar:
+        default:
+            return "scalar";
+    }
+}
+
+template <typename T>
+void benchmark_reductions(const std::string& typeName, const std::size_t windowSize) {
+    // the oldest element is in the middle of the storage, so every reduction walks two segments
+    simpleContainers::RingBuffer<T> rb1(windowSize);
+    simpleContainers::RingBuffer<T> rb2(windowSize);
+    for (std::size_t i = 0; i < windowSize + windowSize / 2; ++i) {
+        rb1.push_back(static_cast<T>(i % 1000));
+        rb2.push_back(static_cast<T>(i % 7));
+    }
+
+    const std::size_t runs = elementsPerRun / windowSize;
+    const simpleContainers::SimdLevel levels[] = {simpleContainers::SimdLevel::Scalar, simpleContainers::SimdLevel::Sse2, simpleContainers::SimdLevel::Avx2};
+
+    for (const simpleContainers::SimdLevel level : levels) {
+        if (level > simpleContainers::detected_simd_level()) {
+            continue;
+        }
+
+        const std::string suffix = typeName + ", " + simd_level_name(level);
+        double nsPerOp = 0.0;
+
+        nsPerOp = benchmarkUtils::measure_ns_per_op(runs, [&]() {
+            T result = T{};
+            for (std::size_t run = 0; run < runs; ++run) {
+                result = static_cast<T>(result + simpleContainers::window_sum(rb1, level));
+            }
+            benchmarkUtils::do_not_optimize(result);
+        });
+        benchmarkUtils::print_gb_per_s("window_sum, " + suffix, nsPerOp, windowSize * sizeof(T));
+
+        nsPerOp = benchmarkUtils::measure_ns_per_op(runs, [&]() {
+            T result = T{};
+            for (std::size_t run = 0; run < runs; ++run) {
+                result = static_cast<T>(result + simpleContainers::window_min(rb1, level));
+            }
+            benchmarkUtils::do_not_optimize(result);
+        });
+        benchmarkUtils::print_gb_per_s("window_min, " + suffix, nsPerOp, windowSize * sizeof(T));
+
+        nsPerOp = benchmarkUtils::measure_ns_per_op(runs, [&]() {
+            T result = T{};
+            for (std::size_t run = 0; run < runs; ++run) {
+                result = static_cast<T>(result + simpleContainers::window_max(rb1, level));
+            }
+            benchmarkUtils::do_not_optimize(result);
+        });
+        benchmarkUtils::print_gb_per_s("window_max, " + suffix, nsPerOp, windowSize * sizeof(T));
+
+        nsPerOp = benchmarkUtils::measure_ns_per_op(runs, [&]() {
+            T result = T{};
+            for (std::size_t run = 0; run < runs; ++run) {
+                result = static_cast<T>(result + simpleContainers::window_dot(rb1, rb2, level));
+            }
+            benchmarkUtils::do_not_optimize(result);
+        });
+        // dot product reads both windows
+        benchmarkUtils::print_gb_per_s("window_dot, " + suffix, nsPerOp, 2 * windowSize * sizeof(T));
+    }
+}
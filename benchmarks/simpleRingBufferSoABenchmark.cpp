@@ -0,0 +1,110 @@
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <tuple>
+
+#include "simpleContainers/simpleRingBuffer.hpp"
+#include "simpleContainers/simpleRingBufferSoA.hpp"
+
+#include "benchmarkUtils.hpp"
+
+// window sizes chosen so both layouts fit in L2, and so neither fits in the last level cache
+const std::size_t windowSizes[] = {4096, 4 * 1024 * 1024};
+constexpr std::size_t recordsPerSize = 16 * 1024 * 1024;
+
+struct Record {
+    std::uint64_t timestamp;
+    double price;
+    double qty;
+    double bid;
+    double ask;
+    std::uint32_t venue;
+    std::uint32_t flags;
+};
+
+using RecordSoA = simpleContainers::RingBufferSoA<std::uint64_t, double, double, double, double, std::uint32_t, std::uint32_t>;
+
+Record make_record(const std::size_t i);
+
+void benchmark_array_of_structures(const std::size_t windowSize);
+void benchmark_structure_of_arrays(const std::size_t windowSize);
+
+int main() {
+    std::cout << "sizeof(Record) = " << sizeof(Record) << ", price column element = " << sizeof(double) << " bytes" << std::endl;
+
+    for (const std::size_t windowSize : windowSizes) {
+        std::cout << "================= WINDOW SIZE " << windowSize << " =================" << std::endl;
+        benchmark_array_of_structures(windowSize);
+        benchmark_structure_of_arrays(windowSize);
+    }
+
+    return 0;
+}
+
+Record make_record(const std::size_t i) {
+    const double mid = 100.0 + static_cast<double>(i % 1000) * 0.01;
+    return Record{i, mid, static_cast<double>(i % 50), mid - 0.01, mid + 0.01, static_cast<std::uint32_t>(i % 7), static_cast<std::uint32_t>(i)};
+}
+
+void benchmark_array_of_structures(const std::size_t windowSize) {
+    simpleContainers::RingBuffer<Record> rb(windowSize);
+
+    double nsPerOp = benchmarkUtils::measure_ns_per_op(recordsPerSize, [&]() {
+        for (std::size_t i = 0; i < recordsPerSize; ++i) {
+            rb.push_back(make_record(i));
+        }
+        benchmarkUtils::do_not_optimize(rb.size());
+    });
+    benchmarkUtils::print_result("push_back, RingBuffer<Record>", nsPerOp);
+
+    // summing one field still pulls whole records through cache
+    const std::size_t scans = recordsPerSize / windowSize;
+    nsPerOp = benchmarkUtils::measure_ns_per_op(scans * windowSize, [&]() {
+        double result = 0.0;
+        for (std::size_t i = 0; i < scans; ++i) {
+            simpleContainers::for_each_segment(rb, [&result](simpleContainers::Segment<const Record> segment) {
+                for (const Record& record : segment) { result += record.price; }
+            });
+        }
+        benchmarkUtils::do_not_optimize(result);
+    });
+    benchmarkUtils::print_result("sum of prices, RingBuffer<Record>", nsPerOp);
+    benchmarkUtils::print_gb_per_s("    bytes moved per record: " + std::to_string(sizeof(Record)), nsPerOp, sizeof(Record));
+}
+
+void benchmark_structure_of_arrays(const std::size_t windowSize) {
+    RecordSoA rb(windowSize);
+
+    double nsPerOp = benchmarkUtils::measure_ns_per_op(recordsPerSize, [&]() {
+        for (std::size_t i = 0; i < recordsPerSize; ++i) {
+            const Record record = make_record(i);
+            rb.push_back(record.timestamp, record.price, record.qty, record.bid, record.ask, record.venue, record.flags);
+        }
+        benchmarkUtils::do_not_optimize(rb.size());
+    });
+    benchmarkUtils::print_result("push_back, RingBufferSoA", nsPerOp);
+
+    const std::size_t scans = recordsPerSize / windowSize;
+    nsPerOp = benchmarkUtils::measure_ns_per_op(scans * windowSize, [&]() {
+        double result = 0.0;
+        for (std::size_t i = 0; i < scans; ++i) {
+            const auto prices = static_cast<const RecordSoA&>(rb).column<1>();
+            for (const double price : prices.first) { result += price; }
+            for (const double price : prices.second) { result += price; }
+        }
+        benchmarkUtils::do_not_optimize(result);
+    });
+    benchmarkUtils::print_result("sum of prices, RingBufferSoA::column<1>", nsPerOp);
+    benchmarkUtils::print_gb_per_s("    bytes moved per record: " + std::to_string(sizeof(double)), nsPerOp, sizeof(double));
+
+    // range-for over proxy references reads only the fields that are used
+    nsPerOp = benchmarkUtils::measure_ns_per_op(scans * windowSize, [&]() {
+        double result = 0.0;
+        for (std::size_t i = 0; i < scans; ++i) {
+            for (const auto& record : rb) { result += std::get<1>(record); }
+        }
+        benchmarkUtils::do_not_optimize(result);
+    });
+    benchmarkUtils::print_result("sum of prices, RingBufferSoA range-for", nsPerOp);
+}
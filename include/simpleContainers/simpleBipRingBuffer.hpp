@@ -0,0 +1,305 @@
+/// @file simpleBipRingBuffer.hpp
+/// @brief File containing API and implementaiton of BipRingBuffer class
+
+#ifndef SIMPLE_BIP_RING_BUFFER_HPP
+#define SIMPLE_BIP_RING_BUFFER_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "simpleRingBuffer.hpp"
+
+// ============================================================================================================================================
+// =================================================================== API ====================================================================
+// ============================================================================================================================================
+
+namespace simpleContainers {
+    /// @brief Ring buffer of variable-length byte records, stored contiguously in a single allocation (bip-buffer)
+    /// @details Every record is a length prefix followed by its payload, padded to recordAlignment bytes. Records are
+    ///          written in place: reserve(n) returns contiguous space for a payload of up to n bytes, and commit(m) publishes
+    ///          the first m bytes of it as a new record. The oldest record is read in place with peek() and removed with
+    ///          release(). No record ever straddles the end of the storage, so every payload is one contiguous view and no
+    ///          bytes are copied or allocated per record.
+    ///          Internally, records live in up to two regions, as described by Simon Cooke: region A holds the oldest
+    ///          records, and once there is no room after it, new records go to region B at the start of the storage, which
+    ///          grows until it reaches the start of region A. When region A is fully released, region B becomes region A.
+    ///          Bytes left over at the end of the storage when writing wraps are unused until then.
+    ///          Unlike RingBuffer, records are never overwritten: reserve() fails when there is no contiguous room.
+    ///          This class is not thread safe, use SpscRingBuffer to pass records between threads
+    class BipRingBuffer {
+        public:
+            using value_type = unsigned char;
+            using size_type = std::size_t;
+            using difference_type = std::ptrdiff_t;
+            /// @brief Type of the length prefix stored in front of every payload
+            using header_type = std::uint32_t;
+
+            /// @brief Every record, and so every payload, starts at a multiple of recordAlignment bytes
+            static constexpr size_type recordAlignment = alignof(header_type);
+            /// @brief Arbitrary default of 64 KiB
+            static constexpr size_type defaultInitialCapacity = 64 * 1024;
+
+            /// @brief Construct an empty buffer of initialCapacity bytes, rounded up to a multiple of recordAlignment.
+            ///        Length prefixes and padding are stored in the same bytes as payloads
+            BipRingBuffer(const size_type initialCapacity = defaultInitialCapacity);
+
+            BipRingBuffer(const BipRingBuffer& other) = default;
+            /// @brief Moved-from buffer is left empty with a capacity of 0
+            BipRingBuffer(BipRingBuffer&& other) noexcept;
+            BipRingBuffer& operator=(const BipRingBuffer& other) = default;
+            BipRingBuffer& operator=(BipRingBuffer&& other) noexcept;
+            ~BipRingBuffer() = default;
+
+            /// @brief Number of records
+            size_type size() const noexcept;
+            bool empty() const noexcept;
+            /// @brief Number of bytes of storage, including length prefixes and padding
+            size_type capacity() const noexcept;
+            /// @brief Number of bytes taken by committed records, including their length prefixes and padding
+            size_type used_bytes() const noexcept;
+            /// @brief Size of the largest payload that reserve() would accept right now, if no reservation is active
+            size_type max_reservable() const noexcept;
+            /// @brief Remove all records and cancel the reservation, if any
+            void clear() noexcept;
+
+            /// @brief Reserve contiguous space for a payload of up to n bytes
+            /// @details Only one reservation can be active at a time, and it stays valid until commit() or cancel() is called.
+            ///          This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined. Releasing records while a reservation is
+            ///          active is allowed
+            /// @return View of n writable bytes, or a view with data() == nullptr if there is no contiguous room for them
+            Segment<value_type> reserve(const size_type n) noexcept;
+            /// @brief Publish the first n bytes of the active reservation as the newest record. n must not be larger than the
+            ///        reserved size, and 0 is a valid record size. This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            void commit(const size_type n) noexcept;
+            /// @brief Drop the active reservation without publishing anything
+            void cancel() noexcept;
+            /// @brief Copy n bytes from data into a new record, same as reserve(n), std::memcpy and commit(n)
+            /// @return true if there was room for the record
+            bool try_push_back(const void* data, const size_type n) noexcept;
+
+            /// @brief View of the payload of the oldest record. Buffer must not be empty.
+            ///        This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            /// @details The view stays valid until the record is released, writing new records does not move it
+            Segment<const value_type> peek() const noexcept;
+            /// @brief Remove the oldest record. Buffer must not be empty. This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            void release() noexcept;
+
+            void swap(BipRingBuffer& other) noexcept;
+
+        private:
+            /// @brief Number of bytes taken by a record with payload of n bytes, including length prefix and padding
+            static size_type record_bytes(const size_type n) noexcept;
+            /// @brief Restore the invariants after region A becomes empty: region B takes its place, or if there is no
+            ///        region B and no active reservation, writing starts over from the start of the storage
+            void normalize() noexcept;
+
+            std::vector<value_type> mStorage;
+            // region A is [mAStart, mAEnd), region B is [0, mBEnd) and is in use only when mBEnd != 0
+            size_type mAStart;
+            size_type mAEnd;
+            size_type mBEnd;
+            size_type mSize;
+            // active reservation, its payload starts at mReserveStart + sizeof(header_type)
+            size_type mReserveStart;
+            size_type mReserveSize;
+            bool mReserveInB;
+            bool mReserving;
+    };
+
+    void swap(BipRingBuffer& lhs, BipRingBuffer& rhs) noexcept;
+} // namespace simpleContainers
+
+// ============================================================================================================================================
+// ============================================================== IMPLEMENTATION ==============================================================
+// ============================================================================================================================================
+
+namespace simpleContainers {
+    inline BipRingBuffer::BipRingBuffer(const size_type initialCapacity)
+        : mStorage((initialCapacity + recordAlignment - 1) / recordAlignment * recordAlignment), mAStart{0}, mAEnd{0}, mBEnd{0}, mSize{0}, mReserveStart{0}, mReserveSize{0}, mReserveInB{false}, mReserving{false}
+    {
+        SIMPLE_RING_BUFFER_ASSERT(initialCapacity != 0, "BipRingBuffer must not be constructed with initial capacity of 0");
+    }
+
+    inline BipRingBuffer::BipRingBuffer(BipRingBuffer&& other) noexcept
+        : mStorage(std::move(other.mStorage)), mAStart{other.mAStart}, mAEnd{other.mAEnd}, mBEnd{other.mBEnd}, mSize{other.mSize},
+          mReserveStart{other.mReserveStart}, mReserveSize{other.mReserveSize}, mReserveInB{other.mReserveInB}, mReserving{other.mReserving}
+    {
+        other.mStorage.clear();
+        other.clear();
+    }
+
+    inline BipRingBuffer& BipRingBuffer::operator=(BipRingBuffer&& other) noexcept {
+        if (this != &other) {
+            BipRingBuffer tmp(std::move(other));
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    inline BipRingBuffer::size_type BipRingBuffer::size() const noexcept {
+        return mSize;
+    }
+
+    inline bool BipRingBuffer::empty() const noexcept {
+        return mSize == 0;
+    }
+
+    inline BipRingBuffer::size_type BipRingBuffer::capacity() const noexcept {
+        return mStorage.size();
+    }
+
+    inline BipRingBuffer::size_type BipRingBuffer::used_bytes() const noexcept {
+        return (mAEnd - mAStart) + mBEnd;
+    }
+
+    inline BipRingBuffer::size_type BipRingBuffer::max_reservable() const noexcept {
+        size_type room = 0;
+        if (mBEnd != 0) {
+            room = mAStart - mBEnd;
+        }
+        else {
+            room = std::max(mStorage.size() - mAEnd, mAStart);
+        }
+        return room < sizeof(header_type) ? 0 : room - sizeof(header_type);
+    }
+
+    inline void BipRingBuffer::clear() noexcept {
+        mAStart = 0;
+        mAEnd = 0;
+        mBEnd = 0;
+        mSize = 0;
+        mReserveStart = 0;
+        mReserveSize = 0;
+        mReserveInB = false;
+        mReserving = false;
+    }
+
+    inline Segment<BipRingBuffer::value_type> BipRingBuffer::reserve(const size_type n) noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(!mReserving, "BipRingBuffer::reserve called while another reservation is active");
+        SIMPLE_RING_BUFFER_ASSERT(n <= std::numeric_limits<header_type>::max(), "BipRingBuffer::reserve record does not fit in the length prefix");
+
+        const size_type needed = record_bytes(n);
+        if (mBEnd != 0) {
+            // region B grows up to the start of region A
+            if (needed > mAStart - mBEnd) {
+                return Segment<value_type>();
+            }
+            mReserveStart = mBEnd;
+            mReserveInB = true;
+        }
+        else if (needed <= mStorage.size() - mAEnd) {
+            mReserveStart = mAEnd;
+            mReserveInB = false;
+        }
+        else if (needed <= mAStart) {
+            // not enough room after region A, start region B
+            mReserveStart = 0;
+            mReserveInB = true;
+        }
+        else {
+            return Segment<value_type>();
+        }
+
+        mReserveSize = n;
+        mReserving = true;
+        return Segment<value_type>(mStorage.data() + mReserveStart + sizeof(header_type), n);
+    }
+
+    inline void BipRingBuffer::commit(const size_type n) noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(mReserving, "BipRingBuffer::commit called without an active reservation");
+        SIMPLE_RING_BUFFER_ASSERT(n <= mReserveSize, "BipRingBuffer::commit called with more bytes than were reserved");
+
+        const header_type length = static_cast<header_type>(n);
+        std::memcpy(mStorage.data() + mReserveStart, &length, sizeof(length));
+
+        const size_type recordEnd = mReserveStart + record_bytes(n);
+        if (mReserveInB) {
+            mBEnd = recordEnd;
+        }
+        else {
+            mAEnd = recordEnd;
+        }
+        ++mSize;
+        mReserving = false;
+        normalize();
+    }
+
+    inline void BipRingBuffer::cancel() noexcept {
+        mReserving = false;
+        normalize();
+    }
+
+    inline bool BipRingBuffer::try_push_back(const void* data, const size_type n) noexcept {
+        const Segment<value_type> space = reserve(n);
+        if (space.data() == nullptr) {
+            return false;
+        }
+        if (n != 0) {
+            std::memcpy(space.data(), data, n);
+        }
+        commit(n);
+        return true;
+    }
+
+    inline Segment<const BipRingBuffer::value_type> BipRingBuffer::peek() const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(!empty(), "BipRingBuffer::peek called on an empty buffer");
+        header_type length = 0;
+        std::memcpy(&length, mStorage.data() + mAStart, sizeof(length));
+        return Segment<const value_type>(mStorage.data() + mAStart + sizeof(header_type), length);
+    }
+
+    inline void BipRingBuffer::release() noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(!empty(), "BipRingBuffer::release called on an empty buffer");
+        header_type length = 0;
+        std::memcpy(&length, mStorage.data() + mAStart, sizeof(length));
+        mAStart += record_bytes(length);
+        --mSize;
+        normalize();
+    }
+
+    inline void BipRingBuffer::swap(BipRingBuffer& other) noexcept {
+        using std::swap;
+        swap(mStorage, other.mStorage);
+        swap(mAStart, other.mAStart);
+        swap(mAEnd, other.mAEnd);
+        swap(mBEnd, other.mBEnd);
+        swap(mSize, other.mSize);
+        swap(mReserveStart, other.mReserveStart);
+        swap(mReserveSize, other.mReserveSize);
+        swap(mReserveInB, other.mReserveInB);
+        swap(mReserving, other.mReserving);
+    }
+
+    inline BipRingBuffer::size_type BipRingBuffer::record_bytes(const size_type n) noexcept {
+        return (sizeof(header_type) + n + recordAlignment - 1) / recordAlignment * recordAlignment;
+    }
+
+    inline void BipRingBuffer::normalize() noexcept {
+        if (mAStart != mAEnd) {
+            return;
+        }
+
+        if (mBEnd != 0) {
+            // an active reservation in region B now extends region A, since it starts at the old end of region B
+            mAStart = 0;
+            mAEnd = mBEnd;
+            mBEnd = 0;
+            mReserveInB = false;
+        }
+        else if (!mReserving) {
+            mAStart = 0;
+            mAEnd = 0;
+        }
+    }
+
+    inline void swap(BipRingBuffer& lhs, BipRingBuffer& rhs) noexcept {
+        lhs.swap(rhs);
+    }
+} // namespace simpleContainers
+
+#endif // SIMPLE_BIP_RING_BUFFER_HPP
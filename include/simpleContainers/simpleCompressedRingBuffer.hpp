@@ -0,0 +1,576 @@
+/// @file simpleCompressedRingBuffer.hpp
+/// @brief File containing API and implementaiton of CompressedRingBuffer class
+
+#ifndef SIMPLE_COMPRESSED_RING_BUFFER_HPP
+#define SIMPLE_COMPRESSED_RING_BUFFER_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "simpleRingBuffer.hpp"
+
+// ============================================================================================================================================
+// =================================================================== API ====================================================================
+// ============================================================================================================================================
+
+namespace simpleContainers {
+    namespace detail {
+        /// @brief Append the count lowest bits of value to a bit stream, least significant bit first
+        /// @details count must be in range [1, 64] and value must not have any bits set above the count lowest ones
+        void append_bits(std::vector<std::uint64_t>& words, std::size_t& bitCount, const std::uint64_t value, const unsigned count);
+        /// @brief Read count bits written by append_bits, starting at bitPosition, and advance bitPosition past them
+        std::uint64_t read_bits(const std::uint64_t* words, std::size_t& bitPosition, const unsigned count) noexcept;
+
+        /// @brief State carried from one sample to the next by the codecs below, both when encoding and when decoding
+        struct CodecState {
+            // bits of the previous sample
+            std::uint64_t previous = 0;
+            // difference between the previous two samples, used by DeltaOfDeltaCodec
+            std::uint64_t previousDelta = 0;
+            // window of meaningful bits of the previous XOR, used by XorCodec. 64 means there is no window yet
+            unsigned previousLeading = 64;
+            unsigned previousTrailing = 0;
+        };
+
+        /// @brief Delta-of-delta encoding for integers and timestamps
+        /// @details The first sample of a block is stored as is. Every other sample is stored as the zigzag encoded difference
+        ///          between its delta and the previous delta, behind a prefix selecting the width of that difference:
+        ///          '0' for no change (1 bit), '10' + 7 bits, '110' + 12 bits, '1110' + 20 bits and '1111' + 64 bits.
+        ///          Samples that grow at a constant rate, like timestamps of a periodic scrape, take one bit each
+        struct DeltaOfDeltaCodec {
+            static void encode(CodecState& state, std::vector<std::uint64_t>& words, std::size_t& bitCount, const std::uint64_t bits, const bool first);
+            static std::uint64_t decode(CodecState& state, const std::uint64_t* words, std::size_t& bitPosition, const bool first) noexcept;
+        };
+
+        /// @brief XOR encoding for doubles, as described in the Gorilla paper
+        /// @details The first sample of a block is stored as is. Every other sample is XORed with the previous one: '0' if they
+        ///          are equal (1 bit), '10' + the meaningful bits if the XOR fits in the window of meaningful bits of the
+        ///          previous XOR, otherwise '11' + 5 bits of leading zeros + 6 bits of length + the meaningful bits, which
+        ///          starts a new window. Slowly changing metrics share sign, exponent and high mantissa bits, so most XORs are short
+        struct XorCodec {
+            static void encode(CodecState& state, std::vector<std::uint64_t>& words, std::size_t& bitCount, const std::uint64_t bits, const bool first);
+            static std::uint64_t decode(CodecState& state, const std::uint64_t* words, std::size_t& bitPosition, const bool first) noexcept;
+        };
+
+        std::uint64_t zigzag_encode(const std::uint64_t value) noexcept;
+        std::uint64_t zigzag_decode(const std::uint64_t value) noexcept;
+        /// @brief Index of the lowest set bit of value, value must not be 0
+        unsigned lowest_bit_index(const std::uint64_t value) noexcept;
+
+        /// @brief Conversion between samples and the 64 bits the codecs work on. Integers are sign or zero extended
+        template <typename T>
+        struct SampleBits {
+            static std::uint64_t to_bits(const T value) noexcept;
+            static T from_bits(const std::uint64_t bits) noexcept;
+        };
+
+        /// @brief Doubles are reinterpreted, so every value including NaN payloads is restored exactly
+        template <>
+        struct SampleBits<double> {
+            static std::uint64_t to_bits(const double value) noexcept;
+            static double from_bits(const std::uint64_t bits) noexcept;
+        };
+    } // namespace detail
+
+    /// @brief Ring buffer of numeric samples stored compressed in fixed-size blocks
+    /// @details Samples are appended to the newest block, encoded with delta-of-delta for integers (see DeltaOfDeltaCodec)
+    ///          or Gorilla XOR for doubles (see XorCodec). A block holds SamplesPerBlock samples and is never modified once
+    ///          full. Blocks are kept in a RingBuffer, and when all of them are full the next sample evicts the whole oldest
+    ///          block, reusing its memory for the new one. So capacity() is always a whole number of blocks, and once the buffer
+    ///          has been filled, size() is between capacity() - SamplesPerBlock + 1 and capacity(). To always keep at least
+    ///          N samples, construct it with a capacity of N + SamplesPerBlock.
+    ///          Each block starts from a raw sample, so it can be decoded on its own. Samples are read back in insertion
+    ///          order through a forward iterator that decodes one sample per increment, there is no random access.
+    ///          Timestamps can be kept in a second CompressedRingBuffer<std::int64_t> with the same SamplesPerBlock, since both
+    ///          evict at the same time when they are always appended to together
+    /// @tparam T Type of the samples, an integral type other than bool, or double
+    /// @tparam SamplesPerBlock Number of samples in one block. Larger blocks compress a little better, since the first
+    ///         sample of every block is stored uncompressed, but evict more samples at once
+    template <typename T, std::size_t SamplesPerBlock = 1024>
+    class CompressedRingBuffer {
+        public:
+            using value_type = T;
+            using size_type = std::size_t;
+            using difference_type = std::ptrdiff_t;
+            using codec_type = typename std::conditional<std::is_floating_point<T>::value, detail::XorCodec, detail::DeltaOfDeltaCodec>::type;
+
+            SIMPLE_RING_BUFFER_STATIC_ASSERT(((std::is_integral<T>::value && !std::is_same<T, bool>::value) || std::is_same<T, double>::value),
+                "CompressedRingBuffer requires an integral element type other than bool, or double.");
+            SIMPLE_RING_BUFFER_STATIC_ASSERT((SamplesPerBlock > 0), "CompressedRingBuffer blocks must not be empty.");
+
+            /// @brief Forward iterator that decodes samples in insertion order
+            /// @details Dereferencing returns the decoded sample by value, which is why there is no non-const iterator.
+            ///          Any insertion or eviction invalidates all iterators
+            class CompressedRingBufferIterator {
+                public:
+                    using iterator_category = std::forward_iterator_tag;
+                    using value_type = typename CompressedRingBuffer<T, SamplesPerBlock>::value_type;
+                    using difference_type = typename CompressedRingBuffer<T, SamplesPerBlock>::difference_type;
+                    using size_type = typename CompressedRingBuffer<T, SamplesPerBlock>::size_type;
+                    using pointer = const value_type*;
+                    using reference = value_type;
+
+                    CompressedRingBufferIterator() noexcept;
+                    /// @brief Construct iterator to the sample at position pos, which must be 0 or size() of rb
+                    CompressedRingBufferIterator(const size_type pos, const CompressedRingBuffer<T, SamplesPerBlock>* rb) noexcept;
+
+                    reference operator*() const noexcept;
+                    pointer operator->() const noexcept;
+
+                    CompressedRingBufferIterator& operator++() noexcept; // prefix
+                    CompressedRingBufferIterator operator++(int) noexcept; // postfix
+
+                    friend bool operator==(const CompressedRingBufferIterator& lhs, const CompressedRingBufferIterator& rhs) noexcept {
+                        SIMPLE_RING_BUFFER_ASSERT(lhs.mRingBufPtr == rhs.mRingBufPtr, "CompressedRingBufferIterator == comparison must be done on iterators of the same CompressedRingBuffer");
+                        return lhs.mPosition == rhs.mPosition;
+                    }
+
+                    friend bool operator!=(const CompressedRingBufferIterator& lhs, const CompressedRingBufferIterator& rhs) noexcept {
+                        SIMPLE_RING_BUFFER_ASSERT(lhs.mRingBufPtr == rhs.mRingBufPtr, "CompressedRingBufferIterator != comparison must be done on iterators of the same CompressedRingBuffer");
+                        return lhs.mPosition != rhs.mPosition;
+                    }
+
+                private:
+                    /// @brief Decode the sample at mSampleInBlock of block mBlockPosition, starting a new block if it is the first one
+                    void decode_current() noexcept;
+
+                    const CompressedRingBuffer<T, SamplesPerBlock>* mRingBufPtr;
+                    size_type mPosition;
+                    size_type mBlockPosition;
+                    size_type mSampleInBlock;
+                    size_type mBitPosition;
+                    detail::CodecState mState;
+                    value_type mCurrent;
+            };
+
+            using iterator = CompressedRingBufferIterator;
+            using const_iterator = CompressedRingBufferIterator;
+
+            static constexpr size_type samplesPerBlock = SamplesPerBlock;
+            /// @brief Arbitrary default of 16 blocks
+            static constexpr size_type defaultInitialCapacity = 16 * SamplesPerBlock;
+
+            /// @brief Construct an empty buffer of initialCapacity samples, rounded up to a whole number of blocks
+            CompressedRingBuffer(const size_type initialCapacity = defaultInitialCapacity);
+
+            size_type capacity() const noexcept;
+            size_type size() const noexcept;
+            bool empty() const noexcept;
+            void clear() noexcept;
+
+            /// @brief Number of blocks that hold samples, the newest one can be partially filled
+            size_type block_count() const noexcept;
+            /// @brief Number of bytes taken by encoded samples of all blocks, not counting unused reserved memory
+            size_type encoded_bytes() const noexcept;
+
+            /// @brief Append value as the newest sample, evicting the oldest block if all blocks are full
+            void push_back(const value_type value);
+            /// @brief Remove all samples of the oldest block. Buffer must not be empty.
+            ///        This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            /// @return Number of removed samples
+            size_type pop_front_block() noexcept;
+
+            /// @brief Oldest sample, O(1). Buffer must not be empty. This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            value_type front() const noexcept;
+            /// @brief Newest sample, O(1). Buffer must not be empty. This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            value_type back() const noexcept;
+
+            /// @brief Decode all samples in insertion order (oldest first)
+            std::vector<value_type> get_elements() const;
+
+            const_iterator begin() const noexcept;
+            const_iterator end() const noexcept;
+            const_iterator cbegin() const noexcept;
+            const_iterator cend() const noexcept;
+
+        private:
+            struct Block {
+                Block() : words{}, bitCount{0}, sampleCount{0}, state{} {}
+
+                std::vector<std::uint64_t> words;
+                size_type bitCount;
+                size_type sampleCount;
+                // encoder state after the last sample of this block
+                detail::CodecState state;
+            };
+
+            RingBuffer<Block> mBlocks;
+            size_type mSize;
+    };
+} // namespace simpleContainers
+
+// ============================================================================================================================================
+// ============================================================== IMPLEMENTATION ==============================================================
+// ============================================================================================================================================
+
+namespace simpleContainers {
+    namespace detail {
+        inline void append_bits(std::vector<std::uint64_t>& words, std::size_t& bitCount, const std::uint64_t value, const unsigned count) {
+            SIMPLE_RING_BUFFER_ASSERT(count >= 1 && count <= 64, "append_bits count must be in range [1, 64]");
+            SIMPLE_RING_BUFFER_ASSERT(count == 64 || (value >> count) == 0, "append_bits value has bits set above count");
+            const std::size_t wordIndex = bitCount / 64;
+            const unsigned offset = static_cast<unsigned>(bitCount % 64);
+            if (offset == 0) {
+                words.push_back(value);
+            }
+            else {
+                words[wordIndex] |= value << offset;
+                if (offset + count > 64) {
+                    words.push_back(value >> (64 - offset));
+                }
+            }
+            bitCount += count;
+        }
+
+        inline std::uint64_t read_bits(const std::uint64_t* words, std::size_t& bitPosition, const unsigned count) noexcept {
+            const std::size_t wordIndex = bitPosition / 64;
+            const unsigned offset = static_cast<unsigned>(bitPosition % 64);
+            std::uint64_t result = words[wordIndex] >> offset;
+            if (offset != 0 && offset + count > 64) {
+                result |= words[wordIndex + 1] << (64 - offset);
+            }
+            bitPosition += count;
+            return count == 64 ? result : result & ((std::uint64_t{1} << count) - 1);
+        }
+
+        inline void DeltaOfDeltaCodec::encode(CodecState& state, std::vector<std::uint64_t>& words, std::size_t& bitCount, const std::uint64_t bits, const bool first) {
+            if (first) {
+                append_bits(words, bitCount, bits, 64);
+                state.previous = bits;
+                state.previousDelta = 0;
+                return;
+            }
+
+            // unsigned arithmetic wraps, so any two samples have a delta and decoding restores them exactly
+            const std::uint64_t delta = bits - state.previous;
+            const std::uint64_t zigzag = zigzag_encode(delta - state.previousDelta);
+            if (zigzag == 0) {
+                append_bits(words, bitCount, 0, 1);
+            }
+            else if (zigzag < (std::uint64_t{1} << 7)) {
+                append_bits(words, bitCount, 0x1 | (zigzag << 2), 2 + 7);
+            }
+            else if (zigzag < (std::uint64_t{1} << 12)) {
+                append_bits(words, bitCount, 0x3 | (zigzag << 3), 3 + 12);
+            }
+            else if (zigzag < (std::uint64_t{1} << 20)) {
+                append_bits(words, bitCount, 0x7 | (zigzag << 4), 4 + 20);
+            }
+            else {
+                append_bits(words, bitCount, 0xf, 4);
+                append_bits(words, bitCount, zigzag, 64);
+            }
+
+            state.previous = bits;
+            state.previousDelta = delta;
+        }
+
+        inline std::uint64_t DeltaOfDeltaCodec::decode(CodecState& state, const std::uint64_t* words, std::size_t& bitPosition, const bool first) noexcept {
+            if (first) {
+                state.previous = read_bits(words, bitPosition, 64);
+                state.previousDelta = 0;
+                return state.previous;
+            }
+
+            // count the leading ones of the prefix, at most 4
+            unsigned prefix = 0;
+            while (prefix < 4 && read_bits(words, bitPosition, 1) != 0) {
+                ++prefix;
+            }
+
+            static const unsigned payloadBits[5] = {0, 7, 12, 20, 64};
+            const std::uint64_t zigzag = prefix == 0 ? 0 : read_bits(words, bitPosition, payloadBits[prefix]);
+            const std::uint64_t delta = state.previousDelta + zigzag_decode(zigzag);
+
+            state.previous += delta;
+            state.previousDelta = delta;
+            return state.previous;
+        }
+
+        inline void XorCodec::encode(CodecState& state, std::vector<std::uint64_t>& words, std::size_t& bitCount, const std::uint64_t bits, const bool first) {
+            if (first) {
+                append_bits(words, bitCount, bits, 64);
+                state.previous = bits;
+                state.previousLeading = 64;
+                state.previousTrailing = 0;
+                return;
+            }
+
+            const std::uint64_t xored = bits ^ state.previous;
+            state.previous = bits;
+            if (xored == 0) {
+                append_bits(words, bitCount, 0, 1);
+                return;
+            }
+
+            // leading zeros are stored in 5 bits, so at most 31 of them are skipped
+            const unsigned leading = std::min(63u - highest_bit_index(xored), 31u);
+            const unsigned trailing = lowest_bit_index(xored);
+
+            if (state.previousLeading != 64 && leading >= state.previousLeading && trailing >= state.previousTrailing) {
+                append_bits(words, bitCount, 0x1, 2);
+                append_bits(words, bitCount, xored >> state.previousTrailing, 64 - state.previousLeading - state.previousTrailing);
+            }
+            else {
+                const unsigned meaningful = 64 - leading - trailing;
+                append_bits(words, bitCount, 0x3 | (std::uint64_t{leading} << 2) | (std::uint64_t{meaningful - 1} << 7), 2 + 5 + 6);
+                append_bits(words, bitCount, xored >> trailing, meaningful);
+                state.previousLeading = leading;
+                state.previousTrailing = trailing;
+            }
+        }
+
+        inline std::uint64_t XorCodec::decode(CodecState& state, const std::uint64_t* words, std::size_t& bitPosition, const bool first) noexcept {
+            if (first) {
+                state.previous = read_bits(words, bitPosition, 64);
+                state.previousLeading = 64;
+                state.previousTrailing = 0;
+                return state.previous;
+            }
+
+            if (read_bits(words, bitPosition, 1) == 0) {
+                return state.previous;
+            }
+
+            if (read_bits(words, bitPosition, 1) != 0) {
+                const std::uint64_t header = read_bits(words, bitPosition, 5 + 6);
+                const unsigned leading = static_cast<unsigned>(header & 0x1f);
+                const unsigned meaningful = static_cast<unsigned>(header >> 5) + 1;
+                state.previousLeading = leading;
+                state.previousTrailing = 64 - leading - meaningful;
+            }
+
+            const unsigned meaningful = 64 - state.previousLeading - state.previousTrailing;
+            state.previous ^= read_bits(words, bitPosition, meaningful) << state.previousTrailing;
+            return state.previous;
+        }
+
+        inline std::uint64_t zigzag_encode(const std::uint64_t value) noexcept {
+            return (value << 1) ^ (std::uint64_t{0} - (value >> 63));
+        }
+
+        inline std::uint64_t zigzag_decode(const std::uint64_t value) noexcept {
+            return (value >> 1) ^ (std::uint64_t{0} - (value & 1));
+        }
+
+        inline unsigned lowest_bit_index(const std::uint64_t value) noexcept {
+            SIMPLE_RING_BUFFER_ASSERT(value != 0, "lowest_bit_index called with 0");
+            // isolate the lowest set bit
+            return highest_bit_index(value & (std::uint64_t{0} - value));
+        }
+
+        template <typename T>
+        inline std::uint64_t SampleBits<T>::to_bits(const T value) noexcept {
+            // conversion to unsigned is modulo 2^64, which sign extends negative values
+            return static_cast<std::uint64_t>(value);
+        }
+
+        template <typename T>
+        inline T SampleBits<T>::from_bits(const std::uint64_t bits) noexcept {
+            return static_cast<T>(bits);
+        }
+
+        inline std::uint64_t SampleBits<double>::to_bits(const double value) noexcept {
+            std::uint64_t bits = 0;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+
+        inline double SampleBits<double>::from_bits(const std::uint64_t bits) noexcept {
+            double value = 0.0;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+    } // namespace detail
+
+    // ---------------------------------------------------------------- iterator ----------------------------------------------------------------
+
+    template <typename T, std::size_t SamplesPerBlock>
+    inline CompressedRingBuffer<T, SamplesPerBlock>::CompressedRingBufferIterator::CompressedRingBufferIterator() noexcept
+        : mRingBufPtr{nullptr}, mPosition{0}, mBlockPosition{0}, mSampleInBlock{0}, mBitPosition{0}, mState{}, mCurrent{}
+    {}
+
+    template <typename T, std::size_t SamplesPerBlock>
+    inline CompressedRingBuffer<T, SamplesPerBlock>::CompressedRingBufferIterator::CompressedRingBufferIterator(const size_type pos, const CompressedRingBuffer<T, SamplesPerBlock>* rb) noexcept
+        : mRingBufPtr{rb}, mPosition{pos}, mBlockPosition{0}, mSampleInBlock{0}, mBitPosition{0}, mState{}, mCurrent{}
+    {
+        SIMPLE_RING_BUFFER_ASSERT(rb != nullptr && (pos == 0 || pos == rb->size()), "CompressedRingBufferIterator can only be constructed at the start or the end");
+        if (mPosition < mRingBufPtr->size()) {
+            decode_current();
+        }
+    }
+
+    template <typename T, std::size_t SamplesPerBlock>
+    inline typename CompressedRingBuffer<T, SamplesPerBlock>::CompressedRingBufferIterator::reference
+    CompressedRingBuffer<T, SamplesPerBlock>::CompressedRingBufferIterator::operator*() const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(mRingBufPtr != nullptr && mPosition < mRingBufPtr->size(), "CompressedRingBufferIterator::operator* called on an iterator that can not be dereferenced");
+        return mCurrent;
+    }
+
+    template <typename T, std::size_t SamplesPerBlock>
+    inline typename CompressedRingBuffer<T, SamplesPerBlock>::CompressedRingBufferIterator::pointer
+    CompressedRingBuffer<T, SamplesPerBlock>::CompressedRingBufferIterator::operator->() const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(mRingBufPtr != nullptr && mPosition < mRingBufPtr->size(), "CompressedRingBufferIterator::operator-> called on an iterator that can not be dereferenced");
+        return &mCurrent;
+    }
+
+    template <typename T, std::size_t SamplesPerBlock>
+    inline typename CompressedRingBuffer<T, SamplesPerBlock>::CompressedRingBufferIterator&
+    CompressedRingBuffer<T, SamplesPerBlock>::CompressedRingBufferIterator::operator++() noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(mRingBufPtr != nullptr && mPosition < mRingBufPtr->size(), "CompressedRingBufferIterator::operator++ called on an end iterator");
+        ++mPosition;
+        ++mSampleInBlock;
+        if (mSampleInBlock == mRingBufPtr->mBlocks[mBlockPosition].sampleCount) {
+            ++mBlockPosition;
+            mSampleInBlock = 0;
+            mBitPosition = 0;
+        }
+
+        if (mPosition < mRingBufPtr->size()) {
+            decode_current();
+        }
+        return *this;
+    }
+
+    template <typename T, std::size_t SamplesPerBlock>
+    inline typename CompressedRingBuffer<T, SamplesPerBlock>::CompressedRingBufferIterator
+    CompressedRingBuffer<T, SamplesPerBlock>::CompressedRingBufferIterator::operator++(int) noexcept {
+        CompressedRingBufferIterator tmp = *this;
+        ++(*this);
+        return tmp;
+    }
+
+    template <typename T, std::size_t SamplesPerBlock>
+    inline void CompressedRingBuffer<T, SamplesPerBlock>::CompressedRingBufferIterator::decode_current() noexcept {
+        const Block& block = mRingBufPtr->mBlocks[mBlockPosition];
+        const std::uint64_t bits = codec_type::decode(mState, block.words.data(), mBitPosition, mSampleInBlock == 0);
+        mCurrent = detail::SampleBits<T>::from_bits(bits);
+    }
+
+    // ------------------------------------------------------------ CompressedRingBuffer ------------------------------------------------------------
+
+    template <typename T, std::size_t SamplesPerBlock>
+    constexpr typename CompressedRingBuffer<T, SamplesPerBlock>::size_type CompressedRingBuffer<T, SamplesPerBlock>::samplesPerBlock;
+
+    template <typename T, std::size_t SamplesPerBlock>
+    constexpr typename CompressedRingBuffer<T, SamplesPerBlock>::size_type CompressedRingBuffer<T, SamplesPerBlock>::defaultInitialCapacity;
+
+    template <typename T, std::size_t SamplesPerBlock>
+    inline CompressedRingBuffer<T, SamplesPerBlock>::CompressedRingBuffer(const size_type initialCapacity)
+        : mBlocks((initialCapacity + SamplesPerBlock - 1) / SamplesPerBlock), mSize{0}
+    {
+        SIMPLE_RING_BUFFER_ASSERT(initialCapacity != 0, "CompressedRingBuffer must not be constructed with initial capacity of 0");
+    }
+
+    template <typename T, std::size_t SamplesPerBlock>
+    inline typename CompressedRingBuffer<T, SamplesPerBlock>::size_type CompressedRingBuffer<T, SamplesPerBlock>::capacity() const noexcept {
+        return mBlocks.capacity() * SamplesPerBlock;
+    }
+
+    template <typename T, std::size_t SamplesPerBlock>
+    inline typename CompressedRingBuffer<T, SamplesPerBlock>::size_type CompressedRingBuffer<T, SamplesPerBlock>::size() const noexcept {
+        return mSize;
+    }
+
+    template <typename T, std::size_t SamplesPerBlock>
+    inline bool CompressedRingBuffer<T, SamplesPerBlock>::empty() const noexcept {
+        return mSize == 0;
+    }
+
+    template <typename T, std::size_t SamplesPerBlock>
+    inline void CompressedRingBuffer<T, SamplesPerBlock>::clear() noexcept {
+        mBlocks.clear();
+        mSize = 0;
+    }
+
+    template <typename T, std::size_t SamplesPerBlock>
+    inline typename CompressedRingBuffer<T, SamplesPerBlock>::size_type CompressedRingBuffer<T, SamplesPerBlock>::block_count() const noexcept {
+        return mBlocks.size();
+    }
+
+    template <typename T, std::size_t SamplesPerBlock>
+    inline typename CompressedRingBuffer<T, SamplesPerBlock>::size_type CompressedRingBuffer<T, SamplesPerBlock>::encoded_bytes() const noexcept {
+        size_type bitCount = 0;
+        for (const Block& block : mBlocks) {
+            bitCount += block.bitCount;
+        }
+        return (bitCount + 7) / 8;
+    }
+
+    template <typename T, std::size_t SamplesPerBlock>
+    inline void CompressedRingBuffer<T, SamplesPerBlock>::push_back(const value_type value) {
+        if (mBlocks.empty() || mBlocks.back().sampleCount == SamplesPerBlock) {
+            if (mBlocks.full()) {
+                mSize -= mBlocks.front().sampleCount;
+            }
+            // evicts the oldest block if all blocks are in use, and keeps the memory of its words
+            Block& block = mBlocks.recycle_back();
+            block.words.clear();
+            block.bitCount = 0;
+            block.sampleCount = 0;
+        }
+
+        Block& block = mBlocks.back();
+        codec_type::encode(block.state, block.words, block.bitCount, detail::SampleBits<T>::to_bits(value), block.sampleCount == 0);
+        ++block.sampleCount;
+        ++mSize;
+    }
+
+    template <typename T, std::size_t SamplesPerBlock>
+    inline typename CompressedRingBuffer<T, SamplesPerBlock>::size_type CompressedRingBuffer<T, SamplesPerBlock>::pop_front_block() noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(!empty(), "CompressedRingBuffer::pop_front_block called on an empty buffer");
+        const size_type removed = mBlocks.front().sampleCount;
+        mBlocks.pop_front();
+        mSize -= removed;
+        return removed;
+    }
+
+    template <typename T, std::size_t SamplesPerBlock>
+    inline typename CompressedRingBuffer<T, SamplesPerBlock>::value_type CompressedRingBuffer<T, SamplesPerBlock>::front() const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(!empty(), "CompressedRingBuffer::front called on an empty buffer");
+        // the first sample of every block is stored as is
+        size_type bitPosition = 0;
+        return detail::SampleBits<T>::from_bits(detail::read_bits(mBlocks.front().words.data(), bitPosition, 64));
+    }
+
+    template <typename T, std::size_t SamplesPerBlock>
+    inline typename CompressedRingBuffer<T, SamplesPerBlock>::value_type CompressedRingBuffer<T, SamplesPerBlock>::back() const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(!empty(), "CompressedRingBuffer::back called on an empty buffer");
+        return detail::SampleBits<T>::from_bits(mBlocks.back().state.previous);
+    }
+
+    template <typename T, std::size_t SamplesPerBlock>
+    inline std::vector<typename CompressedRingBuffer<T, SamplesPerBlock>::value_type> CompressedRingBuffer<T, SamplesPerBlock>::get_elements() const {
+        std::vector<value_type> result;
+        result.reserve(mSize);
+        result.insert(result.end(), cbegin(), cend());
+        return result;
+    }
+
+    template <typename T, std::size_t SamplesPerBlock>
+    inline typename CompressedRingBuffer<T, SamplesPerBlock>::const_iterator CompressedRingBuffer<T, SamplesPerBlock>::begin() const noexcept {
+        return const_iterator(0, this);
+    }
+
+    template <typename T, std::size_t SamplesPerBlock>
+    inline typename CompressedRingBuffer<T, SamplesPerBlock>::const_iterator CompressedRingBuffer<T, SamplesPerBlock>::end() const noexcept {
+        return const_iterator(mSize, this);
+    }
+
+    template <typename T, std::size_t SamplesPerBlock>
+    inline typename CompressedRingBuffer<T, SamplesPerBlock>::const_iterator CompressedRingBuffer<T, SamplesPerBlock>::cbegin() const noexcept {
+        return const_iterator(0, this);
+    }
+
+    template <typename T, std::size_t SamplesPerBlock>
+    inline typename CompressedRingBuffer<T, SamplesPerBlock>::const_iterator CompressedRingBuffer<T, SamplesPerBlock>::cend() const noexcept {
+        return const_iterator(mSize, this);
+    }
+} // namespace simpleContainers
+
+#endif // SIMPLE_COMPRESSED_RING_BUFFER_HPP
@@ -0,0 +1,288 @@
+/// @file simpleMinMaxRingBuffer.hpp
+/// @brief File containing API and implementaiton of MinMaxRingBuffer class
+
+#ifndef SIMPLE_MIN_MAX_RING_BUFFER_HPP
+#define SIMPLE_MIN_MAX_RING_BUFFER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include "simpleRingBuffer.hpp"
+
+// ============================================================================================================================================
+// =================================================================== API ====================================================================
+// ============================================================================================================================================
+
+namespace simpleContainers {
+    /// @brief RingBuffer that tracks the smallest and the largest element it currently holds
+    /// @details Next to the elements, two monotonic deques of sequence numbers (position of an element in the order of all
+    ///          insertions since construction) are kept: one of candidates for the minimum with increasing values, one of
+    ///          candidates for the maximum with decreasing values. Inserting an element removes every candidate it makes
+    ///          irrelevant from the back of each deque, evicting an element removes it from the front. Every element enters
+    ///          and leaves each deque at most once, so insertion is amortized O(1) and window_min() and window_max() are O(1).
+    ///          The deques are RingBuffers with the same capacity as the elements, so no allocation is made after construction.
+    ///          Elements can only be modified through MinMaxRingBuffer, the underlying RingBuffer is available read-only
+    /// @tparam T Type of the elements
+    /// @tparam Compare Strict weak ordering of the elements, the minimum is the element that compares before all others.
+    ///         If several elements are equally smallest (or largest), the newest one is reported
+    /// @tparam Allocator Allocator type of the underlying RingBuffer
+    /// @tparam CapacityPolicy Capacity policy of the underlying RingBuffer
+    template <typename T, typename Compare = std::less<T>, typename Allocator = std::allocator<T>, typename CapacityPolicy = ExactCapacity>
+    class MinMaxRingBuffer {
+        public:
+            using ring_buffer_type = RingBuffer<T, Allocator, CapacityPolicy>;
+            using value_type = typename ring_buffer_type::value_type;
+            using const_reference = typename ring_buffer_type::const_reference;
+            using size_type = typename ring_buffer_type::size_type;
+            using allocator_type = typename ring_buffer_type::allocator_type;
+            using const_iterator = typename ring_buffer_type::const_iterator;
+            using value_compare = Compare;
+            using sequence_type = std::uint64_t;
+
+            MinMaxRingBuffer(const size_type initialCapacity = ring_buffer_type::defaultInitialCapacity, const Compare& comp = Compare{},
+                const allocator_type& alloc = allocator_type{});
+
+            size_type capacity() const noexcept;
+            size_type size() const noexcept;
+            bool empty() const noexcept;
+            bool full() const noexcept;
+            void clear() noexcept;
+
+            /// @brief Insert elem and update the extrema, evicting the oldest element if the buffer is full
+            /// @details Exceptions thrown by Compare are propagated. The extrema are then unspecified until clear() is called
+            void push_back(const value_type& elem);
+            void push_back(value_type&& elem);
+            template <typename ...Args>
+            void emplace_back(Args&&... args);
+            /// @brief Remove the oldest element. Buffer must not be empty.
+            ///        This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            void pop_front() noexcept;
+
+            /// @brief Smallest element in the window. Buffer must not be empty.
+            ///        This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            const_reference window_min() const noexcept;
+            /// @brief Largest element in the window. Buffer must not be empty.
+            ///        This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            const_reference window_max() const noexcept;
+            /// @brief Position of window_min() in insertion order, so that (*this)[window_min_index()] is window_min()
+            size_type window_min_index() const noexcept;
+            /// @brief Position of window_max() in insertion order, so that (*this)[window_max_index()] is window_max()
+            size_type window_max_index() const noexcept;
+
+            /// @brief Read-only access to the underlying RingBuffer, for example to use segment algorithms on it
+            const ring_buffer_type& elements() const noexcept;
+            value_compare value_comp() const;
+
+            const_reference front() const noexcept;
+            const_reference back() const noexcept;
+            const_reference operator[](const size_type& pos) const noexcept;
+            const_reference at(const size_type& pos) const;
+
+            const_iterator begin() const noexcept;
+            const_iterator end() const noexcept;
+            const_iterator cbegin() const noexcept;
+            const_iterator cend() const noexcept;
+
+        private:
+            const_reference element_at_sequence(const sequence_type sequence) const noexcept;
+            void on_inserted();
+            void drop_evicted_candidates();
+
+        private:
+            ring_buffer_type mBuffer;
+            // sequence numbers of candidates, oldest at the front, values increasing for mMinCandidates and decreasing for mMaxCandidates
+            RingBuffer<sequence_type> mMinCandidates;
+            RingBuffer<sequence_type> mMaxCandidates;
+            // sequence number of mBuffer.front()
+            sequence_type mFrontSequence;
+            Compare mCompare;
+    };
+} // namespace simpleContainers
+
+// ============================================================================================================================================
+// ============================================================== IMPLEMENTATION ==============================================================
+// ============================================================================================================================================
+
+namespace simpleContainers {
+    template <typename T, typename Compare, typename Allocator, typename CapacityPolicy>
+    inline MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::MinMaxRingBuffer(const size_type initialCapacity, const Compare& comp, const allocator_type& alloc)
+        :   mBuffer(initialCapacity, alloc),
+            mMinCandidates(mBuffer.capacity()),
+            mMaxCandidates(mBuffer.capacity()),
+            mFrontSequence{0},
+            mCompare(comp)
+    {}
+
+    template <typename T, typename Compare, typename Allocator, typename CapacityPolicy>
+    inline typename MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::size_type MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::capacity() const noexcept {
+        return mBuffer.capacity();
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename CapacityPolicy>
+    inline typename MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::size_type MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::size() const noexcept {
+        return mBuffer.size();
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename CapacityPolicy>
+    inline bool MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::empty() const noexcept {
+        return mBuffer.empty();
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename CapacityPolicy>
+    inline bool MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::full() const noexcept {
+        return mBuffer.full();
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename CapacityPolicy>
+    inline void MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::clear() noexcept {
+        mFrontSequence += mBuffer.size();
+        mBuffer.clear();
+        mMinCandidates.clear();
+        mMaxCandidates.clear();
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename CapacityPolicy>
+    inline void MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::push_back(const value_type& elem) {
+        emplace_back(elem);
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename CapacityPolicy>
+    inline void MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::push_back(value_type&& elem) {
+        emplace_back(std::move(elem));
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename CapacityPolicy>
+    template <typename ...Args>
+    inline void MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::emplace_back(Args&&... args) {
+        // candidates only refer to elements by sequence number, so the evicted element can be overwritten before they are updated
+        const bool evicts = mBuffer.full();
+        mBuffer.emplace_back(std::forward<Args>(args)...);
+
+        if (evicts) {
+            ++mFrontSequence;
+            drop_evicted_candidates();
+        }
+        on_inserted();
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename CapacityPolicy>
+    inline void MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::pop_front() noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(!mBuffer.empty(), "MinMaxRingBuffer::pop_front called on an empty buffer");
+        mBuffer.pop_front();
+        ++mFrontSequence;
+        drop_evicted_candidates();
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename CapacityPolicy>
+    inline typename MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::const_reference MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::window_min() const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(!mBuffer.empty(), "MinMaxRingBuffer::window_min called on an empty buffer");
+        return element_at_sequence(mMinCandidates.front());
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename CapacityPolicy>
+    inline typename MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::const_reference MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::window_max() const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(!mBuffer.empty(), "MinMaxRingBuffer::window_max called on an empty buffer");
+        return element_at_sequence(mMaxCandidates.front());
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename CapacityPolicy>
+    inline typename MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::size_type MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::window_min_index() const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(!mBuffer.empty(), "MinMaxRingBuffer::window_min_index called on an empty buffer");
+        return static_cast<size_type>(mMinCandidates.front() - mFrontSequence);
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename CapacityPolicy>
+    inline typename MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::size_type MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::window_max_index() const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(!mBuffer.empty(), "MinMaxRingBuffer::window_max_index called on an empty buffer");
+        return static_cast<size_type>(mMaxCandidates.front() - mFrontSequence);
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename CapacityPolicy>
+    inline const typename MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::ring_buffer_type& MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::elements() const noexcept {
+        return mBuffer;
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename CapacityPolicy>
+    inline typename MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::value_compare MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::value_comp() const {
+        return mCompare;
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename CapacityPolicy>
+    inline typename MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::const_reference MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::front() const noexcept {
+        return mBuffer.front();
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename CapacityPolicy>
+    inline typename MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::const_reference MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::back() const noexcept {
+        return mBuffer.back();
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename CapacityPolicy>
+    inline typename MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::const_reference MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::operator[](const size_type& pos) const noexcept {
+        return mBuffer[pos];
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename CapacityPolicy>
+    inline typename MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::const_reference MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::at(const size_type& pos) const {
+        return mBuffer.at(pos);
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename CapacityPolicy>
+    inline typename MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::const_iterator MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::begin() const noexcept {
+        return mBuffer.begin();
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename CapacityPolicy>
+    inline typename MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::const_iterator MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::end() const noexcept {
+        return mBuffer.end();
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename CapacityPolicy>
+    inline typename MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::const_iterator MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::cbegin() const noexcept {
+        return mBuffer.cbegin();
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename CapacityPolicy>
+    inline typename MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::const_iterator MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::cend() const noexcept {
+        return mBuffer.cend();
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename CapacityPolicy>
+    inline typename MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::const_reference MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::element_at_sequence(const sequence_type sequence) const noexcept {
+        return mBuffer[static_cast<size_type>(sequence - mFrontSequence)];
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename CapacityPolicy>
+    inline void MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::on_inserted() {
+        const sequence_type newSequence = mFrontSequence + mBuffer.size() - 1;
+        const value_type& newElem = mBuffer.back();
+
+        // a candidate that is not smaller than the new element can never be the minimum again, since it will be evicted first
+        while (!mMinCandidates.empty() && !mCompare(element_at_sequence(mMinCandidates.back()), newElem)) {
+            mMinCandidates.pop_back();
+        }
+        while (!mMaxCandidates.empty() && !mCompare(newElem, element_at_sequence(mMaxCandidates.back()))) {
+            mMaxCandidates.pop_back();
+        }
+
+        // there are never more candidates than elements, so these never overwrite
+        mMinCandidates.push_back(newSequence);
+        mMaxCandidates.push_back(newSequence);
+    }
+
+    template <typename T, typename Compare, typename Allocator, typename CapacityPolicy>
+    inline void MinMaxRingBuffer<T, Compare, Allocator, CapacityPolicy>::drop_evicted_candidates() {
+        // at most one element is evicted at a time, so at most one candidate is dropped from each deque
+        if (!mMinCandidates.empty() && mMinCandidates.front() < mFrontSequence) {
+            mMinCandidates.pop_front();
+        }
+        if (!mMaxCandidates.empty() && mMaxCandidates.front() < mFrontSequence) {
+            mMaxCandidates.pop_front();
+        }
+    }
+} // namespace simpleContainers
+
+#endif // SIMPLE_MIN_MAX_RING_BUFFER_HPP
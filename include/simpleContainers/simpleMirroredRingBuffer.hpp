@@ -0,0 +1,569 @@
+/// @file simpleMirroredRingBuffer.hpp
+/// @brief File containing API and implementaiton of MirroredRingBuffer class
+
+#ifndef SIMPLE_MIRRORED_RING_BUFFER_HPP
+#define SIMPLE_MIRRORED_RING_BUFFER_HPP
+
+#include "simpleRingBuffer.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+    /// @brief Defined to 1 when MirroredRingBuffer is available on the target platform, 0 otherwise
+    /// @details MirroredRingBuffer maps the same shared memory object twice, which is currently implemented for POSIX systems only
+    #define SIMPLE_RING_BUFFER_HAS_MIRRORED_RING_BUFFER 1
+#else
+    #define SIMPLE_RING_BUFFER_HAS_MIRRORED_RING_BUFFER 0
+#endif // #if defined(__unix__) || defined(__APPLE__)
+
+#if SIMPLE_RING_BUFFER_HAS_MIRRORED_RING_BUFFER
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// ============================================================================================================================================
+// =================================================================== API ====================================================================
+// ============================================================================================================================================
+
+namespace simpleContainers {
+    template <typename T>
+    class MirroredRingBuffer;
+
+    template <typename T>
+    inline bool operator==(const MirroredRingBuffer<T>& lhs, const MirroredRingBuffer<T>& rhs) noexcept;
+
+    template <typename T>
+    inline bool operator!=(const MirroredRingBuffer<T>& lhs, const MirroredRingBuffer<T>& rhs) noexcept;
+
+    template <typename T>
+    inline bool operator<(const MirroredRingBuffer<T>& lhs, const MirroredRingBuffer<T>& rhs) noexcept;
+
+    template <typename T>
+    inline bool operator<=(const MirroredRingBuffer<T>& lhs, const MirroredRingBuffer<T>& rhs) noexcept;
+
+    template <typename T>
+    inline bool operator>(const MirroredRingBuffer<T>& lhs, const MirroredRingBuffer<T>& rhs) noexcept;
+
+    template <typename T>
+    inline bool operator>=(const MirroredRingBuffer<T>& lhs, const MirroredRingBuffer<T>& rhs) noexcept;
+
+    /// @brief Class representing a ring buffer whose elements are always contiguous in memory
+    /// @details Behaves like RingBuffer: it holds at most the last capacity() inserted elements and every insertion after
+    ///          that overwrites the oldest element. The storage is a shared memory object that is mapped twice, back to back,
+    ///          so the element just past the end of the storage is the first element of the storage again. Because of that,
+    ///          all elements, oldest first, always form a single contiguous range starting at data(), even after the buffer
+    ///          wraps around, and reading them never needs to wrap an index.
+    ///          Mappings are made with page granularity, so capacity is rounded up until the storage is a whole number of pages.
+    ///          This class is only available when SIMPLE_RING_BUFFER_HAS_MIRRORED_RING_BUFFER is 1.
+    ///          A strict weak ordering can be established between instances of MirroredRingBuffer, behavior is the same as std::vector
+    /// @tparam T Type of object contained inside MirroredRingBuffer. T must be trivially copyable since elements are written
+    ///         through one mapping and read through the other
+    template <typename T>
+    class MirroredRingBuffer {
+        public:
+            using value_type = T;
+            using reference = T&;
+            using const_reference = const T&;
+            using pointer = T*;
+            using const_pointer = const T*;
+            using size_type = std::size_t;
+            using difference_type = std::ptrdiff_t;
+            // elements are contiguous, so plain pointers can be used as iterators
+            using iterator = T*;
+            using const_iterator = const T*;
+
+            SIMPLE_RING_BUFFER_STATIC_ASSERT((std::is_trivially_copyable<value_type>::value), "MirroredRingBuffer<T> requires a trivially copyable T.");
+
+            /// @brief MirroredRingBuffer cannot be constructed with 0 capacity so this arbitrary value was chosen as a default
+            /// @details The actual capacity is usually larger since it is rounded up to whole pages
+            static constexpr size_type defaultInitialCapacity = 64;
+
+            /// @brief Construct a buffer that can hold at least initialCapacity elements
+            /// @details The actual capacity is the smallest value not below initialCapacity for which the storage is a whole
+            ///          number of pages. Throws std::system_error if the shared memory object cannot be created or mapped
+            explicit MirroredRingBuffer(const size_type initialCapacity = defaultInitialCapacity);
+
+            /// @brief Copy elements of other into a new mapping. Copying a moved-from buffer gives another buffer without storage
+            MirroredRingBuffer(const MirroredRingBuffer& other);
+            /// @brief Take over the mapping of other. other is left without storage and can only be destroyed, copied or assigned to
+            MirroredRingBuffer(MirroredRingBuffer&& other) noexcept;
+
+            MirroredRingBuffer& operator=(const MirroredRingBuffer& rhs);
+            MirroredRingBuffer& operator=(MirroredRingBuffer&& rhs) noexcept;
+
+            ~MirroredRingBuffer() noexcept;
+
+            size_type capacity() const noexcept;
+            size_type size() const noexcept;
+            bool empty() const noexcept;
+            bool full() const noexcept;
+            void clear() noexcept;
+
+            /// @brief Get elements in MirroredRingBuffer in order they were inserted (oldest first)
+            std::vector<value_type> get_elements() const;
+
+            void push_back(const value_type& elem) noexcept;
+            template <typename ...Args>
+            void emplace_back(Args&&... args) noexcept;
+            /// @brief Insert count elements from contiguous memory starting at data
+            /// @details Elements that would be overwritten by the same call are skipped, the rest are copied with a single
+            ///          memmove regardless of where the buffer wraps around. data may point into [data(), data() + size())
+            void append(const value_type* data, const size_type count) noexcept;
+
+            void swap(MirroredRingBuffer& other) noexcept;
+
+            /// @brief Pointer to the oldest element. All elements, in insertion order, are in range [data(), data() + size())
+            pointer data() noexcept;
+            /// @brief Pointer to the oldest element. All elements, in insertion order, are in range [data(), data() + size())
+            const_pointer data() const noexcept;
+
+            /// @brief View of all elements, oldest first
+            /// @details Same as array_one() of RingBuffer, except that it always holds all elements
+            Segment<value_type> array_one() noexcept;
+            /// @brief Read-only view of all elements, oldest first
+            Segment<const value_type> array_one() const noexcept;
+            /// @brief Always empty, provided so that code written for the two segments of RingBuffer works unchanged
+            Segment<value_type> array_two() noexcept;
+            /// @brief Always empty, provided so that code written for the two segments of RingBuffer works unchanged
+            Segment<const value_type> array_two() const noexcept;
+            /// @brief Read-only views of both segments (array_one() first)
+            std::pair<Segment<const value_type>, Segment<const value_type>> segments() const noexcept;
+
+            /// @brief Subscript operator
+            /// @details Indexing is done in insertion order, so the oldest element will be at position 0, the second oldest at position 1 etc.
+            ///          This operator performs out of range checks for pos only when SIMPLE_RING_BUFFER_DEBUG is defined
+            /// @return Reference to element at index pos.
+            reference operator[](const size_type& pos) noexcept;
+            /// @brief Subscript operator
+            /// @details Indexing is done in insertion order, so the oldest element will be at position 0, the second oldest at position 1 etc.
+            ///          This operator performs out of range checks for pos only when SIMPLE_RING_BUFFER_DEBUG is defined
+            const_reference operator[](const size_type& pos) const noexcept;
+            /// @brief Access element at specified position
+            /// @details Indexing is done in insertion order, so the oldest element will be at position 0, the second oldest at position 1 etc.
+            ///          Validity of pos is always checked
+            reference at(const size_type& pos);
+            /// @brief Access element at specified position
+            /// @details Indexing is done in insertion order, so the oldest element will be at position 0, the second oldest at position 1 etc.
+            ///          Validity of pos is always checked
+            const_reference at(const size_type& pos) const;
+
+            iterator begin() noexcept;
+            iterator end() noexcept;
+            const_iterator begin() const noexcept;
+            const_iterator end() const noexcept;
+            const_iterator cbegin() const noexcept;
+            const_iterator cend() const noexcept;
+
+        private:
+            /// @brief Smallest capacity not below requestedCapacity for which the storage is a whole number of pages
+            static size_type round_up_to_page_granularity(const size_type requestedCapacity);
+
+            /// @brief Create a shared memory object of mCapacity elements and map it twice, back to back, into mStorage
+            void map_storage();
+            void unmap_storage() noexcept;
+
+            pointer mStorage;
+            size_type mCapacity;
+            // storage index of the oldest element, always in range [0, mCapacity)
+            size_type mHead;
+            size_type mSize;
+    };
+} // namespace simpleContainers
+
+// ============================================================================================================================================
+// ============================================================== IMPLEMENTATION ==============================================================
+// ============================================================================================================================================
+
+namespace simpleContainers {
+    template <typename T>
+    inline MirroredRingBuffer<T>::MirroredRingBuffer(const size_type initialCapacity)
+        : mStorage{nullptr}, mCapacity{0}, mHead{0}, mSize{0}
+    {
+        SIMPLE_RING_BUFFER_ASSERT(initialCapacity != 0, "MirroredRingBuffer must not be constructed with initial capacity of 0");
+        mCapacity = round_up_to_page_granularity(initialCapacity);
+        map_storage();
+    }
+
+    template <typename T>
+    inline MirroredRingBuffer<T>::MirroredRingBuffer(const MirroredRingBuffer& other)
+        : mStorage{nullptr}, mCapacity{other.mCapacity}, mHead{0}, mSize{other.mSize}
+    {
+        // a moved-from buffer has no storage, and a mapping of 0 bytes cannot be made
+        if (mCapacity == 0) {
+            return;
+        }
+
+        map_storage();
+        if (mSize > 0) {
+            std::memcpy(mStorage, other.data(), mSize * sizeof(value_type));
+        }
+    }
+
+    template <typename T>
+    inline MirroredRingBuffer<T>::MirroredRingBuffer(MirroredRingBuffer&& other) noexcept
+        : mStorage{other.mStorage}, mCapacity{other.mCapacity}, mHead{other.mHead}, mSize{other.mSize}
+    {
+        other.mStorage = nullptr;
+        other.mCapacity = 0;
+        other.mHead = 0;
+        other.mSize = 0;
+    }
+
+    template <typename T>
+    inline MirroredRingBuffer<T>& MirroredRingBuffer<T>::operator=(const MirroredRingBuffer& rhs) {
+        if (this != &rhs) {
+            MirroredRingBuffer tmp{rhs};
+            swap(tmp);
+        }
+
+        return *this;
+    }
+
+    template <typename T>
+    inline MirroredRingBuffer<T>& MirroredRingBuffer<T>::operator=(MirroredRingBuffer&& rhs) noexcept {
+        if (this != &rhs) {
+            unmap_storage();
+            mStorage = rhs.mStorage;
+            mCapacity = rhs.mCapacity;
+            mHead = rhs.mHead;
+            mSize = rhs.mSize;
+
+            rhs.mStorage = nullptr;
+            rhs.mCapacity = 0;
+            rhs.mHead = 0;
+            rhs.mSize = 0;
+        }
+
+        return *this;
+    }
+
+    template <typename T>
+    inline MirroredRingBuffer<T>::~MirroredRingBuffer() noexcept {
+        unmap_storage();
+    }
+
+    template <typename T>
+    inline typename MirroredRingBuffer<T>::size_type MirroredRingBuffer<T>::capacity() const noexcept {
+        return mCapacity;
+    }
+
+    template <typename T>
+    inline typename MirroredRingBuffer<T>::size_type MirroredRingBuffer<T>::size() const noexcept {
+        return mSize;
+    }
+
+    template <typename T>
+    inline bool MirroredRingBuffer<T>::empty() const noexcept {
+        return mSize == 0;
+    }
+
+    template <typename T>
+    inline bool MirroredRingBuffer<T>::full() const noexcept {
+        return mSize == mCapacity;
+    }
+
+    template <typename T>
+    inline void MirroredRingBuffer<T>::clear() noexcept {
+        mHead = 0;
+        mSize = 0;
+    }
+
+    template <typename T>
+    inline std::vector<typename MirroredRingBuffer<T>::value_type> MirroredRingBuffer<T>::get_elements() const {
+        return std::vector<value_type>(begin(), end());
+    }
+
+    template <typename T>
+    inline void MirroredRingBuffer<T>::push_back(const value_type& elem) noexcept {
+        if (mSize == mCapacity) {   // most common case
+            mStorage[mHead] = elem;
+            ++mHead;
+            if (mHead == mCapacity) {
+                mHead = 0;
+            }
+        }
+        else { // only happens during the initial filling
+            // mHead + mSize may be past the end of the first mapping, the write then lands at the start of the storage
+            mStorage[mHead + mSize] = elem;
+            ++mSize;
+        }
+    }
+
+    template <typename T>
+    template <typename ...Args>
+    inline void MirroredRingBuffer<T>::emplace_back(Args&&... args) noexcept {
+        push_back(value_type{std::forward<Args>(args)...});
+    }
+
+    template <typename T>
+    inline void MirroredRingBuffer<T>::append(const value_type* data, const size_type count) noexcept {
+        size_type copyCount = count;
+        // only the last mCapacity elements would survive this call
+        if (copyCount > mCapacity) {
+            data += (copyCount - mCapacity);
+            copyCount = mCapacity;
+        }
+
+        if (copyCount == 0) {
+            return;
+        }
+
+        // the write starts inside the first mapping and is at most mCapacity long, so it never goes past the second one
+        size_type writeIndex = mHead + mSize;
+        if (writeIndex >= mCapacity) {
+            writeIndex -= mCapacity;
+        }
+        // data may point into [data(), data() + size()). A write that runs past the free room overwrites the oldest elements,
+        // which the source can reach through the other mapping: the same memory under a different address, an overlap
+        // memmove cannot see. If the write starts after the source in the first mapping, the source is read through the
+        // second mapping instead, then every element shared by both ranges also has a shared address and memmove orders it
+        const std::less<const value_type*> before;
+        value_type* const writePtr = mStorage + writeIndex;
+        if (!before(data, mStorage + mHead) && before(data, writePtr)) {
+            data += mCapacity;
+        }
+        std::memmove(writePtr, data, copyCount * sizeof(value_type));
+
+        const size_type newSize = mSize + copyCount;
+        if (newSize > mCapacity) {
+            mHead += newSize - mCapacity;
+            if (mHead >= mCapacity) {
+                mHead -= mCapacity;
+            }
+            mSize = mCapacity;
+        }
+        else {
+            mSize = newSize;
+        }
+    }
+
+    template <typename T>
+    inline void MirroredRingBuffer<T>::swap(MirroredRingBuffer& other) noexcept {
+        std::swap(mStorage, other.mStorage);
+        std::swap(mCapacity, other.mCapacity);
+        std::swap(mHead, other.mHead);
+        std::swap(mSize, other.mSize);
+    }
+
+    template <typename T>
+    inline typename MirroredRingBuffer<T>::pointer MirroredRingBuffer<T>::data() noexcept {
+        return mStorage + mHead;
+    }
+
+    template <typename T>
+    inline typename MirroredRingBuffer<T>::const_pointer MirroredRingBuffer<T>::data() const noexcept {
+        return mStorage + mHead;
+    }
+
+    template <typename T>
+    inline Segment<typename MirroredRingBuffer<T>::value_type> MirroredRingBuffer<T>::array_one() noexcept {
+        return Segment<value_type>{data(), mSize};
+    }
+
+    template <typename T>
+    inline Segment<const typename MirroredRingBuffer<T>::value_type> MirroredRingBuffer<T>::array_one() const noexcept {
+        return Segment<const value_type>{data(), mSize};
+    }
+
+    template <typename T>
+    inline Segment<typename MirroredRingBuffer<T>::value_type> MirroredRingBuffer<T>::array_two() noexcept {
+        return Segment<value_type>{data() + mSize, 0};
+    }
+
+    template <typename T>
+    inline Segment<const typename MirroredRingBuffer<T>::value_type> MirroredRingBuffer<T>::array_two() const noexcept {
+        return Segment<const value_type>{data() + mSize, 0};
+    }
+
+    template <typename T>
+    inline std::pair<Segment<const typename MirroredRingBuffer<T>::value_type>, Segment<const typename MirroredRingBuffer<T>::value_type>>
+    MirroredRingBuffer<T>::segments() const noexcept {
+        return std::make_pair(array_one(), array_two());
+    }
+
+    template <typename T>
+    inline typename MirroredRingBuffer<T>::reference MirroredRingBuffer<T>::operator[](const size_type& pos) noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(pos < mSize, "MirroredRingBuffer subscript operator out of range");
+        return mStorage[mHead + pos];
+    }
+
+    template <typename T>
+    inline typename MirroredRingBuffer<T>::const_reference MirroredRingBuffer<T>::operator[](const size_type& pos) const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(pos < mSize, "MirroredRingBuffer subscript operator out of range");
+        return mStorage[mHead + pos];
+    }
+
+    template <typename T>
+    inline typename MirroredRingBuffer<T>::reference MirroredRingBuffer<T>::at(const size_type& pos) {
+        if (pos >= mSize) {
+            throw std::out_of_range("MirroredRingBuffer::at position out of range");
+        }
+
+        return mStorage[mHead + pos];
+    }
+
+    template <typename T>
+    inline typename MirroredRingBuffer<T>::const_reference MirroredRingBuffer<T>::at(const size_type& pos) const {
+        if (pos >= mSize) {
+            throw std::out_of_range("MirroredRingBuffer::at position out of range");
+        }
+
+        return mStorage[mHead + pos];
+    }
+
+    template <typename T>
+    inline typename MirroredRingBuffer<T>::iterator MirroredRingBuffer<T>::begin() noexcept {
+        return data();
+    }
+
+    template <typename T>
+    inline typename MirroredRingBuffer<T>::iterator MirroredRingBuffer<T>::end() noexcept {
+        return data() + mSize;
+    }
+
+    template <typename T>
+    inline typename MirroredRingBuffer<T>::const_iterator MirroredRingBuffer<T>::begin() const noexcept {
+        return data();
+    }
+
+    template <typename T>
+    inline typename MirroredRingBuffer<T>::const_iterator MirroredRingBuffer<T>::end() const noexcept {
+        return data() + mSize;
+    }
+
+    template <typename T>
+    inline typename MirroredRingBuffer<T>::const_iterator MirroredRingBuffer<T>::cbegin() const noexcept {
+        return data();
+    }
+
+    template <typename T>
+    inline typename MirroredRingBuffer<T>::const_iterator MirroredRingBuffer<T>::cend() const noexcept {
+        return data() + mSize;
+    }
+
+    template <typename T>
+    inline typename MirroredRingBuffer<T>::size_type MirroredRingBuffer<T>::round_up_to_page_granularity(const size_type requestedCapacity) {
+        const long pageSizeResult = ::sysconf(_SC_PAGESIZE);
+        if (pageSizeResult <= 0) {
+            throw std::system_error(errno, std::generic_category(), "MirroredRingBuffer could not determine the page size");
+        }
+        const size_type pageSize = static_cast<size_type>(pageSizeResult);
+
+        // storage must be a whole number of pages and a whole number of elements, so its size is a multiple of both
+        size_type a = pageSize;
+        size_type b = sizeof(value_type);
+        while (b != 0) {
+            const size_type tmp = a % b;
+            a = b;
+            b = tmp;
+        }
+        const size_type granularityInBytes = pageSize / a * sizeof(value_type);
+        const size_type granularityInElements = granularityInBytes / sizeof(value_type);
+
+        return (requestedCapacity + granularityInElements - 1) / granularityInElements * granularityInElements;
+    }
+
+    template <typename T>
+    inline void MirroredRingBuffer<T>::map_storage() {
+        const size_type storageBytes = mCapacity * sizeof(value_type);
+
+#if defined(__linux__)
+        const int fd = ::memfd_create("simpleContainers-MirroredRingBuffer", 0);
+#else
+        // shm_open needs a name that is unique in the system, the object is unlinked right away so the name is never reused
+        static std::atomic<unsigned long> instanceCounter{0};
+        const std::string name = "/scmrb-" + std::to_string(::getpid()) + "-" + std::to_string(instanceCounter.fetch_add(1));
+        const int fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+        if (fd != -1) {
+            ::shm_unlink(name.c_str());
+        }
+#endif // #if defined(__linux__)
+
+        if (fd == -1) {
+            throw std::system_error(errno, std::generic_category(), "MirroredRingBuffer could not create a shared memory object");
+        }
+
+        if (::ftruncate(fd, static_cast<off_t>(storageBytes)) == -1) {
+            const int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "MirroredRingBuffer could not resize the shared memory object");
+        }
+
+        // reserve address space for both mappings first, so that they are guaranteed to be adjacent
+        void* reserved = ::mmap(nullptr, 2 * storageBytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (reserved == MAP_FAILED) {
+            const int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "MirroredRingBuffer could not reserve address space");
+        }
+
+        char* base = static_cast<char*>(reserved);
+        void* first = ::mmap(base, storageBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+        void* second = (first == MAP_FAILED) ? MAP_FAILED : ::mmap(base + storageBytes, storageBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+        const int error = errno;
+        // mappings keep the shared memory object alive on their own
+        ::close(fd);
+
+        if (second == MAP_FAILED) {
+            ::munmap(reserved, 2 * storageBytes);
+            throw std::system_error(error, std::generic_category(), "MirroredRingBuffer could not map the shared memory object");
+        }
+
+        mStorage = static_cast<pointer>(reserved);
+    }
+
+    template <typename T>
+    inline void MirroredRingBuffer<T>::unmap_storage() noexcept {
+        if (mStorage != nullptr) {
+            ::munmap(static_cast<void*>(mStorage), 2 * mCapacity * sizeof(value_type));
+            mStorage = nullptr;
+        }
+    }
+
+    template <typename T>
+    inline bool operator==(const MirroredRingBuffer<T>& lhs, const MirroredRingBuffer<T>& rhs) noexcept {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template <typename T>
+    inline bool operator!=(const MirroredRingBuffer<T>& lhs, const MirroredRingBuffer<T>& rhs) noexcept {
+        return !(lhs == rhs);
+    }
+
+    template <typename T>
+    inline bool operator<(const MirroredRingBuffer<T>& lhs, const MirroredRingBuffer<T>& rhs) noexcept {
+        return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <typename T>
+    inline bool operator<=(const MirroredRingBuffer<T>& lhs, const MirroredRingBuffer<T>& rhs) noexcept {
+        return !(rhs < lhs);
+    }
+
+    template <typename T>
+    inline bool operator>(const MirroredRingBuffer<T>& lhs, const MirroredRingBuffer<T>& rhs) noexcept {
+        return rhs < lhs;
+    }
+
+    template <typename T>
+    inline bool operator>=(const MirroredRingBuffer<T>& lhs, const MirroredRingBuffer<T>& rhs) noexcept {
+        return !(lhs < rhs);
+    }
+
+} // namespace simpleContainers
+
+#endif // #if SIMPLE_RING_BUFFER_HAS_MIRRORED_RING_BUFFER
+
+#endif // SIMPLE_MIRRORED_RING_BUFFER_HPP
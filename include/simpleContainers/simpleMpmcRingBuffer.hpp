@@ -0,0 +1,251 @@
+/// @file simpleMpmcRingBuffer.hpp
+/// @brief File containing API and implementaiton of MpmcRingBuffer class
+
+#ifndef SIMPLE_MPMC_RING_BUFFER_HPP
+#define SIMPLE_MPMC_RING_BUFFER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "simpleRingBuffer.hpp"
+
+// ============================================================================================================================================
+// =================================================================== API ====================================================================
+// ============================================================================================================================================
+
+namespace simpleContainers {
+    /// @brief Class representing a bounded multi-producer/multi-consumer ring buffer
+    /// @details Like SpscRingBuffer, MpmcRingBuffer never overwrites elements: insertion fails when the buffer is full and
+    ///          removal fails when it is empty. Any number of threads may insert and remove concurrently without a lock.
+    ///          Every slot carries a sequence number that tells producers and consumers whether the slot is ready for them,
+    ///          so the only contended writes are the compare-and-swap operations on the insertion and removal counters,
+    ///          which live on separate cache lines. Capacity is rounded up to the next power of two so that a counter can
+    ///          be turned into a slot index with a mask. The counters are only guaranteed to sit on their own cache lines
+    ///          when the MpmcRingBuffer itself is cache line aligned. Before C++17, operator new only guarantees
+    ///          alignof(std::max_align_t), so this does not hold for a heap allocated MpmcRingBuffer unless it is placed in
+    ///          suitably aligned storage.
+    /// @tparam T Type of object contained inside MpmcRingBuffer. T must be move constructible
+    /// @tparam Allocator Allocator for said type. It is rebound to allocate the slots (element storage plus sequence number)
+    ///         once on construction, and used as is to construct and destroy the elements
+    template <typename T, typename Allocator = std::allocator<T>>
+    class MpmcRingBuffer {
+        public:
+            using value_type = T;
+            using allocator_type = Allocator;
+            using reference = T&;
+            using const_reference = const T&;
+            using pointer = typename std::allocator_traits<allocator_type>::pointer;
+            using const_pointer = typename std::allocator_traits<allocator_type>::const_pointer;
+            using size_type = typename std::allocator_traits<allocator_type>::size_type;
+            using difference_type = typename std::allocator_traits<allocator_type>::difference_type;
+
+            SIMPLE_RING_BUFFER_STATIC_ASSERT((std::is_same<value_type, typename allocator_type::value_type>::value), "MpmcRingBuffer::value_type and MpmcRingBuffer::Allocator::value_type must be the same.");
+
+            /// @brief MpmcRingBuffer cannot be constructed with 0 capacity so this arbitrary value was chosen as a default
+            static constexpr size_type defaultInitialCapacity = 64;
+
+            /// @brief Construct a buffer that can hold at least initialCapacity elements
+            /// @details The actual capacity is initialCapacity rounded up to the next power of two, and at least 2:
+            ///          with a single slot the sequence number written by a consumer would equal the next producer's
+            ///          position plus one, so a later try_pop would wait for an element that never arrives
+            MpmcRingBuffer(const size_type initialCapacity = defaultInitialCapacity, const allocator_type& alloc = allocator_type{});
+
+            MpmcRingBuffer(const MpmcRingBuffer& other) = delete;
+            MpmcRingBuffer(MpmcRingBuffer&& other) = delete;
+
+            MpmcRingBuffer& operator=(const MpmcRingBuffer& rhs) = delete;
+            MpmcRingBuffer& operator=(MpmcRingBuffer&& rhs) = delete;
+
+            ~MpmcRingBuffer() noexcept;
+
+            allocator_type get_allocator() const noexcept;
+            size_type capacity() const noexcept;
+            /// @brief Approximate number of elements in the buffer
+            /// @details Exact only when no other thread is inserting or removing concurrently with the call
+            size_type size() const noexcept;
+            bool empty() const noexcept;
+
+            /// @brief Try to insert a copy of elem
+            /// @return true if the element was inserted, false if the buffer was full
+            bool try_push(const value_type& elem);
+            /// @brief Try to insert elem by moving it
+            /// @return true if the element was inserted, false if the buffer was full. elem is not moved from on failure
+            bool try_push(value_type&& elem);
+            /// @brief Try to construct an element in place from args
+            /// @return true if the element was constructed, false if the buffer was full. No object is constructed on failure
+            template <typename ...Args>
+            bool try_emplace(Args&&... args);
+
+            /// @brief Try to move the oldest available element into out and remove it
+            /// @return true if an element was removed, false if the buffer was empty
+            bool try_pop(value_type& out);
+
+        private:
+            struct Slot {
+                std::atomic<size_type> mSequence;
+                typename std::aligned_storage<sizeof(value_type), alignof(value_type)>::type mStorage;
+            };
+
+            using allocator_traits = std::allocator_traits<allocator_type>;
+            using slot_allocator_type = typename allocator_traits::template rebind_alloc<Slot>;
+            using slot_allocator_traits = std::allocator_traits<slot_allocator_type>;
+
+            static value_type* element_ptr(Slot& slot) noexcept;
+
+            allocator_type mAllocator;
+            slot_allocator_type mSlotAllocator;
+            size_type mCapacity;
+            size_type mIndexMask;
+            typename slot_allocator_traits::pointer mSlots;
+
+            alignas(SIMPLE_RING_BUFFER_CACHE_LINE_SIZE) std::atomic<size_type> mEnqueuePosition;
+            alignas(SIMPLE_RING_BUFFER_CACHE_LINE_SIZE) std::atomic<size_type> mDequeuePosition;
+    };
+} // namespace simpleContainers
+
+// ============================================================================================================================================
+// ============================================================== IMPLEMENTATION ==============================================================
+// ============================================================================================================================================
+
+namespace simpleContainers {
+    template <typename T, typename Allocator>
+    inline MpmcRingBuffer<T, Allocator>::MpmcRingBuffer(const size_type initialCapacity, const allocator_type& alloc)
+        : mAllocator{alloc}, mSlotAllocator{alloc}, mCapacity{detail::round_up_to_power_of_two(std::max<size_type>(initialCapacity, 2))}, mIndexMask{mCapacity - 1},
+          mSlots{nullptr}, mEnqueuePosition{0}, mDequeuePosition{0}
+    {
+        SIMPLE_RING_BUFFER_ASSERT(initialCapacity != 0, "MpmcRingBuffer must not be constructed with initial capacity of 0");
+        mSlots = slot_allocator_traits::allocate(mSlotAllocator, mCapacity);
+
+        // a slot is ready for the producer holding position p when its sequence equals p,
+        // and ready for the consumer holding position p when its sequence equals p + 1
+        for (size_type i = 0; i < mCapacity; ++i) {
+            slot_allocator_traits::construct(mSlotAllocator, &mSlots[i]);
+            mSlots[i].mSequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    template <typename T, typename Allocator>
+    inline MpmcRingBuffer<T, Allocator>::~MpmcRingBuffer() noexcept {
+        const size_type enqueuePosition = mEnqueuePosition.load(std::memory_order_relaxed);
+        for (size_type pos = mDequeuePosition.load(std::memory_order_relaxed); pos != enqueuePosition; ++pos) {
+            allocator_traits::destroy(mAllocator, element_ptr(mSlots[pos & mIndexMask]));
+        }
+
+        for (size_type i = 0; i < mCapacity; ++i) {
+            slot_allocator_traits::destroy(mSlotAllocator, &mSlots[i]);
+        }
+
+        slot_allocator_traits::deallocate(mSlotAllocator, mSlots, mCapacity);
+    }
+
+    template <typename T, typename Allocator>
+    inline typename MpmcRingBuffer<T, Allocator>::allocator_type MpmcRingBuffer<T, Allocator>::get_allocator() const noexcept {
+        return mAllocator;
+    }
+
+    template <typename T, typename Allocator>
+    inline typename MpmcRingBuffer<T, Allocator>::size_type MpmcRingBuffer<T, Allocator>::capacity() const noexcept {
+        return mCapacity;
+    }
+
+    template <typename T, typename Allocator>
+    inline typename MpmcRingBuffer<T, Allocator>::size_type MpmcRingBuffer<T, Allocator>::size() const noexcept {
+        const size_type dequeuePosition = mDequeuePosition.load(std::memory_order_acquire);
+        const size_type enqueuePosition = mEnqueuePosition.load(std::memory_order_acquire);
+
+        // the counters are read one after another, so a concurrent consumer may have overtaken the snapshot of the producer counter
+        const difference_type diff = static_cast<difference_type>(enqueuePosition - dequeuePosition);
+        if (diff < 0) {
+            return 0;
+        }
+
+        return std::min(static_cast<size_type>(diff), mCapacity);
+    }
+
+    template <typename T, typename Allocator>
+    inline bool MpmcRingBuffer<T, Allocator>::empty() const noexcept {
+        return size() == 0;
+    }
+
+    template <typename T, typename Allocator>
+    inline bool MpmcRingBuffer<T, Allocator>::try_push(const value_type& elem) {
+        return try_emplace(elem);
+    }
+
+    template <typename T, typename Allocator>
+    inline bool MpmcRingBuffer<T, Allocator>::try_push(value_type&& elem) {
+        return try_emplace(std::move(elem));
+    }
+
+    template <typename T, typename Allocator>
+    template <typename ...Args>
+    inline bool MpmcRingBuffer<T, Allocator>::try_emplace(Args&&... args) {
+        size_type pos = mEnqueuePosition.load(std::memory_order_relaxed);
+        Slot* slot = nullptr;
+
+        while (true) {
+            slot = &mSlots[pos & mIndexMask];
+            const size_type sequence = slot->mSequence.load(std::memory_order_acquire);
+            const difference_type diff = static_cast<difference_type>(sequence - pos);
+
+            if (diff == 0) {    // slot is free, try to claim it
+                if (mEnqueuePosition.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+                // on failure pos was reloaded by compare_exchange_weak
+            }
+            else if (diff < 0) {    // slot still holds the element from the previous lap, buffer is full
+                return false;
+            }
+            else {  // another producer claimed this position, catch up
+                pos = mEnqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        allocator_traits::construct(mAllocator, element_ptr(*slot), std::forward<Args>(args)...);
+        slot->mSequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename T, typename Allocator>
+    inline bool MpmcRingBuffer<T, Allocator>::try_pop(value_type& out) {
+        size_type pos = mDequeuePosition.load(std::memory_order_relaxed);
+        Slot* slot = nullptr;
+
+        while (true) {
+            slot = &mSlots[pos & mIndexMask];
+            const size_type sequence = slot->mSequence.load(std::memory_order_acquire);
+            const difference_type diff = static_cast<difference_type>(sequence - (pos + 1));
+
+            if (diff == 0) {    // slot holds a published element, try to claim it
+                if (mDequeuePosition.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            }
+            else if (diff < 0) {    // element for this position was not published yet, buffer is empty
+                return false;
+            }
+            else {  // another consumer claimed this position, catch up
+                pos = mDequeuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        value_type* elem = element_ptr(*slot);
+        out = std::move(*elem);
+        allocator_traits::destroy(mAllocator, elem);
+        // hand the slot to the producer that will reach it on the next lap
+        slot->mSequence.store(pos + mCapacity, std::memory_order_release);
+        return true;
+    }
+
+    template <typename T, typename Allocator>
+    inline typename MpmcRingBuffer<T, Allocator>::value_type* MpmcRingBuffer<T, Allocator>::element_ptr(Slot& slot) noexcept {
+        return reinterpret_cast<value_type*>(&slot.mStorage);
+    }
+
+} // namespace simpleContainers
+
+#endif // SIMPLE_MPMC_RING_BUFFER_HPP
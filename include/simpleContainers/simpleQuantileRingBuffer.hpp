@@ -0,0 +1,326 @@
+/// @file simpleQuantileRingBuffer.hpp
+/// @brief File containing API and implementaiton of QuantileRingBuffer class
+
+#ifndef SIMPLE_QUANTILE_RING_BUFFER_HPP
+#define SIMPLE_QUANTILE_RING_BUFFER_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "simpleRingBuffer.hpp"
+
+// ============================================================================================================================================
+// =================================================================== API ====================================================================
+// ============================================================================================================================================
+
+namespace simpleContainers {
+    /// @brief RingBuffer of unsigned integers that answers quantile queries over the elements it currently holds
+    /// @details Next to the elements, a log-linear histogram of them is kept: values below 2^PrecisionBits have a bucket
+    ///          each, larger values share buckets whose width is at most 2^(1 - PrecisionBits) of the values in them.
+    ///          Inserting an element increments its bucket and evicting one decrements it, both O(1).
+    ///          Buckets are grouped by the position of the highest set bit and a count per group is kept as well, so a
+    ///          quantile query visits at most (number of groups + buckets in one group) counters, independent of the
+    ///          window size, and never allocates.
+    ///          Reported quantiles are exact below 2^PrecisionBits, above that they are the middle of the bucket holding
+    ///          the exact quantile, so their relative error is at most max_relative_error().
+    ///          Histogram has bucket_count() counters, raising PrecisionBits by one halves the error and roughly doubles
+    ///          the memory. Elements can only be modified through QuantileRingBuffer, the underlying RingBuffer is available read-only
+    /// @tparam T Unsigned integer type of the elements, for example latencies in microseconds
+    /// @tparam PrecisionBits Number of significant bits kept by the histogram, must be at least 1 and less than the width of T
+    /// @tparam Allocator Allocator type of the underlying RingBuffer
+    /// @tparam CapacityPolicy Capacity policy of the underlying RingBuffer
+    template <typename T, unsigned PrecisionBits = 7, typename Allocator = std::allocator<T>, typename CapacityPolicy = ExactCapacity>
+    class QuantileRingBuffer {
+        public:
+            using ring_buffer_type = RingBuffer<T, Allocator, CapacityPolicy>;
+            using value_type = typename ring_buffer_type::value_type;
+            using const_reference = typename ring_buffer_type::const_reference;
+            using size_type = typename ring_buffer_type::size_type;
+            using allocator_type = typename ring_buffer_type::allocator_type;
+            using const_iterator = typename ring_buffer_type::const_iterator;
+
+            SIMPLE_RING_BUFFER_STATIC_ASSERT((std::is_integral<T>::value && std::is_unsigned<T>::value && !std::is_same<T, bool>::value),
+                "QuantileRingBuffer requires an unsigned integer element type.");
+            SIMPLE_RING_BUFFER_STATIC_ASSERT((PrecisionBits >= 1 && PrecisionBits < static_cast<unsigned>(std::numeric_limits<T>::digits)),
+                "QuantileRingBuffer PrecisionBits must be at least 1 and less than the width of the element type.");
+
+            /// @brief Number of buckets sharing the same highest set bit
+            static constexpr size_type bucketsPerGroup = size_type{1} << (PrecisionBits - 1);
+            /// @brief Number of bucket groups, the first two hold exact values below 2^PrecisionBits
+            static constexpr size_type groupCount = static_cast<size_type>(std::numeric_limits<T>::digits) - PrecisionBits + 2;
+
+            QuantileRingBuffer(const size_type initialCapacity = ring_buffer_type::defaultInitialCapacity, const allocator_type& alloc = allocator_type{});
+
+            size_type capacity() const noexcept;
+            size_type size() const noexcept;
+            bool empty() const noexcept;
+            bool full() const noexcept;
+            void clear() noexcept;
+
+            /// @brief Insert elem and add it to the histogram, evicting the oldest element if the buffer is full
+            void push_back(const value_type elem);
+            /// @brief Remove the oldest element. Buffer must not be empty.
+            ///        This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            void pop_front() noexcept;
+
+            /// @brief Approximate q-quantile of the window using the nearest rank definition: the smallest element such that
+            ///        at least q * size() elements are not larger than it
+            /// @details q must be in [0, 1] and the buffer must not be empty. This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            value_type quantile(const double q) const noexcept;
+            /// @brief Same as quantile(0.5)
+            value_type median() const noexcept;
+            /// @brief Number of elements in the window that fall into the same bucket as value or into a lower one
+            size_type count_up_to(const value_type value) const noexcept;
+
+            /// @brief Largest relative difference between a reported quantile and the exact one
+            static constexpr double max_relative_error() noexcept;
+            /// @brief Number of counters in the histogram (groups excluded)
+            static constexpr size_type bucket_count() noexcept;
+            /// @brief Memory used by the histogram, on top of the memory used by the elements
+            static constexpr size_type histogram_bytes() noexcept;
+
+            /// @brief Read-only access to the underlying RingBuffer, for example to use segment algorithms on it
+            const ring_buffer_type& elements() const noexcept;
+
+            const_reference front() const noexcept;
+            const_reference back() const noexcept;
+            const_reference operator[](const size_type& pos) const noexcept;
+            const_reference at(const size_type& pos) const;
+
+            const_iterator begin() const noexcept;
+            const_iterator end() const noexcept;
+            const_iterator cbegin() const noexcept;
+            const_iterator cend() const noexcept;
+
+        private:
+            static size_type bucket_of(const value_type value) noexcept;
+            /// @brief Value reported for elements in bucket, the middle of the values that fall into it
+            static value_type representative_of(const size_type bucket) noexcept;
+
+            void add_to_histogram(const value_type value) noexcept;
+            void remove_from_histogram(const value_type value) noexcept;
+
+        private:
+            ring_buffer_type mBuffer;
+            std::vector<size_type> mBucketCounts;
+            std::vector<size_type> mGroupCounts;
+    };
+} // namespace simpleContainers
+
+// ============================================================================================================================================
+// ============================================================== IMPLEMENTATION ==============================================================
+// ============================================================================================================================================
+
+namespace simpleContainers {
+    template <typename T, unsigned PrecisionBits, typename Allocator, typename CapacityPolicy>
+    constexpr typename QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::size_type QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::bucketsPerGroup;
+
+    template <typename T, unsigned PrecisionBits, typename Allocator, typename CapacityPolicy>
+    constexpr typename QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::size_type QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::groupCount;
+
+    template <typename T, unsigned PrecisionBits, typename Allocator, typename CapacityPolicy>
+    inline QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::QuantileRingBuffer(const size_type initialCapacity, const allocator_type& alloc)
+        :   mBuffer(initialCapacity, alloc),
+            mBucketCounts(bucket_count(), 0),
+            mGroupCounts(groupCount, 0)
+    {}
+
+    template <typename T, unsigned PrecisionBits, typename Allocator, typename CapacityPolicy>
+    inline typename QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::size_type QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::capacity() const noexcept {
+        return mBuffer.capacity();
+    }
+
+    template <typename T, unsigned PrecisionBits, typename Allocator, typename CapacityPolicy>
+    inline typename QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::size_type QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::size() const noexcept {
+        return mBuffer.size();
+    }
+
+    template <typename T, unsigned PrecisionBits, typename Allocator, typename CapacityPolicy>
+    inline bool QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::empty() const noexcept {
+        return mBuffer.empty();
+    }
+
+    template <typename T, unsigned PrecisionBits, typename Allocator, typename CapacityPolicy>
+    inline bool QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::full() const noexcept {
+        return mBuffer.full();
+    }
+
+    template <typename T, unsigned PrecisionBits, typename Allocator, typename CapacityPolicy>
+    inline void QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::clear() noexcept {
+        mBuffer.clear();
+        std::fill(mBucketCounts.begin(), mBucketCounts.end(), size_type{0});
+        std::fill(mGroupCounts.begin(), mGroupCounts.end(), size_type{0});
+    }
+
+    template <typename T, unsigned PrecisionBits, typename Allocator, typename CapacityPolicy>
+    inline void QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::push_back(const value_type elem) {
+        const bool evicts = mBuffer.full();
+        const value_type evicted = evicts ? mBuffer.front() : value_type{0};
+        mBuffer.push_back(elem);
+
+        if (evicts) {
+            remove_from_histogram(evicted);
+        }
+        add_to_histogram(elem);
+    }
+
+    template <typename T, unsigned PrecisionBits, typename Allocator, typename CapacityPolicy>
+    inline void QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::pop_front() noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(!mBuffer.empty(), "QuantileRingBuffer::pop_front called on an empty buffer");
+        remove_from_histogram(mBuffer.front());
+        mBuffer.pop_front();
+    }
+
+    template <typename T, unsigned PrecisionBits, typename Allocator, typename CapacityPolicy>
+    inline typename QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::value_type QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::quantile(const double q) const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(!mBuffer.empty(), "QuantileRingBuffer::quantile called on an empty buffer");
+        SIMPLE_RING_BUFFER_ASSERT(q >= 0.0 && q <= 1.0, "QuantileRingBuffer::quantile called with q outside of [0, 1]");
+
+        // 1-based rank of the wanted element in sorted order
+        const double exactRank = std::ceil(q * static_cast<double>(mBuffer.size()));
+        size_type rank = exactRank < 1.0 ? size_type{1} : static_cast<size_type>(exactRank);
+        rank = rank > mBuffer.size() ? mBuffer.size() : rank;
+
+        size_type group = 0;
+        while (rank > mGroupCounts[group]) {
+            rank -= mGroupCounts[group];
+            ++group;
+        }
+
+        size_type bucket = group * bucketsPerGroup;
+        while (rank > mBucketCounts[bucket]) {
+            rank -= mBucketCounts[bucket];
+            ++bucket;
+        }
+
+        return representative_of(bucket);
+    }
+
+    template <typename T, unsigned PrecisionBits, typename Allocator, typename CapacityPolicy>
+    inline typename QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::value_type QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::median() const noexcept {
+        return quantile(0.5);
+    }
+
+    template <typename T, unsigned PrecisionBits, typename Allocator, typename CapacityPolicy>
+    inline typename QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::size_type QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::count_up_to(const value_type value) const noexcept {
+        const size_type lastBucket = bucket_of(value);
+        const size_type lastGroup = lastBucket / bucketsPerGroup;
+
+        size_type result = 0;
+        for (size_type group = 0; group < lastGroup; ++group) {
+            result += mGroupCounts[group];
+        }
+        for (size_type bucket = lastGroup * bucketsPerGroup; bucket <= lastBucket; ++bucket) {
+            result += mBucketCounts[bucket];
+        }
+        return result;
+    }
+
+    template <typename T, unsigned PrecisionBits, typename Allocator, typename CapacityPolicy>
+    inline constexpr double QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::max_relative_error() noexcept {
+        // half of the widest relative bucket width
+        return 1.0 / static_cast<double>(size_type{1} << PrecisionBits);
+    }
+
+    template <typename T, unsigned PrecisionBits, typename Allocator, typename CapacityPolicy>
+    inline constexpr typename QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::size_type QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::bucket_count() noexcept {
+        return groupCount * bucketsPerGroup;
+    }
+
+    template <typename T, unsigned PrecisionBits, typename Allocator, typename CapacityPolicy>
+    inline constexpr typename QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::size_type QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::histogram_bytes() noexcept {
+        return (bucket_count() + groupCount) * sizeof(size_type);
+    }
+
+    template <typename T, unsigned PrecisionBits, typename Allocator, typename CapacityPolicy>
+    inline const typename QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::ring_buffer_type& QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::elements() const noexcept {
+        return mBuffer;
+    }
+
+    template <typename T, unsigned PrecisionBits, typename Allocator, typename CapacityPolicy>
+    inline typename QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::const_reference QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::front() const noexcept {
+        return mBuffer.front();
+    }
+
+    template <typename T, unsigned PrecisionBits, typename Allocator, typename CapacityPolicy>
+    inline typename QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::const_reference QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::back() const noexcept {
+        return mBuffer.back();
+    }
+
+    template <typename T, unsigned PrecisionBits, typename Allocator, typename CapacityPolicy>
+    inline typename QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::const_reference QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::operator[](const size_type& pos) const noexcept {
+        return mBuffer[pos];
+    }
+
+    template <typename T, unsigned PrecisionBits, typename Allocator, typename CapacityPolicy>
+    inline typename QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::const_reference QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::at(const size_type& pos) const {
+        return mBuffer.at(pos);
+    }
+
+    template <typename T, unsigned PrecisionBits, typename Allocator, typename CapacityPolicy>
+    inline typename QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::const_iterator QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::begin() const noexcept {
+        return mBuffer.begin();
+    }
+
+    template <typename T, unsigned PrecisionBits, typename Allocator, typename CapacityPolicy>
+    inline typename QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::const_iterator QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::end() const noexcept {
+        return mBuffer.end();
+    }
+
+    template <typename T, unsigned PrecisionBits, typename Allocator, typename CapacityPolicy>
+    inline typename QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::const_iterator QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::cbegin() const noexcept {
+        return mBuffer.cbegin();
+    }
+
+    template <typename T, unsigned PrecisionBits, typename Allocator, typename CapacityPolicy>
+    inline typename QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::const_iterator QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::cend() const noexcept {
+        return mBuffer.cend();
+    }
+
+    template <typename T, unsigned PrecisionBits, typename Allocator, typename CapacityPolicy>
+    inline typename QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::size_type QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::bucket_of(const value_type value) noexcept {
+        const std::uint64_t wideValue = static_cast<std::uint64_t>(value);
+        if (wideValue < (std::uint64_t{1} << PrecisionBits)) {
+            return static_cast<size_type>(wideValue);
+        }
+
+        // keep the PrecisionBits highest bits, the leading one selects the group and the rest the bucket in it
+        const unsigned shift = detail::highest_bit_index(wideValue) - (PrecisionBits - 1);
+        const size_type mantissa = static_cast<size_type>(wideValue >> shift);
+        return static_cast<size_type>(shift + 1) * bucketsPerGroup + (mantissa - bucketsPerGroup);
+    }
+
+    template <typename T, unsigned PrecisionBits, typename Allocator, typename CapacityPolicy>
+    inline typename QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::value_type QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::representative_of(const size_type bucket) noexcept {
+        if (bucket < 2 * bucketsPerGroup) {
+            return static_cast<value_type>(bucket);
+        }
+
+        const unsigned shift = static_cast<unsigned>(bucket / bucketsPerGroup - 1);
+        const std::uint64_t mantissa = static_cast<std::uint64_t>(bucket % bucketsPerGroup + bucketsPerGroup);
+        const std::uint64_t lowest = mantissa << shift;
+        return static_cast<value_type>(lowest + ((std::uint64_t{1} << shift) - 1) / 2);
+    }
+
+    template <typename T, unsigned PrecisionBits, typename Allocator, typename CapacityPolicy>
+    inline void QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::add_to_histogram(const value_type value) noexcept {
+        const size_type bucket = bucket_of(value);
+        ++mBucketCounts[bucket];
+        ++mGroupCounts[bucket / bucketsPerGroup];
+    }
+
+    template <typename T, unsigned PrecisionBits, typename Allocator, typename CapacityPolicy>
+    inline void QuantileRingBuffer<T, PrecisionBits, Allocator, CapacityPolicy>::remove_from_histogram(const value_type value) noexcept {
+        const size_type bucket = bucket_of(value);
+        --mBucketCounts[bucket];
+        --mGroupCounts[bucket / bucketsPerGroup];
+    }
+} // namespace simpleContainers
+
+#endif // SIMPLE_QUANTILE_RING_BUFFER_HPP
@@ -5,9 +5,22 @@
 #define SIMPLE_RING_BUFFER_HPP
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+#endif // #if defined(_MSC_VER) && !defined(__clang__)
+
 #ifndef SIMPLE_RING_BUFFER_DEBUG
     /// @brief Macro for debug checks
     /// @details This definition controls if some debug checks are made at compile and runtime. If the standard NDEBUG
@@ -42,46 +55,150 @@
     #define SIMPLE_RING_BUFFER_STATIC_ASSERT(cond, msg) ;
 #endif // #ifdef SIMPLE_RING_BUFFER_DEBUG
 
+#ifndef SIMPLE_RING_BUFFER_CACHE_LINE_SIZE
+    /// @brief Size of a cache line in bytes
+    /// @details Used by the concurrent ring buffers to keep indices written by different threads on separate cache lines.
+    ///          Users can define this before including any of the headers if the target platform uses a different value
+    #define SIMPLE_RING_BUFFER_CACHE_LINE_SIZE 64
+#endif // #ifndef SIMPLE_RING_BUFFER_CACHE_LINE_SIZE
+
 // ============================================================================================================================================
 // =================================================================== API ====================================================================
 // ============================================================================================================================================
 
 /// @brief Namespace containing all relevant classes and functions
 namespace simpleContainers {
-    template <typename T, typename Allocator>
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
     class RingBuffer;
 
-    template <typename T, typename Allocator>
-    inline bool operator==(const RingBuffer<T, Allocator>& lhs, const RingBuffer<T, Allocator>& rhs) noexcept;
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool operator==(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& lhs, const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rhs) noexcept;
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool operator!=(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& lhs, const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rhs) noexcept;
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool operator<(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& lhs, const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rhs) noexcept;
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool operator<=(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& lhs, const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rhs) noexcept;
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool operator>(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& lhs, const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rhs) noexcept;
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool operator>=(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& lhs, const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rhs) noexcept;
+
+    /// @brief Namespace containing implementation helpers shared between the containers
+    namespace detail {
+        /// @brief Smallest power of two that is greater than or equal to n (1 for n == 0)
+        inline std::size_t round_up_to_power_of_two(std::size_t n) noexcept;
+        /// @brief Index of the highest set bit of value, value must not be 0
+        inline unsigned highest_bit_index(const std::uint64_t value) noexcept;
+    } // namespace detail
+
+    /// @brief Capacity policy for RingBuffer that uses exactly the capacity requested by the user
+    /// @details Wrapping an index around the end of the storage is a compare and subtract
+    struct ExactCapacity {
+        static std::size_t adjust_capacity(const std::size_t requestedCapacity) noexcept;
+        /// @brief Map index in range [0, 2 * capacity) to range [0, capacity)
+        static std::size_t wrap_index(const std::size_t index, const std::size_t capacity) noexcept;
+    };
+
+    /// @brief Capacity policy for RingBuffer that rounds every requested capacity up to the next power of two
+    /// @details Wrapping an index around the end of the storage is a single bitwise and with capacity - 1, at the cost
+    ///          of up to twice the requested memory. The rounded capacity is what capacity() reports, so the buffer
+    ///          holds that many elements before it starts overwriting
+    struct PowerOfTwoCapacity {
+        static std::size_t adjust_capacity(const std::size_t requestedCapacity) noexcept;
+        /// @brief Map index in range [0, 2 * capacity) to range [0, capacity)
+        static std::size_t wrap_index(const std::size_t index, const std::size_t capacity) noexcept;
+    };
+
+    /// @brief Overflow policy for RingBuffer that makes room for a new element in a full RingBuffer by dropping the oldest one
+    /// @details This is the classic ring buffer behavior, RingBuffer always holds the most recently inserted elements
+    struct OverwriteOldest {
+        static constexpr bool overwritesOldest = true;
+        void on_rejected(const std::size_t rejectedCount) noexcept;
+    };
+
+    /// @brief Overflow policy for RingBuffer that leaves a full RingBuffer unchanged and drops the new element instead
+    /// @details Insertion into a full RingBuffer returns without constructing anything. Use try_push_back() or
+    ///          try_emplace_back() to find out if an element was inserted
+    struct RejectNew {
+        static constexpr bool overwritesOldest = false;
+        void on_rejected(const std::size_t rejectedCount) noexcept;
+    };
+
+    /// @brief Same as RejectNew, but the number of dropped elements is counted
+    /// @details The counter is read through RingBuffer::overflow_policy(). It is copied and swapped together with RingBuffer
+    struct CountRejectedNew {
+        static constexpr bool overwritesOldest = false;
+        void on_rejected(const std::size_t rejectedCount) noexcept;
+        /// @brief Number of elements dropped because RingBuffer was full since construction or the last reset
+        std::size_t rejected_count() const noexcept;
+        void reset_rejected_count() noexcept;
+
+    private:
+        std::size_t mRejectedCount = 0;
+    };
+
+    /// @brief Non-owning view of contiguous elements, described by a pointer to the first element and a number of elements
+    /// @details Returned by containers that expose their internal storage without copying. The view is invalidated by any
+    ///          operation that inserts, removes or reorders elements of the container it was taken from
+    /// @tparam T Type of the viewed elements. Use const T for a read-only view
+    template <typename T>
+    class Segment {
+        public:
+            using element_type = T;
+            using value_type = typename std::remove_cv<T>::type;
+            using size_type = std::size_t;
+            using pointer = T*;
+            using reference = T&;
+            using iterator = T*;
 
-    template <typename T, typename Allocator>
-    inline bool operator!=(const RingBuffer<T, Allocator>& lhs, const RingBuffer<T, Allocator>& rhs) noexcept;
+            Segment() noexcept;
+            Segment(pointer data, const size_type size) noexcept;
+            /// @brief Allow implicit conversion from a view of T to a view of const T
+            template <typename U, typename = typename std::enable_if<std::is_convertible<U(*)[], T(*)[]>::value>::type>
+            Segment(const Segment<U>& other) noexcept;
 
-    template <typename T, typename Allocator>
-    inline bool operator<(const RingBuffer<T, Allocator>& lhs, const RingBuffer<T, Allocator>& rhs) noexcept;
+            pointer data() const noexcept;
+            size_type size() const noexcept;
+            bool empty() const noexcept;
 
-    template <typename T, typename Allocator>
-    inline bool operator<=(const RingBuffer<T, Allocator>& lhs, const RingBuffer<T, Allocator>& rhs) noexcept;
+            iterator begin() const noexcept;
+            iterator end() const noexcept;
 
-    template <typename T, typename Allocator>
-    inline bool operator>(const RingBuffer<T, Allocator>& lhs, const RingBuffer<T, Allocator>& rhs) noexcept;
+            /// @brief This operator performs out of range checks for pos only when SIMPLE_RING_BUFFER_DEBUG is defined
+            reference operator[](const size_type pos) const noexcept;
 
-    template <typename T, typename Allocator>
-    inline bool operator>=(const RingBuffer<T, Allocator>& lhs, const RingBuffer<T, Allocator>& rhs) noexcept;
+        private:
+            pointer mData;
+            size_type mSize;
+    };
 
     /// @brief Class representing a ring buffer structure
     /// @details This is the main class the user should interact with. RingBuffer of capacity N will
     ///          hold at most the last N inserted elements. Every insertion after the N-th will cause the oldest element to
-    ///          be dropped. Internally, it is implemented as an adaptor of std::vector. Most of the member functions
-    ///          are similar to a std::vector and have the same behavior and time complexity unless otherwise specified
+    ///          be dropped. Internally, elements live in a single allocation of capacity slots, tracked by the index of the
+    ///          oldest element and the number of elements. Most of the member functions are similar to a std::vector and
+    ///          have the same behavior and time complexity unless otherwise specified
     ///          Since the size of the ring buffer is the same as it's capacity in the expected use cases,
     ///          most of the operations are optimized for this case when possible.
     ///          A strict weak ordering can be established between instances of RingBuffer, behavior is the same as std::vector
-    /// @tparam T Type of object contained inside RingBuffer. T must satisfy the same requirements as
-    ///         if it was inserted into a std::vector
-    /// @tparam Allocator Allocator for said type. RingBuffer itself does not do any of the allocator calls.
-    ///         Those are done in the underlying std::vector which will use this allocator
-    template <typename T, typename Allocator = std::allocator<T>>
+    /// @tparam T Type of object contained inside RingBuffer. Inserting single elements only requires T to be constructible
+    ///         from the arguments, overwriting does not assign. Bulk insertion, erase(), linearize() and change_capacity()
+    ///         additionally require T to be assignable, the same as they would for a std::vector. RingBuffer<bool> is a
+    ///         bit-packed specialization, see simpleRingBufferBool.hpp
+    /// @tparam Allocator Allocator for said type. Storage is allocated, and elements are constructed and destroyed, through
+    ///         std::allocator_traits of this allocator
+    /// @tparam CapacityPolicy Controls how the requested capacity is adjusted and how indices are wrapped around the end of
+    ///         the storage. ExactCapacity (default) or PowerOfTwoCapacity
+    /// @tparam OverflowPolicy Controls what happens when an element is inserted into a full RingBuffer. OverwriteOldest
+    ///         (default), RejectNew or CountRejectedNew. The choice is made at compile time, so the insertion hot path only
+    ///         contains the branch of the selected policy
+    template <typename T, typename Allocator = std::allocator<T>, typename CapacityPolicy = ExactCapacity, typename OverflowPolicy = OverwriteOldest>
     class RingBuffer {
         public:
             using value_type = T;
@@ -93,12 +210,14 @@ namespace simpleContainers {
             using size_type = typename std::allocator_traits<allocator_type>::size_type;
             using difference_type = typename std::allocator_traits<allocator_type>::difference_type;
 
-            SIMPLE_RING_BUFFER_STATIC_ASSERT((!std::is_same<value_type, bool>::value), "RingBuffer<bool> currently not supported.");
             SIMPLE_RING_BUFFER_STATIC_ASSERT((std::is_same<value_type, typename allocator_type::value_type>::value), "RingBuffer::value_type and RingBuffer::Allocator::value_type must be the same.");
 
             /// @brief Class representing iterators over RingBuffer
             /// @details RingBugffer iterators are compliant with the LegacyRandomAccessIterator named requirement.
-            ///          All methods are O(1) time complexity
+            ///          All methods are O(1) time complexity. The iterator points directly at the element in the storage, so
+            ///          dereferencing is a plain pointer dereference and incrementing is a pointer increment followed by a
+            ///          single check for the end of the storage. Like std::vector iterators, they are invalidated when
+            ///          RingBuffer reallocates its storage, as well as by insertions and removals
             /// @tparam constTag Compile time indicator if iterator is a const iterator or not
             template <bool constTag = false>
             class RingBufferIterator {
@@ -107,13 +226,14 @@ namespace simpleContainers {
                     friend class RingBufferIterator<true>;
 
                     using iterator_category = std::random_access_iterator_tag;
-                    using size_type = typename RingBuffer<T, Allocator>::size_type;
-                    using difference_type = typename RingBuffer<T, Allocator>::difference_type;
-                    using value_type = typename RingBuffer<T, Allocator>::value_type;
-                    using pointer = typename std::conditional<constTag, typename RingBuffer<T, Allocator>::const_pointer, typename RingBuffer<T, Allocator>::pointer>::type;
-                    using reference = typename std::conditional<constTag, typename RingBuffer<T, Allocator>::const_reference, typename RingBuffer<T, Allocator>::reference>::type;
-                    using ring_buffer_ptr = typename std::conditional<constTag, const RingBuffer<T, Allocator>*, RingBuffer<T, Allocator>*>::type;
-
+                    using size_type = typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::size_type;
+                    using difference_type = typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::difference_type;
+                    using value_type = typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::value_type;
+                    using pointer = typename std::conditional<constTag, typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::const_pointer, typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::pointer>::type;
+                    using reference = typename std::conditional<constTag, typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::const_reference, typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::reference>::type;
+                    using ring_buffer_ptr = typename std::conditional<constTag, const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>*, RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>*>::type;
+
+                    /// @brief Construct iterator to the element at position pos (in insertion order) of rb
                     RingBufferIterator(size_type pos = 0, ring_buffer_ptr rb = nullptr) noexcept;
                     RingBufferIterator(const RingBufferIterator& other) noexcept = default;
                     /// @brief Converting constructor to create a const iterator from a non-const iterator
@@ -149,40 +269,43 @@ namespace simpleContainers {
                     difference_type operator-(const RingBufferIterator& other) const noexcept; // Subtraction between two iterators
 
                     friend bool operator==(const RingBufferIterator& lhs, const RingBufferIterator& rhs) noexcept {
-                        SIMPLE_RING_BUFFER_ASSERT(lhs.mRingBufPtr == rhs.mRingBufPtr, "RingBufferIterator == comparison must be done on iterators of the same RingBuffer");
+                        SIMPLE_RING_BUFFER_ASSERT(lhs.mStorageBegin == rhs.mStorageBegin, "RingBufferIterator == comparison must be done on iterators of the same RingBuffer");
                         return lhs.mPosition == rhs.mPosition;
                     }
 
                     friend bool operator!=(const RingBufferIterator& lhs, const RingBufferIterator& rhs) noexcept {
-                        SIMPLE_RING_BUFFER_ASSERT(lhs.mRingBufPtr == rhs.mRingBufPtr, "RingBufferIterator != comparison must be done on iterators of the same RingBuffer");
+                        SIMPLE_RING_BUFFER_ASSERT(lhs.mStorageBegin == rhs.mStorageBegin, "RingBufferIterator != comparison must be done on iterators of the same RingBuffer");
                         return lhs.mPosition != rhs.mPosition;
                     }
 
                     friend bool operator<(const RingBufferIterator& lhs, const RingBufferIterator& rhs) noexcept {
-                        SIMPLE_RING_BUFFER_ASSERT(lhs.mRingBufPtr == rhs.mRingBufPtr, "RingBufferIterator < comparison must be done on iterators of the same RingBuffer");
+                        SIMPLE_RING_BUFFER_ASSERT(lhs.mStorageBegin == rhs.mStorageBegin, "RingBufferIterator < comparison must be done on iterators of the same RingBuffer");
                         return lhs.mPosition < rhs.mPosition;
                     }
 
                     friend bool operator<=(const RingBufferIterator& lhs, const RingBufferIterator& rhs) noexcept {
-                        SIMPLE_RING_BUFFER_ASSERT(lhs.mRingBufPtr == rhs.mRingBufPtr, "RingBufferIterator <= comparison must be done on iterators of the same RingBuffer");
+                        SIMPLE_RING_BUFFER_ASSERT(lhs.mStorageBegin == rhs.mStorageBegin, "RingBufferIterator <= comparison must be done on iterators of the same RingBuffer");
                         return lhs.mPosition <= rhs.mPosition;
                     }
 
                     friend bool operator>(const RingBufferIterator& lhs, const RingBufferIterator& rhs) noexcept {
-                        SIMPLE_RING_BUFFER_ASSERT(lhs.mRingBufPtr == rhs.mRingBufPtr, "RingBufferIterator > comparison must be done on iterators of the same RingBuffer");
+                        SIMPLE_RING_BUFFER_ASSERT(lhs.mStorageBegin == rhs.mStorageBegin, "RingBufferIterator > comparison must be done on iterators of the same RingBuffer");
                         return lhs.mPosition > rhs.mPosition;
                     }
 
                     friend bool operator>=(const RingBufferIterator& lhs, const RingBufferIterator& rhs) noexcept {
-                        SIMPLE_RING_BUFFER_ASSERT(lhs.mRingBufPtr == rhs.mRingBufPtr, "RingBufferIterator >= comparison must be done on iterators of the same RingBuffer");
+                        SIMPLE_RING_BUFFER_ASSERT(lhs.mStorageBegin == rhs.mStorageBegin, "RingBufferIterator >= comparison must be done on iterators of the same RingBuffer");
                         return lhs.mPosition >= rhs.mPosition;
                     }
 
                 private:
-                    // mPosition represents the element in order from oldest to newest inserted, it is not the actual
-                    // pointer offset position from beginning of vector
+                    // mElement is the pointer to the element in the storage, wrapped around [mStorageBegin, mStorageEnd).
+                    // mPosition represents the element in order from oldest to newest inserted, it is only used to compare
+                    // iterators, since mElement of the end iterator of a full RingBuffer is the same as mElement of begin
+                    pointer mElement;
                     size_type mPosition;
-                    ring_buffer_ptr mRingBufPtr;
+                    pointer mStorageBegin;
+                    pointer mStorageEnd;
             };
 
             using iterator = RingBufferIterator<false>;
@@ -199,23 +322,36 @@ namespace simpleContainers {
             template <typename Iterator>
             RingBuffer(Iterator itStart, Iterator itEnd, const allocator_type& alloc = allocator_type{});
 
-            RingBuffer(const RingBuffer& other) = default;
-            RingBuffer(RingBuffer&& other) noexcept = default;
+            RingBuffer(const RingBuffer& other);
+            RingBuffer(RingBuffer&& other) noexcept;
 
-            RingBuffer& operator=(const RingBuffer& rhs) = default;
-            RingBuffer& operator=(RingBuffer&& rhs) noexcept = default;
+            /// @brief Copy elements of rhs. The allocator of rhs is taken only if the allocator propagates on copy assignment
+            RingBuffer& operator=(const RingBuffer& rhs);
+            /// @brief Take over the storage of rhs if the allocator propagates on move assignment or both allocators are equal.
+            ///        Otherwise elements are moved one by one into storage obtained from this RingBuffer's allocator
+            RingBuffer& operator=(RingBuffer&& rhs) noexcept(std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value);
 
-            ~RingBuffer() noexcept = default;
+            ~RingBuffer() noexcept;
 
             allocator_type get_allocator() const noexcept;
+            /// @brief Access the overflow policy object, for example to read CountRejectedNew::rejected_count()
+            const OverflowPolicy& overflow_policy() const noexcept;
+            /// @brief Access the overflow policy object, for example to call CountRejectedNew::reset_rejected_count()
+            OverflowPolicy& overflow_policy() noexcept;
             size_type capacity() const noexcept;
             /// @brief Change capacity of the current RingBuffer
-            /// @details If the new capacity is lower than the current one, then only the newest
-            ///          currentCapacity - newCapacity elements will be kept. If new capacity is greater, all elements
-            ///          are kept and no elements are dropped for the next newCapacity - currentCapacity insertions.
-            ///          In both cases this is a O(n) operation since internally a new vector containing the appropriate elements
-            ///          is created and swapped with the current internal vector.
-            void change_capacity(const size_type newCapacity) noexcept;
+            /// @details If the new capacity is lower than the current size, then only the newest newCapacity elements will be kept.
+            ///          If new capacity is greater, all elements are kept and no elements are dropped for the next
+            ///          newCapacity - currentCapacity insertions.
+            ///          When shrinking, or when growing and the internal storage already has room for newCapacity elements, no
+            ///          allocation is made: the oldest elements that no longer fit are destroyed and the rest are rotated in place
+            ///          if the buffer has wrapped around. Memory is kept for later growth, use shrink_to_fit() to release it.
+            ///          The rotation is done with linearize(), so T must be move assignable.
+            ///          Otherwise new storage is allocated and the elements are moved into it (copied if T's move constructor
+            ///          may throw). All cases are O(n).
+            void change_capacity(const size_type newCapacity);
+            /// @brief Release memory held by the internal storage beyond what the current capacity needs
+            void shrink_to_fit();
             size_type size() const noexcept;
             size_type max_size() const noexcept;
             bool empty() const noexcept;
@@ -223,21 +359,140 @@ namespace simpleContainers {
             void clear() noexcept;
 
             /// @brief Get elements in RingBuffer in order they were inserted (oldest first)
+            /// @details This allocates and copies every element. Use array_one() and array_two() to read the elements in place
             std::vector<value_type> get_elements() const noexcept;
 
+            /// @brief View of the oldest elements, as they are stored internally
+            /// @details The elements in RingBuffer, oldest first, are exactly the elements of array_one() followed by the elements
+            ///          of array_two(). array_one() is only empty when the whole RingBuffer is empty. No elements are copied
+            Segment<value_type> array_one() noexcept;
+            /// @brief Read-only view of the oldest elements, as they are stored internally
+            Segment<const value_type> array_one() const noexcept;
+            /// @brief View of the newest elements that were wrapped around to the start of the internal storage
+            /// @details Empty while RingBuffer has not wrapped around
+            Segment<value_type> array_two() noexcept;
+            /// @brief Read-only view of the newest elements that were wrapped around to the start of the internal storage
+            Segment<const value_type> array_two() const noexcept;
+            /// @brief Read-only views of both segments (array_one() first), meant for handing the contents to serializers or
+            ///        other code that consumes contiguous memory
+            std::pair<Segment<const value_type>, Segment<const value_type>> segments() const noexcept;
+            /// @brief Read-only views of the elements at positions [pos, pos + count) in insertion order, split at the end of
+            ///        the internal storage the same way as segments(). The second view is empty if the range does not wrap around
+            /// @details pos + count must not be greater than size(). This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            std::pair<Segment<const value_type>, Segment<const value_type>> segments(const size_type pos, const size_type count) const noexcept;
+
+            /// @brief Rearrange internal storage in place so that the oldest element is at the start of it
+            /// @details O(n) rotation of the internal storage if RingBuffer has wrapped around, O(n) shift of the elements if
+            ///          the oldest one is not at the start of the storage, otherwise nothing is done.
+            ///          After this call, all elements are contiguous in insertion order until the next insertion
+            ///          overwrites an element
+            /// @return Pointer to the oldest element, same as data()
+            pointer linearize();
+            /// @brief Check if elements are stored contiguously in insertion order, meaning that linearize() would do nothing
+            bool is_linearized() const noexcept;
+            /// @brief Pointer to the start of the internal storage
+            /// @details Elements in range [data(), data() + size()) are in insertion order only if is_linearized() is true
+            pointer data() noexcept;
+            /// @brief Pointer to the start of the internal storage
+            /// @details Elements in range [data(), data() + size()) are in insertion order only if is_linearized() is true
+            const_pointer data() const noexcept;
+
+            /// @brief Insert elem as the newest element
+            /// @details If RingBuffer is full, what happens depends on OverflowPolicy. With OverwriteOldest, the oldest element
+            ///          is destroyed and elem is copy constructed in its slot, so T does not need to be assignable. elem may be an
+            ///          element of this RingBuffer. With RejectNew and CountRejectedNew, elem is dropped
             void push_back(const value_type& elem);
+            /// @brief Same as above, but elem is move constructed
             void push_back(value_type&& elem);
+            /// @brief Construct the newest element in place from args
+            /// @details If RingBuffer is full and OverflowPolicy overwrites, the new element is first constructed as a temporary,
+            ///          since args may refer to the oldest element, then the oldest element is destroyed and the temporary is
+            ///          moved into its slot, so T must be move constructible. If constructing the temporary throws, nothing is
+            ///          changed. If the move constructor throws, the oldest element stays removed. If OverflowPolicy rejects,
+            ///          nothing is constructed
             template <typename ...Args>
             void emplace_back(Args&&... args);
+            /// @brief Insert elem only if RingBuffer is not full, regardless of OverflowPolicy
+            /// @details A rejected element is reported to OverflowPolicy, so it is counted by CountRejectedNew
+            /// @return true if elem was inserted
+            bool try_push_back(const value_type& elem);
+            /// @brief Same as above, but elem is move constructed. elem is left untouched if it was not inserted
+            bool try_push_back(value_type&& elem);
+            /// @brief Construct the newest element in place from args only if RingBuffer is not full, regardless of OverflowPolicy
+            /// @details Fullness is checked before anything is constructed, so a rejected element costs nothing
+            /// @return true if an element was constructed
+            template <typename ...Args>
+            bool try_emplace_back(Args&&... args);
+            /// @brief Make the oldest element the newest one without destroying it, and return a reference to it
+            /// @details Meant for element types that own resources (strings, vectors...) which the caller can refill in place,
+            ///          keeping their already allocated memory, so a full RingBuffer is overwritten without any allocation.
+            ///          The oldest element is evicted regardless of OverflowPolicy, since that is the point of calling this.
+            ///          The returned element still holds the old value. If RingBuffer is not full, nothing is evicted and a
+            ///          value initialized element is constructed as the newest one instead, so T must be default constructible
+            /// @return Reference to the newest element, same as (*this)[size() - 1]
+            reference recycle_back();
+            /// @brief Same as recycle_back(), but the element is handed to fill before it becomes the newest one
+            /// @details fill is called as fill(value_type&). If it throws, the oldest element is left in place, but its value
+            ///          may have been changed by fill. A value initialized element constructed because RingBuffer was not full
+            ///          is removed again
+            template <typename F>
+            void push_back_reuse(F&& fill);
+            /// @brief Insert all elements in iterator range [first, last), as if push_back was called for each of them
+            /// @details For forward iterators, elements that would be overwritten by the same call are skipped, and the rest are
+            ///          copied in at most two contiguous segments, so the size check and index wrap are done once per call.
+            ///          If OverflowPolicy rejects, only the elements that fit into the free slots are inserted.
+            ///          When the range is given with pointers to a trivially copyable T, the segments are copied with memmove,
+            ///          so the range may point into this RingBuffer's own storage.
+            ///          Input iterators can only be read once, so they fall back to one push_back per element
+            template <typename Iterator>
+            void push_back(Iterator first, Iterator last);
+            /// @brief Insert count elements from contiguous memory starting at data
+            /// @details Same as push_back(data, data + count)
+            void append(const value_type* data, const size_type count);
 
+            /// @brief Swap contents with other. Allocators are swapped only if they propagate on swap, otherwise they must be
+            ///        equal. This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
             void swap(RingBuffer& other) noexcept;
 
             /// @brief Erase element at given iterator
+            /// @details Elements on the shorter side of the erased element are shifted to close the gap, so erasing near
+            ///          either end is cheap. Same as erase(it, it + 1)
             /// @return Iterator to element that comes aftr the erased element (or end iterator if erased element was the last one)
             iterator erase(const_iterator it) noexcept;
             /// @brief Erase elements in iterator range [first, last)
+            /// @details Like std::deque, only the elements before first or the elements after last are moved, whichever
+            ///          group is smaller, so erasing k elements at position p is O(k + min(p, size() - p - k))
             /// @return Iterator to element that comes aftr the last erased element (or end iterator if no elements exist after last)
             iterator erase(const_iterator first, const_iterator last) noexcept;
+            /// @brief Remove the oldest element. O(1)
+            /// @details RingBuffer must not be empty. This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            void pop_front() noexcept;
+            /// @brief Remove the n oldest elements
+            /// @details O(1) for trivially destructible T with std::allocator, otherwise O(n) destructor calls. n must not be greater than size().
+            ///          This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            void pop_front(const size_type n) noexcept;
+            /// @brief Remove the newest element. O(1)
+            /// @details RingBuffer must not be empty. This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            void pop_back() noexcept;
+            /// @brief Move up to n oldest elements, oldest first, to out and remove them from RingBuffer
+            /// @details Elements are moved as at most two contiguous ranges (see array_one() and array_two()), so for pointers
+            ///          to trivially copyable T this is at most two memmove calls. Meant for draining RingBuffer used as a queue
+            /// @return Number of elements that were moved out, min(n, size())
+            template <typename OutputIt>
+            size_type pop_n(OutputIt out, const size_type n);
+
+            /// @brief Access the oldest element
+            /// @details RingBuffer must not be empty. This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            reference front() noexcept;
+            /// @brief Access the oldest element
+            /// @details RingBuffer must not be empty. This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            const_reference front() const noexcept;
+            /// @brief Access the newest element
+            /// @details RingBuffer must not be empty. This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            reference back() noexcept;
+            /// @brief Access the newest element
+            /// @details RingBuffer must not be empty. This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            const_reference back() const noexcept;
 
             /// @brief Subscript operator
             /// @details Indexing is done in insertion order, so the oldest element will be at position 0, the second oldest at position 1 etc.
@@ -264,18 +519,133 @@ namespace simpleContainers {
             const_iterator cbegin() const noexcept;
             const_iterator cend() const noexcept;
 
-            friend bool operator== <>(const RingBuffer<T, Allocator>& lhs, const RingBuffer<T, Allocator>& rhs) noexcept;
-            friend bool operator!= <>(const RingBuffer<T, Allocator>& lhs, const RingBuffer<T, Allocator>& rhs) noexcept;
-            friend bool operator< <>(const RingBuffer<T, Allocator>& lhs, const RingBuffer<T, Allocator>& rhs) noexcept;
-            friend bool operator<= <>(const RingBuffer<T, Allocator>& lhs, const RingBuffer<T, Allocator>& rhs) noexcept;
-            friend bool operator> <>(const RingBuffer<T, Allocator>& lhs, const RingBuffer<T, Allocator>& rhs) noexcept;
-            friend bool operator>= <>(const RingBuffer<T, Allocator>& lhs, const RingBuffer<T, Allocator>& rhs) noexcept;
+            friend bool operator== <>(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& lhs, const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rhs) noexcept;
+            friend bool operator!= <>(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& lhs, const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rhs) noexcept;
+            friend bool operator< <>(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& lhs, const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rhs) noexcept;
+            friend bool operator<= <>(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& lhs, const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rhs) noexcept;
+            friend bool operator> <>(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& lhs, const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rhs) noexcept;
+            friend bool operator>= <>(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& lhs, const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rhs) noexcept;
 
         private:
-            std::vector<value_type, allocator_type> mBuffer;
+            using allocator_traits = std::allocator_traits<allocator_type>;
+
+            size_type to_storage_index(const size_type pos) const noexcept;
+            void allocate_storage(const size_type storageCapacity);
+            void deallocate_storage() noexcept;
+            /// @brief Move elements, oldest first, to the start of a new allocation of newCapacity slots, which becomes
+            ///        both the storage capacity and the capacity of RingBuffer
+            void reallocate_storage(const size_type newCapacity);
+            /// @brief Swap everything except the allocators with other
+            void swap_contents(RingBuffer& other) noexcept;
+            /// @brief Swap the allocators with other, used when the allocator propagates on the operation being done
+            void swap_allocators(RingBuffer& other, std::true_type) noexcept;
+            /// @brief Same as above, but the allocator does not propagate, so nothing is done
+            void swap_allocators(RingBuffer& other, std::false_type) noexcept;
+            /// @brief Move assignment when the allocator propagates, storage of rhs is always taken over
+            void move_assign(RingBuffer& rhs, std::true_type) noexcept;
+            /// @brief Move assignment when the allocator does not propagate, storage of rhs is taken over only if allocators are equal
+            void move_assign(RingBuffer& rhs, std::false_type);
+            /// @brief Construct a new newest element in the first unused slot. RingBuffer must not be full
+            template <typename ...Args>
+            void construct_back(Args&&... args);
+            /// @brief Destroy the oldest element and construct the new newest element in its slot. RingBuffer must be full
+            template <typename ...Args>
+            void overwrite_front(Args&&... args);
+            /// @brief Destroy the n oldest elements, without changing mOldestElementIndex and mSize
+            void destroy_front(const size_type n, std::false_type) noexcept;
+            /// @brief Same as above, but for trivially destructible types and std::allocator where nothing needs to be done
+            void destroy_front(const size_type n, std::true_type) noexcept;
+
+            template <typename Iterator>
+            void push_back_range(Iterator first, Iterator last, std::input_iterator_tag);
+            template <typename Iterator>
+            void push_back_range(Iterator first, Iterator last, std::forward_iterator_tag);
+            /// @brief Assign count elements starting at first to mStorage[storageIndex], mStorage[storageIndex + 1], ...
+            /// @return Iterator past the last copied element
+            template <typename Iterator>
+            Iterator copy_to_storage(Iterator first, const size_type count, const size_type storageIndex, std::false_type);
+            /// @brief Same as above, but for pointers to trivially copyable types where the whole segment can be copied with memmove
+            template <typename Iterator>
+            Iterator copy_to_storage(Iterator first, const size_type count, const size_type storageIndex, std::true_type);
+
+            allocator_type mAllocator;
+            pointer mStorage;
+            // number of slots in mStorage, can be greater than mCurrentCapacity after the capacity was reduced
+            size_type mStorageCapacity;
             size_type mCurrentCapacity;
-            size_type mNewestElementInsertionIndex;
+            // index in mStorage of the oldest element. When the buffer is full, it is also the index where the next element
+            // is inserted. Slots at indices [mOldestElementIndex, mOldestElementIndex + mSize) (wrapped around mCurrentCapacity)
+            // hold constructed elements, all other slots are unconstructed memory
+            size_type mOldestElementIndex;
+            size_type mSize;
+            OverflowPolicy mOverflowPolicy;
     };
+    // Segment-aware algorithms. Each of them works on the two contiguous parts of RingBuffer (see RingBuffer::array_one() and
+    // RingBuffer::array_two()) with plain pointers, instead of going through RingBuffer iterators, so the compiler can
+    // vectorize the loops the same way it would for a std::vector
+
+    /// @brief Call f once for every non-empty contiguous part of rb, oldest part first
+    /// @details f is called as f(Segment<T>), at most twice
+    /// @return f, like std::for_each
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy, typename F>
+    F for_each_segment(RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rb, F f);
+    /// @brief Same as above, f is called as f(Segment<const T>)
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy, typename F>
+    F for_each_segment(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rb, F f);
+
+    /// @brief Copy elements of rb, oldest first, to out. Same as std::copy(rb.begin(), rb.end(), out)
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy, typename OutputIt>
+    OutputIt copy(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rb, OutputIt out);
+    /// @brief Assign value to every element of rb. Same as std::fill(rb.begin(), rb.end(), value)
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    void fill(RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rb, const T& value);
+    /// @brief Find the oldest element equal to value. Same as std::find(rb.begin(), rb.end(), value)
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::iterator find(RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rb, const T& value);
+    /// @brief Same as above
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::const_iterator find(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rb, const T& value);
+    /// @brief Count elements equal to value. Same as std::count(rb.begin(), rb.end(), value)
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::difference_type count(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rb, const T& value);
+    /// @brief Same as std::accumulate(rb.begin(), rb.end(), init)
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy, typename U>
+    U accumulate(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rb, U init);
+    /// @brief Same as std::accumulate(rb.begin(), rb.end(), init, op)
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy, typename U, typename BinaryOp>
+    U accumulate(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rb, U init, BinaryOp op);
+    /// @brief Check if lhs and rhs hold equal elements in the same order
+    /// @details Parts of lhs and rhs are compared pairwise in at most three contiguous chunks. For integral, enum and pointer
+    ///          types, which have no padding and compare equal exactly when their bytes are equal, chunks are compared with memcmp
+    template <typename T, typename Allocator1, typename CapacityPolicy1, typename OverflowPolicy1, typename Allocator2, typename CapacityPolicy2, typename OverflowPolicy2>
+    bool equal(const RingBuffer<T, Allocator1, CapacityPolicy1, OverflowPolicy1>& lhs, const RingBuffer<T, Allocator2, CapacityPolicy2, OverflowPolicy2>& rhs);
+    /// @brief Same as std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end())
+    /// @details Parts of lhs and rhs are compared pairwise in at most three contiguous chunks, with memcmp for unsigned char
+    template <typename T, typename Allocator1, typename CapacityPolicy1, typename OverflowPolicy1, typename Allocator2, typename CapacityPolicy2, typename OverflowPolicy2>
+    bool lexicographical_compare(const RingBuffer<T, Allocator1, CapacityPolicy1, OverflowPolicy1>& lhs, const RingBuffer<T, Allocator2, CapacityPolicy2, OverflowPolicy2>& rhs);
+
+    namespace detail {
+        /// @brief Types whose values are equal exactly when their object representations are equal
+        template <typename T>
+        struct is_bitwise_equality_comparable : std::integral_constant<bool, std::is_integral<T>::value || std::is_enum<T>::value || std::is_pointer<T>::value> {};
+
+        /// @brief Call f(lhsChunk, rhsChunk, chunkSize) for contiguous chunks of the first min(lhs.size(), rhs.size()) elements
+        ///        of lhs and rhs, in order, until f returns false
+        /// @return false if f returned false for some chunk
+        template <typename T, typename Allocator1, typename CapacityPolicy1, typename OverflowPolicy1, typename Allocator2, typename CapacityPolicy2, typename OverflowPolicy2, typename F>
+        bool for_each_segment_pair(const RingBuffer<T, Allocator1, CapacityPolicy1, OverflowPolicy1>& lhs, const RingBuffer<T, Allocator2, CapacityPolicy2, OverflowPolicy2>& rhs, F f);
+
+        template <typename T>
+        bool equal_n(const T* lhs, const T* rhs, const std::size_t count, std::false_type);
+        template <typename T>
+        bool equal_n(const T* lhs, const T* rhs, const std::size_t count, std::true_type);
+
+        /// @brief Compare count elements of lhs and rhs lexicographically
+        /// @return Negative value if lhs is less, positive if rhs is less, 0 if all elements are equivalent
+        template <typename T>
+        int compare_n(const T* lhs, const T* rhs, const std::size_t count);
+        inline int compare_n(const unsigned char* lhs, const unsigned char* rhs, const std::size_t count);
+    } // namespace detail
 } // namespace simpleContainers
 
 // ============================================================================================================================================
@@ -283,450 +653,1248 @@ namespace simpleContainers {
 // ============================================================================================================================================
 
 namespace simpleContainers {
-    template <typename T, typename Allocator>
+    namespace detail {
+        inline std::size_t round_up_to_power_of_two(std::size_t n) noexcept {
+            std::size_t result = 1;
+            while (result < n) {
+                result <<= 1;
+            }
+            return result;
+        }
+
+        inline unsigned highest_bit_index(const std::uint64_t value) noexcept {
+            SIMPLE_RING_BUFFER_ASSERT(value != 0, "highest_bit_index called with 0");
+#if defined(__GNUC__) || defined(__clang__)
+            return 63u - static_cast<unsigned>(__builtin_clzll(value));
+#elif defined(_MSC_VER) && defined(_M_X64)
+            unsigned long index = 0;
+            _BitScanReverse64(&index, value);
+            return static_cast<unsigned>(index);
+#else
+            unsigned index = 0;
+            std::uint64_t remaining = value;
+            while (remaining >>= 1) {
+                ++index;
+            }
+            return index;
+#endif // #if defined(__GNUC__) || defined(__clang__)
+        }
+    } // namespace detail
+
+    template <typename T>
+    inline Segment<T>::Segment() noexcept
+        : mData{nullptr}, mSize{0}
+    {}
+
+    template <typename T>
+    inline Segment<T>::Segment(pointer data, const size_type size) noexcept
+        : mData{data}, mSize{size}
+    {}
+
+    template <typename T>
+    template <typename U, typename>
+    inline Segment<T>::Segment(const Segment<U>& other) noexcept
+        : mData{other.data()}, mSize{other.size()}
+    {}
+
+    template <typename T>
+    inline typename Segment<T>::pointer Segment<T>::data() const noexcept {
+        return mData;
+    }
+
+    template <typename T>
+    inline typename Segment<T>::size_type Segment<T>::size() const noexcept {
+        return mSize;
+    }
+
+    template <typename T>
+    inline bool Segment<T>::empty() const noexcept {
+        return mSize == 0;
+    }
+
+    template <typename T>
+    inline typename Segment<T>::iterator Segment<T>::begin() const noexcept {
+        return mData;
+    }
+
+    template <typename T>
+    inline typename Segment<T>::iterator Segment<T>::end() const noexcept {
+        return mData + mSize;
+    }
+
+    template <typename T>
+    inline typename Segment<T>::reference Segment<T>::operator[](const size_type pos) const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(pos < mSize, "Segment subscript operator out of range");
+        return mData[pos];
+    }
+
+    inline std::size_t ExactCapacity::adjust_capacity(const std::size_t requestedCapacity) noexcept {
+        return requestedCapacity;
+    }
+
+    inline std::size_t ExactCapacity::wrap_index(const std::size_t index, const std::size_t capacity) noexcept {
+        return index >= capacity ? index - capacity : index;
+    }
+
+    inline std::size_t PowerOfTwoCapacity::adjust_capacity(const std::size_t requestedCapacity) noexcept {
+        return detail::round_up_to_power_of_two(requestedCapacity);
+    }
+
+    inline std::size_t PowerOfTwoCapacity::wrap_index(const std::size_t index, const std::size_t capacity) noexcept {
+        return index & (capacity - 1);
+    }
+
+    inline void OverwriteOldest::on_rejected(const std::size_t) noexcept {}
+
+    inline void RejectNew::on_rejected(const std::size_t) noexcept {}
+
+    inline void CountRejectedNew::on_rejected(const std::size_t rejectedCount) noexcept {
+        mRejectedCount += rejectedCount;
+    }
+
+    inline std::size_t CountRejectedNew::rejected_count() const noexcept {
+        return mRejectedCount;
+    }
+
+    inline void CountRejectedNew::reset_rejected_count() noexcept {
+        mRejectedCount = 0;
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
     template <bool constTag>
-    inline RingBuffer<T, Allocator>::RingBufferIterator<constTag>::RingBufferIterator(size_type pos, ring_buffer_ptr rb) noexcept
-        : mPosition{pos}, mRingBufPtr{rb}
+    inline RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::RingBufferIterator<constTag>::RingBufferIterator(size_type pos, ring_buffer_ptr rb) noexcept
+        : mElement{rb != nullptr ? rb->mStorage + rb->to_storage_index(pos) : nullptr}, mPosition{pos},
+          mStorageBegin{rb != nullptr ? rb->mStorage : nullptr}, mStorageEnd{rb != nullptr ? rb->mStorage + rb->mCurrentCapacity : nullptr}
     {}
 
-    template <typename T, typename Allocator>
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
     template <bool constTag> 
     template <bool C, typename> 
-    inline RingBuffer<T, Allocator>::RingBufferIterator<constTag>::RingBufferIterator(const RingBuffer<T, Allocator>::RingBufferIterator<false> &other) noexcept
-        : mPosition{other.mPosition}, mRingBufPtr{other.mRingBufPtr} 
+    inline RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::RingBufferIterator<constTag>::RingBufferIterator(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::RingBufferIterator<false> &other) noexcept
+        : mElement{other.mElement}, mPosition{other.mPosition}, mStorageBegin{other.mStorageBegin}, mStorageEnd{other.mStorageEnd}
     {}
 
-    template <typename T, typename Allocator>
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
     template <bool constTag>
-    inline void RingBuffer<T, Allocator>::RingBufferIterator<constTag>::swap(RingBufferIterator& other) noexcept {
+    inline void RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::RingBufferIterator<constTag>::swap(RingBufferIterator& other) noexcept {
+        std::swap(mElement, other.mElement);
         std::swap(mPosition, other.mPosition);
-        std::swap(mRingBufPtr, other.mRingBufPtr);
+        std::swap(mStorageBegin, other.mStorageBegin);
+        std::swap(mStorageEnd, other.mStorageEnd);
     }
 
-    template <typename T, typename Allocator>
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
     template <bool constTag>
-    inline typename RingBuffer<T, Allocator>::template RingBufferIterator<constTag>::reference
-    RingBuffer<T, Allocator>::RingBufferIterator<constTag>::operator*() const noexcept {
-        SIMPLE_RING_BUFFER_ASSERT(mRingBufPtr != nullptr, "RingBufferIterator::operator* trying to dereference mRingBufPtr which is a nullptr");
-        return (*mRingBufPtr)[mPosition];
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::template RingBufferIterator<constTag>::reference
+    RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::RingBufferIterator<constTag>::operator*() const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(mElement != nullptr, "RingBufferIterator::operator* trying to dereference an iterator that does not belong to a RingBuffer");
+        return *mElement;
     }
 
-    template <typename T, typename Allocator>
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
     template <bool constTag>
-    inline typename RingBuffer<T, Allocator>::template RingBufferIterator<constTag>::pointer 
-    RingBuffer<T, Allocator>::RingBufferIterator<constTag>::operator->() const noexcept {
-        SIMPLE_RING_BUFFER_ASSERT(mRingBufPtr != nullptr, "RingBufferIterator::operator-> trying to dereference mRingBufPtr which is a nullptr");
-        return &((*mRingBufPtr)[mPosition]);
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::template RingBufferIterator<constTag>::pointer 
+    RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::RingBufferIterator<constTag>::operator->() const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(mElement != nullptr, "RingBufferIterator::operator-> trying to dereference an iterator that does not belong to a RingBuffer");
+        return mElement;
     }
 
-    template <typename T, typename Allocator>
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
     template <bool constTag>
-    inline typename RingBuffer<T, Allocator>::template RingBufferIterator<constTag>::reference
-    RingBuffer<T, Allocator>::RingBufferIterator<constTag>::operator[](const difference_type n) const noexcept {
-        SIMPLE_RING_BUFFER_ASSERT(mRingBufPtr != nullptr, "RingBufferIterator::operator[] trying to dereference mRingBufPtr which is a nullptr");
-        return (*mRingBufPtr)[mPosition + static_cast<size_type>(n)];
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::template RingBufferIterator<constTag>::reference
+    RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::RingBufferIterator<constTag>::operator[](const difference_type n) const noexcept {
+        return *(*this + n);
     }
 
-    template <typename T, typename Allocator>
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
     template <bool constTag>
-    inline typename RingBuffer<T, Allocator>::template RingBufferIterator<constTag>& 
-    RingBuffer<T, Allocator>::RingBufferIterator<constTag>::operator++() noexcept {
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::template RingBufferIterator<constTag>& 
+    RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::RingBufferIterator<constTag>::operator++() noexcept {
         ++mPosition;
+        ++mElement;
+        if (mElement == mStorageEnd) {
+            mElement = mStorageBegin;
+        }
         return *this;
     }
     
-    template <typename T, typename Allocator>
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
     template <bool constTag>
-    inline typename RingBuffer<T, Allocator>::template RingBufferIterator<constTag> 
-    RingBuffer<T, Allocator>::RingBufferIterator<constTag>::operator++(int) noexcept {
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::template RingBufferIterator<constTag> 
+    RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::RingBufferIterator<constTag>::operator++(int) noexcept {
         RingBufferIterator tmp = *this;
         ++(*this);
         return tmp;
     }
 
-    template <typename T, typename Allocator>
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
     template <bool constTag>
-    inline typename RingBuffer<T, Allocator>::template RingBufferIterator<constTag>& 
-    RingBuffer<T, Allocator>::RingBufferIterator<constTag>::operator+=(const difference_type n) noexcept {
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::template RingBufferIterator<constTag>& 
+    RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::RingBufferIterator<constTag>::operator+=(const difference_type n) noexcept {
+        // |n| is at most the size of RingBuffer, so the offset only needs to be wrapped once in either direction
+        const difference_type storageCapacity = mStorageEnd - mStorageBegin;
+        difference_type offset = (mElement - mStorageBegin) + n;
+        if (offset >= storageCapacity) {
+            offset -= storageCapacity;
+        }
+        else if (offset < 0) {
+            offset += storageCapacity;
+        }
+
         mPosition += static_cast<size_type>(n);
+        mElement = mStorageBegin + offset;
         return *this;
     }
 
-    template <typename T, typename Allocator>
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
     template <bool constTag>
-    inline typename RingBuffer<T, Allocator>::template RingBufferIterator<constTag> 
-    RingBuffer<T, Allocator>::RingBufferIterator<constTag>::operator+(const difference_type n) const noexcept {
-        return RingBufferIterator<constTag>(mPosition + static_cast<size_type>(n), mRingBufPtr);
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::template RingBufferIterator<constTag> 
+    RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::RingBufferIterator<constTag>::operator+(const difference_type n) const noexcept {
+        RingBufferIterator tmp = *this;
+        tmp += n;
+        return tmp;
     }
 
-    template <typename T, typename Allocator>
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
     template <bool constTag>
-    inline typename RingBuffer<T, Allocator>::template RingBufferIterator<constTag>& 
-    RingBuffer<T, Allocator>::RingBufferIterator<constTag>::operator--() noexcept {
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::template RingBufferIterator<constTag>& 
+    RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::RingBufferIterator<constTag>::operator--() noexcept {
         --mPosition;
+        if (mElement == mStorageBegin) {
+            mElement = mStorageEnd;
+        }
+        --mElement;
         return *this;
     }
 
-    template <typename T, typename Allocator>
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
     template <bool constTag>
-    inline typename RingBuffer<T, Allocator>::template RingBufferIterator<constTag> 
-    RingBuffer<T, Allocator>::RingBufferIterator<constTag>::operator--(int) noexcept {
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::template RingBufferIterator<constTag> 
+    RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::RingBufferIterator<constTag>::operator--(int) noexcept {
         RingBufferIterator tmp = *this;
         --(*this);
         return tmp;
     }
 
-    template <typename T, typename Allocator>
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
     template <bool constTag>
-    inline typename RingBuffer<T, Allocator>::template RingBufferIterator<constTag>& 
-    RingBuffer<T, Allocator>::RingBufferIterator<constTag>::operator-=(const difference_type n) noexcept {
-        mPosition -= static_cast<size_type>(n);
-        return *this;
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::template RingBufferIterator<constTag>& 
+    RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::RingBufferIterator<constTag>::operator-=(const difference_type n) noexcept {
+        return *this += -n;
     }
 
-    template <typename T, typename Allocator>
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
     template <bool constTag>
-    inline typename RingBuffer<T, Allocator>::template RingBufferIterator<constTag> 
-    RingBuffer<T, Allocator>::RingBufferIterator<constTag>::operator-(const difference_type n) const noexcept {
-        return RingBufferIterator<constTag>(mPosition - static_cast<size_type>(n), mRingBufPtr);
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::template RingBufferIterator<constTag> 
+    RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::RingBufferIterator<constTag>::operator-(const difference_type n) const noexcept {
+        RingBufferIterator tmp = *this;
+        tmp -= n;
+        return tmp;
     }
               
-    template <typename T, typename Allocator>
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
     template <bool constTag>
-    inline typename RingBuffer<T, Allocator>::template RingBufferIterator<constTag>::difference_type 
-    RingBuffer<T, Allocator>::RingBufferIterator<constTag>::operator-(const RingBufferIterator& other) const noexcept {
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::template RingBufferIterator<constTag>::difference_type 
+    RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::RingBufferIterator<constTag>::operator-(const RingBufferIterator& other) const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(mStorageBegin == other.mStorageBegin, "RingBufferIterator subtraction must be done on iterators of the same RingBuffer");
         return static_cast<difference_type>(mPosition - other.mPosition);
     }
 
-    template <typename T, typename Allocator>
-    inline RingBuffer<T, Allocator>::RingBuffer(const size_type initialCapacity, const allocator_type& alloc)
-        : mBuffer{std::vector<value_type, allocator_type>{alloc}}, mCurrentCapacity{initialCapacity}, mNewestElementInsertionIndex{0}
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::RingBuffer(const size_type initialCapacity, const allocator_type& alloc)
+        : mAllocator{alloc}, mStorage{nullptr}, mStorageCapacity{0}, mCurrentCapacity{CapacityPolicy::adjust_capacity(initialCapacity)}, mOldestElementIndex{0}, mSize{0}, mOverflowPolicy{}
     {
         SIMPLE_RING_BUFFER_ASSERT(initialCapacity != 0, "RingBuffer must not be constructed with initial capacity of 0");
-        mBuffer.reserve(mCurrentCapacity);
+        allocate_storage(mCurrentCapacity);
     }
 
-    template <typename T, typename Allocator>
-    inline RingBuffer<T, Allocator>::RingBuffer(const size_type initialCapacity, const value_type& val, const allocator_type& alloc)
-        : mBuffer{std::vector<value_type, allocator_type>(initialCapacity, val, alloc)}, mCurrentCapacity{initialCapacity}, mNewestElementInsertionIndex{0}
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::RingBuffer(const size_type initialCapacity, const value_type& val, const allocator_type& alloc)
+        : RingBuffer(initialCapacity, alloc)
     {
-        SIMPLE_RING_BUFFER_ASSERT(initialCapacity != 0, "RingBuffer must not be constructed with initial capacity of 0");
-        mBuffer.reserve(mCurrentCapacity);
+        // delegating constructor already finished, so the destructor cleans up if a copy throws
+        for (size_type i = 0; i < initialCapacity; ++i) {
+            construct_back(val);
+        }
     }
     
-    template <typename T, typename Allocator>
-    inline RingBuffer<T, Allocator>::RingBuffer(const std::vector<value_type, allocator_type>& initVec, const allocator_type& alloc)
-        : mBuffer(initVec, alloc), mCurrentCapacity{initVec.size()}, mNewestElementInsertionIndex{0}
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::RingBuffer(const std::vector<value_type, allocator_type>& initVec, const allocator_type& alloc)
+        : RingBuffer(initVec.begin(), initVec.end(), alloc)
     {
         SIMPLE_RING_BUFFER_ASSERT(initVec.size() != 0, "RingBuffer must not be constructed from an empty std::vector");
     }
 
-    template <typename T, typename Allocator>
-    inline RingBuffer<T, Allocator>::RingBuffer(std::initializer_list<value_type> initList, const allocator_type& alloc)
-        : mBuffer(initList, alloc), mCurrentCapacity{initList.size()}, mNewestElementInsertionIndex{0}
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::RingBuffer(std::initializer_list<value_type> initList, const allocator_type& alloc)
+        : RingBuffer(initList.begin(), initList.end(), alloc)
     {
         SIMPLE_RING_BUFFER_ASSERT(initList.size() != 0, "RingBuffer must not be constructed from an empty std::initializer_list");
     }
 
-    template <typename T, typename Allocator>
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
     template <typename Iterator>
-    inline RingBuffer<T, Allocator>::RingBuffer(Iterator itStart, Iterator itEnd, const allocator_type& alloc)
-        : mBuffer(itStart, itEnd, alloc), mCurrentCapacity{static_cast<size_type>(std::distance(itStart, itEnd))}, mNewestElementInsertionIndex{0}
+    inline RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::RingBuffer(Iterator itStart, Iterator itEnd, const allocator_type& alloc)
+        : RingBuffer(static_cast<size_type>(std::distance(itStart, itEnd)), alloc)
     {
         SIMPLE_RING_BUFFER_ASSERT(std::distance(itStart, itEnd) >= 0, "Distance between iterators cannot be negative");
+        while (itStart != itEnd) {
+            construct_back(*itStart);
+            ++itStart;
+        }
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::RingBuffer(const RingBuffer& other)
+        : RingBuffer(other.mCurrentCapacity, allocator_traits::select_on_container_copy_construction(other.mAllocator))
+    {
+        for (size_type pos = 0; pos < other.mSize; ++pos) {
+            construct_back(other[pos]);
+        }
+        mOverflowPolicy = other.mOverflowPolicy;
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::RingBuffer(RingBuffer&& other) noexcept
+        : mAllocator{std::move(other.mAllocator)}, mStorage{other.mStorage}, mStorageCapacity{other.mStorageCapacity},
+          mCurrentCapacity{other.mCurrentCapacity}, mOldestElementIndex{other.mOldestElementIndex}, mSize{other.mSize},
+          mOverflowPolicy{other.mOverflowPolicy}
+    {
+        // other keeps its capacity so that it can still be used, but it needs new storage for that
+        other.mStorage = nullptr;
+        other.mStorageCapacity = 0;
+        other.mOldestElementIndex = 0;
+        other.mSize = 0;
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::operator=(const RingBuffer& rhs) {
+        if (this != &rhs) {
+            using propagate = typename allocator_traits::propagate_on_container_copy_assignment;
+
+            // the copy is made with the allocator this RingBuffer ends up with, so its storage can simply be swapped in
+            RingBuffer tmp(rhs.mCurrentCapacity, propagate::value ? rhs.mAllocator : mAllocator);
+            for (size_type pos = 0; pos < rhs.mSize; ++pos) {
+                tmp.construct_back(rhs[pos]);
+            }
+            tmp.mOverflowPolicy = rhs.mOverflowPolicy;
+
+            swap_contents(tmp);
+            // tmp now owns the old storage, so it also needs the allocator that storage came from
+            swap_allocators(tmp, propagate{});
+        }
+
+        return *this;
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::operator=(RingBuffer&& rhs) noexcept(std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value) {
+        if (this != &rhs) {
+            move_assign(rhs, typename allocator_traits::propagate_on_container_move_assignment{});
+        }
+
+        return *this;
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::~RingBuffer() noexcept {
+        clear();
+        deallocate_storage();
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::allocator_type RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::get_allocator() const noexcept {
+        return mAllocator;
     }
 
-    template <typename T, typename Allocator>
-    inline typename RingBuffer<T, Allocator>::allocator_type RingBuffer<T, Allocator>::get_allocator() const noexcept {
-        return mBuffer.get_allocator();
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline const OverflowPolicy& RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::overflow_policy() const noexcept {
+        return mOverflowPolicy;
     }
 
-    template <typename T, typename Allocator>
-    inline typename RingBuffer<T, Allocator>::size_type RingBuffer<T, Allocator>::capacity() const noexcept {
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline OverflowPolicy& RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::overflow_policy() noexcept {
+        return mOverflowPolicy;
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::size_type RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::capacity() const noexcept {
         return mCurrentCapacity;
     }
 
-    template <typename T, typename Allocator>
-    inline void RingBuffer<T, Allocator>::change_capacity(const size_type newCapacity) noexcept {
-        SIMPLE_RING_BUFFER_ASSERT(newCapacity != 0, "RingBuffer::change_capacity new capacity must not be 0");
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::change_capacity(const size_type requestedCapacity) {
+        SIMPLE_RING_BUFFER_ASSERT(requestedCapacity != 0, "RingBuffer::change_capacity new capacity must not be 0");
+        const size_type newCapacity = CapacityPolicy::adjust_capacity(requestedCapacity);
 
         if (newCapacity == mCurrentCapacity) {
             return;
         }
 
-        std::vector<value_type, allocator_type> newBuffer(get_allocator());
-        newBuffer.reserve(newCapacity);
+        // only the last newCapacity elements are kept
+        while (mSize > newCapacity) {
+            pop_front();
+        }
 
-        auto it = begin();
-        if (newCapacity < mCurrentCapacity) { // only keep the last newCapacity elements
-            size_type tmp = mCurrentCapacity - newCapacity;
-            while (tmp > 0) {
-                ++it;
-                --tmp;
-            }
+        if (newCapacity <= mStorageCapacity) {
+            // storage already owns enough memory, so only the part that wrapped around has to be put back in order
+            linearize();
+            mCurrentCapacity = newCapacity;
+        }
+        else {
+            reallocate_storage(newCapacity);
         }
+    }
 
-        auto itEnd = end();
-        while (it != itEnd) {
-            newBuffer.emplace_back(*it);
-            ++it;
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::shrink_to_fit() {
+        if (mStorageCapacity > mCurrentCapacity) {
+            reallocate_storage(mCurrentCapacity);
         }
+    }
 
-        mBuffer.swap(newBuffer);
-        mNewestElementInsertionIndex = newBuffer.size() % newCapacity;
-        mCurrentCapacity = newCapacity;
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::size_type RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::size() const noexcept {
+        return mSize;
     }
 
-    template <typename T, typename Allocator>
-    inline typename RingBuffer<T, Allocator>::size_type RingBuffer<T, Allocator>::size() const noexcept {
-        return mBuffer.size();
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::size_type RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::max_size() const noexcept {
+        return allocator_traits::max_size(mAllocator);
     }
 
-    template <typename T, typename Allocator>
-    inline typename RingBuffer<T, Allocator>::size_type RingBuffer<T, Allocator>::max_size() const noexcept {
-        return mBuffer.max_size();
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::empty() const noexcept {
+        return mSize == 0;
     }
 
-    template <typename T, typename Allocator>
-    inline bool RingBuffer<T, Allocator>::empty() const noexcept {
-        return mBuffer.empty();
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::full() const noexcept {
+        return mSize == mCurrentCapacity;
     }
 
-    template <typename T, typename Allocator>
-    inline bool RingBuffer<T, Allocator>::full() const noexcept {
-        return mBuffer.size() == mCurrentCapacity;
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::clear() noexcept {
+        while (mSize > 0) {
+            pop_back();
+        }
+        mOldestElementIndex = 0;
     }
 
-    template <typename T, typename Allocator>
-    inline void RingBuffer<T, Allocator>::clear() noexcept {
-        mNewestElementInsertionIndex = 0;
-        mBuffer.clear();
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline std::vector<typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::value_type> RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::get_elements() const noexcept {
+        const Segment<const value_type> first = array_one();
+        const Segment<const value_type> second = array_two();
+
+        std::vector<value_type> result;
+        result.reserve(mSize);
+        result.insert(result.end(), first.begin(), first.end());
+        result.insert(result.end(), second.begin(), second.end());
+
+        return result;
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline Segment<typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::value_type> RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::array_one() noexcept {
+        return Segment<value_type>{mStorage + mOldestElementIndex, std::min(mSize, mCurrentCapacity - mOldestElementIndex)};
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline Segment<const typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::value_type> RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::array_one() const noexcept {
+        return Segment<const value_type>{mStorage + mOldestElementIndex, std::min(mSize, mCurrentCapacity - mOldestElementIndex)};
     }
 
-    template <typename T, typename Allocator>
-    inline std::vector<typename RingBuffer<T, Allocator>::value_type> RingBuffer<T, Allocator>::get_elements() const noexcept {
-        if (mBuffer.size() < mCurrentCapacity) {
-            return mBuffer;
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline Segment<typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::value_type> RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::array_two() noexcept {
+        return Segment<value_type>{mStorage, mSize - std::min(mSize, mCurrentCapacity - mOldestElementIndex)};
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline Segment<const typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::value_type> RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::array_two() const noexcept {
+        return Segment<const value_type>{mStorage, mSize - std::min(mSize, mCurrentCapacity - mOldestElementIndex)};
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline std::pair<Segment<const typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::value_type>, Segment<const typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::value_type>>
+    RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::segments() const noexcept {
+        return std::make_pair(array_one(), array_two());
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline std::pair<Segment<const typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::value_type>, Segment<const typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::value_type>>
+    RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::segments(const size_type pos, const size_type count) const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(pos <= mSize && count <= mSize - pos, "RingBuffer::segments range is out of bounds");
+        const Segment<const value_type> first = array_one();
+
+        if (pos >= first.size()) {
+            // second segment always starts at the beginning of the storage
+            return std::make_pair(Segment<const value_type>{mStorage + (pos - first.size()), count}, Segment<const value_type>{});
         }
-        else {
-            std::vector<value_type> result;
-            result.reserve(mCurrentCapacity);
 
-            for (size_type i = mNewestElementInsertionIndex; i < mCurrentCapacity; ++i) {
-                result.emplace_back(mBuffer[i]);
-            }
-            
-            for (size_type i = 0; i < mNewestElementInsertionIndex; ++i) {
-                result.emplace_back(mBuffer[i]);
+        const size_type fromFirstCount = std::min(count, first.size() - pos);
+        return std::make_pair(Segment<const value_type>{first.data() + pos, fromFirstCount}, Segment<const value_type>{mStorage, count - fromFirstCount});
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::pointer RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::linearize() {
+        if (mSize == 0) {
+            mOldestElementIndex = 0;
+        }
+        else if (!is_linearized()) {
+            // elements occupy [mOldestElementIndex, mOldestElementIndex + firstSegmentSize) and [0, secondSegmentSize). If there
+            // are unused slots between the two, first move the oldest elements down so that they directly follow the newest ones
+            const size_type firstSegmentSize = array_one().size();
+            const size_type secondSegmentSize = mSize - firstSegmentSize;
+
+            if (secondSegmentSize != mOldestElementIndex) {
+                for (size_type i = 0; i < firstSegmentSize; ++i) {
+                    const size_type from = mOldestElementIndex + i;
+                    const size_type to = secondSegmentSize + i;
+                    if (to < mOldestElementIndex) { // unused slot, nothing is constructed there
+                        allocator_traits::construct(mAllocator, mStorage + to, std::move(mStorage[from]));
+                    }
+                    else {
+                        mStorage[to] = std::move(mStorage[from]);
+                    }
+                }
+
+                // slots past the shifted oldest elements only hold moved from objects now
+                for (size_type i = std::max(mOldestElementIndex, mSize); i < mOldestElementIndex + firstSegmentSize; ++i) {
+                    allocator_traits::destroy(mAllocator, mStorage + i);
+                }
             }
 
-            return result;
+            // now [0, mSize) holds the newest elements followed by the oldest ones
+            std::rotate(mStorage, mStorage + secondSegmentSize, mStorage + mSize);
+            mOldestElementIndex = 0;
         }
+
+        return data();
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::is_linearized() const noexcept {
+        return mOldestElementIndex == 0 || mSize == 0;
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::pointer RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::data() noexcept {
+        return mStorage;
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::const_pointer RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::data() const noexcept {
+        return mStorage;
     }
 
-    template <typename T, typename Allocator>
-    inline void RingBuffer<T, Allocator>::push_back(const value_type& elem) {
-        if (mBuffer.size() == mCurrentCapacity) {   // most common case
-            mBuffer[mNewestElementInsertionIndex] = elem;
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::push_back(const value_type& elem) {
+        if (mSize == mCurrentCapacity) {   // most common case
+            if (!OverflowPolicy::overwritesOldest) {
+                mOverflowPolicy.on_rejected(1);
+            }
+            else if (std::addressof(elem) == mStorage + mOldestElementIndex) {
+                // the oldest element becomes the newest one, it already holds the right value
+                mOldestElementIndex = CapacityPolicy::wrap_index(mOldestElementIndex + 1, mCurrentCapacity);
+            }
+            else {
+                overwrite_front(elem);
+            }
         }
-        else if (mBuffer.size() < mCurrentCapacity) { // only happens during the initial filling
-            mBuffer.push_back(elem);
+        else { // only happens during the initial filling or after elements were removed
+            construct_back(elem);
         }
+    }
 
-        ++mNewestElementInsertionIndex;
-
-        if (mNewestElementInsertionIndex == mCurrentCapacity) {
-            mNewestElementInsertionIndex = 0;
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::push_back(value_type&& elem) {
+        if (mSize == mCurrentCapacity) {   // most common case
+            if (!OverflowPolicy::overwritesOldest) {
+                mOverflowPolicy.on_rejected(1);
+            }
+            else if (std::addressof(elem) == mStorage + mOldestElementIndex) {
+                mOldestElementIndex = CapacityPolicy::wrap_index(mOldestElementIndex + 1, mCurrentCapacity);
+            }
+            else {
+                overwrite_front(std::move(elem));
+            }
+        }
+        else { // only happens during the initial filling or after elements were removed
+            construct_back(std::forward<value_type>(elem));
         }
     }
 
-    template <typename T, typename Allocator>
-    inline void RingBuffer<T, Allocator>::push_back(value_type&& elem) {
-        if (mBuffer.size() == mCurrentCapacity) {   // most common case
-            mBuffer[mNewestElementInsertionIndex] = std::forward<value_type>(elem);
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    template <typename ...Args>
+    inline void RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::emplace_back(Args&&... args) {
+        if (mSize == mCurrentCapacity) {   // most common case
+            if (!OverflowPolicy::overwritesOldest) {
+                mOverflowPolicy.on_rejected(1);
+            }
+            else {
+                // args may refer to the oldest element, as in emplace_back(rb.front()), and that element is destroyed
+                // before the new one is constructed in its slot, so the new element is built on the side first
+                value_type elem(std::forward<Args>(args)...);
+                overwrite_front(std::move(elem));
+            }
         }
-        else if (mBuffer.size() < mCurrentCapacity) { // only happens during the initial filling
-            mBuffer.push_back(std::forward<value_type>(elem));
+        else { // only happens during the initial filling or after elements were removed
+            construct_back(std::forward<Args>(args)...);
         }
+    }
 
-        ++mNewestElementInsertionIndex;
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::try_push_back(const value_type& elem) {
+        return try_emplace_back(elem);
+    }
 
-        if (mNewestElementInsertionIndex == mCurrentCapacity) {
-            mNewestElementInsertionIndex = 0;
-        }
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::try_push_back(value_type&& elem) {
+        return try_emplace_back(std::move(elem));
     }
 
-    template <typename T, typename Allocator>
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
     template <typename ...Args>
-    inline void RingBuffer<T, Allocator>::emplace_back(Args&&... args) {
-        if (mBuffer.size() == mCurrentCapacity) {   // most common case
-            mBuffer[mNewestElementInsertionIndex] = T{std::forward<Args>(args)...};
+    inline bool RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::try_emplace_back(Args&&... args) {
+        if (mSize == mCurrentCapacity) {
+            mOverflowPolicy.on_rejected(1);
+            return false;
         }
-        else if (mBuffer.size() < mCurrentCapacity) { // only happens during the initial filling
-            mBuffer.emplace_back(std::forward<Args>(args)...);
+
+        construct_back(std::forward<Args>(args)...);
+        return true;
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::reference RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::recycle_back() {
+        if (mSize == mCurrentCapacity) {   // most common case
+            const size_type recycledIndex = mOldestElementIndex;
+            mOldestElementIndex = CapacityPolicy::wrap_index(mOldestElementIndex + 1, mCurrentCapacity);
+            return mStorage[recycledIndex];
         }
 
-        ++mNewestElementInsertionIndex;
+        construct_back();
+        return (*this)[mSize - 1];
+    }
 
-        if (mNewestElementInsertionIndex == mCurrentCapacity) {
-            mNewestElementInsertionIndex = 0;
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    template <typename F>
+    inline void RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::push_back_reuse(F&& fill) {
+        if (mSize == mCurrentCapacity) {   // most common case
+            std::forward<F>(fill)(mStorage[mOldestElementIndex]);
+            mOldestElementIndex = CapacityPolicy::wrap_index(mOldestElementIndex + 1, mCurrentCapacity);
+        }
+        else {
+            construct_back();
+            try {
+                std::forward<F>(fill)((*this)[mSize - 1]);
+            }
+            catch (...) {
+                pop_back();
+                throw;
+            }
         }
     }
 
-    template <typename T, typename Allocator>
-    inline void RingBuffer<T, Allocator>::swap(RingBuffer& other) noexcept {
-        std::swap(mBuffer, other.mBuffer);
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    template <typename Iterator>
+    inline void RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::push_back(Iterator first, Iterator last) {
+        push_back_range(first, last, typename std::iterator_traits<Iterator>::iterator_category{});
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::append(const value_type* data, const size_type count) {
+        push_back(data, data + count);
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::swap(RingBuffer& other) noexcept {
+        using propagate = typename allocator_traits::propagate_on_container_swap;
+        SIMPLE_RING_BUFFER_ASSERT(propagate::value || mAllocator == other.mAllocator, "RingBuffer::swap called with unequal allocators that do not propagate on swap");
+
+        swap_allocators(other, propagate{});
+        swap_contents(other);
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::swap_contents(RingBuffer& other) noexcept {
+        std::swap(mStorage, other.mStorage);
+        std::swap(mStorageCapacity, other.mStorageCapacity);
         std::swap(mCurrentCapacity, other.mCurrentCapacity);
-        std::swap(mNewestElementInsertionIndex, other.mNewestElementInsertionIndex);
+        std::swap(mOldestElementIndex, other.mOldestElementIndex);
+        std::swap(mSize, other.mSize);
+        std::swap(mOverflowPolicy, other.mOverflowPolicy);
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::swap_allocators(RingBuffer& other, std::true_type) noexcept {
+        using std::swap;
+        swap(mAllocator, other.mAllocator);
     }
 
-    template <typename T, typename Allocator>
-    inline typename RingBuffer<T, Allocator>::iterator RingBuffer<T, Allocator>::erase(const_iterator it) noexcept {
-        // reorder the internal vector so that it's erase method may be used
-        auto mBufBegin = mBuffer.begin();
-        std::rotate(mBufBegin, mBufBegin + static_cast<difference_type>(mNewestElementInsertionIndex), mBuffer.end());
-        auto dist = it - cbegin();
-        mBuffer.erase(mBuffer.begin() + dist);
-        mNewestElementInsertionIndex = mBuffer.size();
-        return iterator{static_cast<typename iterator::size_type>(dist), this};
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::swap_allocators(RingBuffer&, std::false_type) noexcept {}
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::move_assign(RingBuffer& rhs, std::true_type) noexcept {
+        RingBuffer tmp{std::move(rhs)};
+        swap_contents(tmp);
+        swap_allocators(tmp, std::true_type{});
     }
 
-    template <typename T, typename Allocator>
-    inline typename RingBuffer<T, Allocator>::iterator RingBuffer<T, Allocator>::erase(const_iterator first, const_iterator last) noexcept {
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::move_assign(RingBuffer& rhs, std::false_type) {
+        if (mAllocator == rhs.mAllocator) {
+            // storage of rhs can be released through this RingBuffer's allocator, so it is taken over as is
+            RingBuffer tmp{std::move(rhs)};
+            swap_contents(tmp);
+            return;
+        }
+
+        // storage of rhs must stay with its own allocator, only the elements are moved
+        RingBuffer tmp(rhs.mCurrentCapacity, mAllocator);
+        for (size_type pos = 0; pos < rhs.mSize; ++pos) {
+            tmp.construct_back(std::move(rhs[pos]));
+        }
+        tmp.mOverflowPolicy = rhs.mOverflowPolicy;
+        swap_contents(tmp);
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::iterator RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::erase(const_iterator it) noexcept {
+        return erase(it, it + 1);
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::iterator RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::erase(const_iterator first, const_iterator last) noexcept {
         SIMPLE_RING_BUFFER_ASSERT((last - first) >= 0, "Iterator to last element cannot be before iterator to first element");
-        // reorder the internal vector so that it's erase method may be used
-        auto mBufBegin = mBuffer.begin();
-        std::rotate(mBufBegin, mBufBegin + static_cast<difference_type>(mNewestElementInsertionIndex), mBuffer.end());
-        auto distFirst = first - cbegin();
-        auto distLast = last - cbegin();
-        mBufBegin = mBuffer.begin();
-        mBuffer.erase(mBufBegin + distFirst, mBufBegin + distLast);
-        mNewestElementInsertionIndex = mBuffer.size();
-        return iterator{static_cast<typename iterator::size_type>(distFirst), this};
-    }
-
-    template <typename T, typename Allocator>
-    inline typename RingBuffer<T, Allocator>::reference RingBuffer<T, Allocator>::operator[](const size_type& pos) noexcept {
-        auto index = pos;
-        if (mBuffer.size() == mCurrentCapacity) { // most common case
-            index += mNewestElementInsertionIndex;
-            if (index >= mCurrentCapacity) {
-                index -= mCurrentCapacity;
+        const size_type firstPos = static_cast<size_type>(first - cbegin());
+        const size_type eraseCount = static_cast<size_type>(last - first);
+        const size_type elementsAfter = mSize - firstPos - eraseCount;
+
+        if (eraseCount == 0) {
+            return iterator{firstPos, this};
+        }
+
+        if (firstPos < elementsAfter) {
+            // fewer elements before the erased range, shift them towards the end and drop the oldest slots
+            for (size_type pos = firstPos; pos > 0; --pos) {
+                (*this)[pos - 1 + eraseCount] = std::move((*this)[pos - 1]);
+            }
+            pop_front(eraseCount);
+        }
+        else {
+            // fewer elements after the erased range, shift them towards the beginning and drop the newest slots
+            for (size_type pos = firstPos + eraseCount; pos < mSize; ++pos) {
+                (*this)[pos - eraseCount] = std::move((*this)[pos]);
+            }
+            for (size_type i = 0; i < eraseCount; ++i) {
+                pop_back();
             }
         }
 
-        SIMPLE_RING_BUFFER_ASSERT(0 <= index && index < mBuffer.size(), "RingBuffer subscript operator out of range");
-        return mBuffer[index];
+        return iterator{firstPos, this};
     }
 
-    template <typename T, typename Allocator>
-    inline typename RingBuffer<T, Allocator>::const_reference RingBuffer<T, Allocator>::operator[](const size_type& pos) const noexcept {
-        auto index = pos;
-        if (mBuffer.size() == mCurrentCapacity) { // most common case
-            index += mNewestElementInsertionIndex;
-            if (index >= mCurrentCapacity) {
-                index -= mCurrentCapacity;
-            }
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::pop_front() noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(mSize > 0, "RingBuffer::pop_front called on an empty RingBuffer");
+        allocator_traits::destroy(mAllocator, mStorage + mOldestElementIndex);
+        mOldestElementIndex = CapacityPolicy::wrap_index(mOldestElementIndex + 1, mCurrentCapacity);
+        --mSize;
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::pop_front(const size_type n) noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(n <= mSize, "RingBuffer::pop_front called with more elements than RingBuffer holds");
+        // allocators other than std::allocator may do more in destroy() than calling the destructor, so it is always called for them
+        destroy_front(n, std::integral_constant<bool, std::is_trivially_destructible<value_type>::value && std::is_same<allocator_type, std::allocator<value_type>>::value>{});
+        mOldestElementIndex = CapacityPolicy::wrap_index(mOldestElementIndex + n, mCurrentCapacity);
+        mSize -= n;
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::pop_back() noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(mSize > 0, "RingBuffer::pop_back called on an empty RingBuffer");
+        allocator_traits::destroy(mAllocator, mStorage + to_storage_index(mSize - 1));
+        --mSize;
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    template <typename OutputIt>
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::size_type RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::pop_n(OutputIt out, const size_type n) {
+        const size_type popCount = std::min(n, mSize);
+        const Segment<value_type> first = array_one();
+        const size_type fromFirstCount = std::min(popCount, first.size());
+        const size_type fromSecondCount = popCount - fromFirstCount;
+
+        // second segment always starts at the beginning of the storage
+        out = std::move(first.begin(), first.begin() + fromFirstCount, out);
+        std::move(mStorage, mStorage + fromSecondCount, out);
+
+        for (size_type i = 0; i < fromFirstCount; ++i) {
+            allocator_traits::destroy(mAllocator, first.data() + i);
+        }
+        for (size_type i = 0; i < fromSecondCount; ++i) {
+            allocator_traits::destroy(mAllocator, mStorage + i);
         }
+        mOldestElementIndex = CapacityPolicy::wrap_index(mOldestElementIndex + popCount, mCurrentCapacity);
+        mSize -= popCount;
 
-        SIMPLE_RING_BUFFER_ASSERT(0 <= index && index < mBuffer.size(), "RingBuffer subscript operator out of range");
-        return mBuffer[index];
+        return popCount;
     }
 
-    template <typename T, typename Allocator>
-    inline typename RingBuffer<T, Allocator>::reference RingBuffer<T, Allocator>::at(const size_type& pos) {
-        auto index = pos;
-        if (mBuffer.size() == mCurrentCapacity) { // most common case
-            index += mNewestElementInsertionIndex;
-            if (index >= mCurrentCapacity) {
-                index -= mCurrentCapacity;
-            }
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::reference RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::front() noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(mSize > 0, "RingBuffer::front called on an empty RingBuffer");
+        return mStorage[mOldestElementIndex];
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::const_reference RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::front() const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(mSize > 0, "RingBuffer::front called on an empty RingBuffer");
+        return mStorage[mOldestElementIndex];
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::reference RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::back() noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(mSize > 0, "RingBuffer::back called on an empty RingBuffer");
+        return mStorage[to_storage_index(mSize - 1)];
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::const_reference RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::back() const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(mSize > 0, "RingBuffer::back called on an empty RingBuffer");
+        return mStorage[to_storage_index(mSize - 1)];
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::reference RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::operator[](const size_type& pos) noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(pos < mSize, "RingBuffer subscript operator out of range");
+        return mStorage[to_storage_index(pos)];
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::const_reference RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::operator[](const size_type& pos) const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(pos < mSize, "RingBuffer subscript operator out of range");
+        return mStorage[to_storage_index(pos)];
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::reference RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::at(const size_type& pos) {
+        if (pos >= mSize) {
+            throw std::out_of_range("RingBuffer::at position out of range");
         }
 
-        return mBuffer.at(index);
+        return mStorage[to_storage_index(pos)];
     }
 
-    template <typename T, typename Allocator>
-    inline typename RingBuffer<T, Allocator>::const_reference RingBuffer<T, Allocator>::at(const size_type& pos) const {
-        auto index = pos;
-        if (mBuffer.size() == mCurrentCapacity) { // most common case
-            index += mNewestElementInsertionIndex;
-            if (index >= mCurrentCapacity) {
-                index -= mCurrentCapacity;
-            }
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::const_reference RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::at(const size_type& pos) const {
+        if (pos >= mSize) {
+            throw std::out_of_range("RingBuffer::at position out of range");
         }
 
-        return mBuffer.at(index);
+        return mStorage[to_storage_index(pos)];
     }
 
-    template <typename T, typename Allocator>
-    inline typename RingBuffer<T, Allocator>::iterator RingBuffer<T, Allocator>::begin() noexcept {
-        if (mBuffer.empty()) {
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::iterator RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::begin() noexcept {
+        if (mSize == 0) {
             return end();
         }
 
         return iterator{0, this};
     }
 
-    template <typename T, typename Allocator>
-    inline typename RingBuffer<T, Allocator>::iterator RingBuffer<T, Allocator>::end() noexcept {
-        return iterator{mBuffer.size(), this};
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::iterator RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::end() noexcept {
+        return iterator{mSize, this};
     }
 
-    template <typename T, typename Allocator>
-    inline typename RingBuffer<T, Allocator>::const_iterator RingBuffer<T, Allocator>::begin() const noexcept {
-        if (mBuffer.empty()) {
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::const_iterator RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::begin() const noexcept {
+        if (mSize == 0) {
             return end();
         }
 
         return const_iterator{0, this};
     } 
 
-    template <typename T, typename Allocator>
-    inline typename RingBuffer<T, Allocator>::const_iterator RingBuffer<T, Allocator>::end() const noexcept {
-        return const_iterator{mBuffer.size(), this};
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::const_iterator RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::end() const noexcept {
+        return const_iterator{mSize, this};
     }
 
-    template <typename T, typename Allocator>
-    inline typename RingBuffer<T, Allocator>::const_iterator RingBuffer<T, Allocator>::cbegin() const noexcept {
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::const_iterator RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::cbegin() const noexcept {
         return begin();
     }
 
-    template <typename T, typename Allocator>
-    inline typename RingBuffer<T, Allocator>::const_iterator RingBuffer<T, Allocator>::cend() const noexcept {
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::const_iterator RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::cend() const noexcept {
         return end();
     }
 
-    template <typename T, typename Allocator>
-    inline bool operator==(const RingBuffer<T, Allocator>& lhs, const RingBuffer<T, Allocator>& rhs) noexcept {
-        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::size_type RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::to_storage_index(const size_type pos) const noexcept {
+        // mOldestElementIndex and pos are both less than capacity, so the same expression works whether or not the buffer is full
+        return CapacityPolicy::wrap_index(mOldestElementIndex + pos, mCurrentCapacity);
     }
 
-    template <typename T, typename Allocator>
-    inline bool operator!=(const RingBuffer<T, Allocator>& lhs, const RingBuffer<T, Allocator>& rhs) noexcept {
-        return lhs.size() != rhs.size() || !std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::allocate_storage(const size_type storageCapacity) {
+        mStorage = allocator_traits::allocate(mAllocator, storageCapacity);
+        mStorageCapacity = storageCapacity;
     }
 
-    template <typename T, typename Allocator>
-    inline bool operator<(const RingBuffer<T, Allocator>& lhs, const RingBuffer<T, Allocator>& rhs) noexcept {
-        return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::deallocate_storage() noexcept {
+        if (mStorage != nullptr) {
+            allocator_traits::deallocate(mAllocator, mStorage, mStorageCapacity);
+            mStorage = nullptr;
+            mStorageCapacity = 0;
+        }
     }
 
-    template <typename T, typename Allocator>
-    inline bool operator<=(const RingBuffer<T, Allocator>& lhs, const RingBuffer<T, Allocator>& rhs) noexcept {
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    template <typename ...Args>
+    inline void RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::construct_back(Args&&... args) {
+        SIMPLE_RING_BUFFER_ASSERT(mSize < mCurrentCapacity, "RingBuffer::construct_back called on a full RingBuffer");
+        if (mStorage == nullptr) { // storage was moved out of this RingBuffer
+            allocate_storage(mCurrentCapacity);
+        }
+
+        allocator_traits::construct(mAllocator, mStorage + to_storage_index(mSize), std::forward<Args>(args)...);
+        ++mSize;
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    template <typename ...Args>
+    inline void RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::overwrite_front(Args&&... args) {
+        SIMPLE_RING_BUFFER_ASSERT(mSize == mCurrentCapacity, "RingBuffer::overwrite_front called on a RingBuffer that is not full");
+        const pointer slot = mStorage + mOldestElementIndex;
+        allocator_traits::destroy(mAllocator, slot);
+        mOldestElementIndex = CapacityPolicy::wrap_index(mOldestElementIndex + 1, mCurrentCapacity);
+        --mSize; // slot is unconstructed until the new element is in place, so a throwing constructor leaves a valid state
+
+        allocator_traits::construct(mAllocator, slot, std::forward<Args>(args)...);
+        ++mSize;
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::destroy_front(const size_type n, std::false_type) noexcept {
+        for (size_type pos = 0; pos < n; ++pos) {
+            allocator_traits::destroy(mAllocator, mStorage + to_storage_index(pos));
+        }
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::destroy_front(const size_type, std::true_type) noexcept {}
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::reallocate_storage(const size_type newCapacity) {
+        SIMPLE_RING_BUFFER_ASSERT(mSize <= newCapacity, "RingBuffer::reallocate_storage elements must fit into the new storage");
+        pointer newStorage = allocator_traits::allocate(mAllocator, newCapacity);
+
+        size_type constructedCount = 0;
+        try {
+            for (; constructedCount < mSize; ++constructedCount) {
+                allocator_traits::construct(mAllocator, newStorage + constructedCount, std::move_if_noexcept((*this)[constructedCount]));
+            }
+        }
+        catch (...) {
+            for (size_type i = 0; i < constructedCount; ++i) {
+                allocator_traits::destroy(mAllocator, newStorage + i);
+            }
+            allocator_traits::deallocate(mAllocator, newStorage, newCapacity);
+            throw;
+        }
+
+        const size_type elementCount = mSize;
+        clear();
+        deallocate_storage();
+
+        mStorage = newStorage;
+        mStorageCapacity = newCapacity;
+        mCurrentCapacity = newCapacity;
+        mOldestElementIndex = 0;
+        mSize = elementCount;
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    template <typename Iterator>
+    inline void RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::push_back_range(Iterator first, Iterator last, std::input_iterator_tag) {
+        while (first != last) {
+            push_back(*first);
+            ++first;
+        }
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    template <typename Iterator>
+    inline void RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::push_back_range(Iterator first, Iterator last, std::forward_iterator_tag) {
+        SIMPLE_RING_BUFFER_ASSERT(std::distance(first, last) >= 0, "Distance between iterators cannot be negative");
+        size_type count = static_cast<size_type>(std::distance(first, last));
+
+        if (!OverflowPolicy::overwritesOldest) {
+            // only the first elements of the range fit, the rest is rejected
+            const size_type fillCount = std::min(mCurrentCapacity - mSize, count);
+            for (size_type i = 0; i < fillCount; ++i) {
+                construct_back(*first);
+                ++first;
+            }
+            if (count > fillCount) {
+                mOverflowPolicy.on_rejected(count - fillCount);
+            }
+            return;
+        }
+
+        // only the last mCurrentCapacity elements of the range would survive this call
+        if (count > mCurrentCapacity) {
+            std::advance(first, static_cast<difference_type>(count - mCurrentCapacity));
+            count = mCurrentCapacity;
+        }
+
+        // only happens during the initial filling or after elements were removed
+        const size_type fillCount = std::min(mCurrentCapacity - mSize, count);
+        for (size_type i = 0; i < fillCount; ++i) {
+            construct_back(*first);
+            ++first;
+        }
+        count -= fillCount;
+
+        if (count == 0) {
+            return;
+        }
+
+        using use_memmove = std::integral_constant<bool,
+            std::is_pointer<Iterator>::value &&
+            std::is_same<typename std::remove_cv<typename std::remove_pointer<Iterator>::type>::type, value_type>::value &&
+            std::is_trivially_copyable<value_type>::value>;
+
+        // buffer is full, overwrite from the oldest element up to the end of the storage, then from the start of the storage
+        const size_type firstSegmentCount = std::min(count, mCurrentCapacity - mOldestElementIndex);
+        first = copy_to_storage(first, firstSegmentCount, mOldestElementIndex, use_memmove{});
+        copy_to_storage(first, count - firstSegmentCount, 0, use_memmove{});
+
+        mOldestElementIndex = CapacityPolicy::wrap_index(mOldestElementIndex + count, mCurrentCapacity);
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    template <typename Iterator>
+    inline Iterator RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::copy_to_storage(Iterator first, const size_type count, const size_type storageIndex, std::false_type) {
+        for (size_type i = 0; i < count; ++i) {
+            mStorage[storageIndex + i] = *first;
+            ++first;
+        }
+
+        return first;
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    template <typename Iterator>
+    inline Iterator RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::copy_to_storage(Iterator first, const size_type count, const size_type storageIndex, std::true_type) {
+        if (count > 0) {
+            // memmove because the source may be part of mStorage itself
+            std::memmove(mStorage + storageIndex, first, count * sizeof(value_type));
+        }
+
+        return first + static_cast<difference_type>(count);
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool operator==(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& lhs, const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rhs) noexcept {
+        return equal(lhs, rhs);
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool operator!=(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& lhs, const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rhs) noexcept {
+        return !equal(lhs, rhs);
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool operator<(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& lhs, const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rhs) noexcept {
+        return lexicographical_compare(lhs, rhs);
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool operator<=(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& lhs, const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rhs) noexcept {
         return !(rhs < lhs);
     }
 
-    template <typename T, typename Allocator>
-    inline bool operator>(const RingBuffer<T, Allocator>& lhs, const RingBuffer<T, Allocator>& rhs) noexcept {
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool operator>(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& lhs, const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rhs) noexcept {
         return rhs < lhs;
     }
 
-    template <typename T, typename Allocator>
-    inline bool operator>=(const RingBuffer<T, Allocator>& lhs, const RingBuffer<T, Allocator>& rhs) noexcept {
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool operator>=(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& lhs, const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rhs) noexcept {
         return !(lhs < rhs);
     }
 
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy, typename F>
+    inline F for_each_segment(RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rb, F f) {
+        const Segment<T> first = rb.array_one();
+        const Segment<T> second = rb.array_two();
+        if (!first.empty()) {
+            f(first);
+        }
+        if (!second.empty()) {
+            f(second);
+        }
+        return f;
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy, typename F>
+    inline F for_each_segment(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rb, F f) {
+        const Segment<const T> first = rb.array_one();
+        const Segment<const T> second = rb.array_two();
+        if (!first.empty()) {
+            f(first);
+        }
+        if (!second.empty()) {
+            f(second);
+        }
+        return f;
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy, typename OutputIt>
+    inline OutputIt copy(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rb, OutputIt out) {
+        out = std::copy(rb.array_one().begin(), rb.array_one().end(), out);
+        return std::copy(rb.array_two().begin(), rb.array_two().end(), out);
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void fill(RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rb, const T& value) {
+        std::fill(rb.array_one().begin(), rb.array_one().end(), value);
+        std::fill(rb.array_two().begin(), rb.array_two().end(), value);
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::iterator find(RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rb, const T& value) {
+        const typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::const_iterator it = find(static_cast<const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>&>(rb), value);
+        return rb.begin() + (it - rb.cbegin());
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::const_iterator find(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rb, const T& value) {
+        const Segment<const T> first = rb.array_one();
+        const T* const firstFound = std::find(first.begin(), first.end(), value);
+        if (firstFound != first.end()) {
+            return rb.begin() + (firstFound - first.begin());
+        }
+
+        const Segment<const T> second = rb.array_two();
+        const T* const secondFound = std::find(second.begin(), second.end(), value);
+        return rb.begin() + static_cast<typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::difference_type>(first.size()) + (secondFound - second.begin());
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>::difference_type count(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rb, const T& value) {
+        return std::count(rb.array_one().begin(), rb.array_one().end(), value) + std::count(rb.array_two().begin(), rb.array_two().end(), value);
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy, typename U>
+    inline U accumulate(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rb, U init) {
+        init = std::accumulate(rb.array_one().begin(), rb.array_one().end(), std::move(init));
+        return std::accumulate(rb.array_two().begin(), rb.array_two().end(), std::move(init));
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy, typename U, typename BinaryOp>
+    inline U accumulate(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rb, U init, BinaryOp op) {
+        init = std::accumulate(rb.array_one().begin(), rb.array_one().end(), std::move(init), op);
+        return std::accumulate(rb.array_two().begin(), rb.array_two().end(), std::move(init), op);
+    }
+
+    template <typename T, typename Allocator1, typename CapacityPolicy1, typename OverflowPolicy1, typename Allocator2, typename CapacityPolicy2, typename OverflowPolicy2>
+    inline bool equal(const RingBuffer<T, Allocator1, CapacityPolicy1, OverflowPolicy1>& lhs, const RingBuffer<T, Allocator2, CapacityPolicy2, OverflowPolicy2>& rhs) {
+        if (lhs.size() != rhs.size()) {
+            return false;
+        }
+
+        return detail::for_each_segment_pair(lhs, rhs, [](const T* lhsChunk, const T* rhsChunk, const std::size_t chunkSize) {
+            return detail::equal_n(lhsChunk, rhsChunk, chunkSize, detail::is_bitwise_equality_comparable<T>{});
+        });
+    }
+
+    template <typename T, typename Allocator1, typename CapacityPolicy1, typename OverflowPolicy1, typename Allocator2, typename CapacityPolicy2, typename OverflowPolicy2>
+    inline bool lexicographical_compare(const RingBuffer<T, Allocator1, CapacityPolicy1, OverflowPolicy1>& lhs, const RingBuffer<T, Allocator2, CapacityPolicy2, OverflowPolicy2>& rhs) {
+        int result = 0;
+        detail::for_each_segment_pair(lhs, rhs, [&result](const T* lhsChunk, const T* rhsChunk, const std::size_t chunkSize) {
+            result = detail::compare_n(lhsChunk, rhsChunk, chunkSize);
+            return result == 0;
+        });
+
+        return result != 0 ? result < 0 : lhs.size() < rhs.size();
+    }
+
+    namespace detail {
+        template <typename T, typename Allocator1, typename CapacityPolicy1, typename OverflowPolicy1, typename Allocator2, typename CapacityPolicy2, typename OverflowPolicy2, typename F>
+        inline bool for_each_segment_pair(const RingBuffer<T, Allocator1, CapacityPolicy1, OverflowPolicy1>& lhs, const RingBuffer<T, Allocator2, CapacityPolicy2, OverflowPolicy2>& rhs, F f) {
+            const Segment<const T> lhsSegments[2] = {lhs.array_one(), lhs.array_two()};
+            const Segment<const T> rhsSegments[2] = {rhs.array_one(), rhs.array_two()};
+            std::size_t lhsSegment = 0;
+            std::size_t rhsSegment = 0;
+            std::size_t lhsOffset = 0;
+            std::size_t rhsOffset = 0;
+
+            // a chunk ends where either of the current segments ends, so there are at most three chunks
+            std::size_t remaining = std::min(lhs.size(), rhs.size());
+            while (remaining > 0) {
+                if (lhsOffset == lhsSegments[lhsSegment].size()) {
+                    ++lhsSegment;
+                    lhsOffset = 0;
+                }
+                if (rhsOffset == rhsSegments[rhsSegment].size()) {
+                    ++rhsSegment;
+                    rhsOffset = 0;
+                }
+
+                const std::size_t chunkSize = std::min(remaining,
+                    std::min(lhsSegments[lhsSegment].size() - lhsOffset, rhsSegments[rhsSegment].size() - rhsOffset));
+                if (!f(lhsSegments[lhsSegment].data() + lhsOffset, rhsSegments[rhsSegment].data() + rhsOffset, chunkSize)) {
+                    return false;
+                }
+
+                lhsOffset += chunkSize;
+                rhsOffset += chunkSize;
+                remaining -= chunkSize;
+            }
+
+            return true;
+        }
+
+        template <typename T>
+        inline bool equal_n(const T* lhs, const T* rhs, const std::size_t count, std::false_type) {
+            return std::equal(lhs, lhs + count, rhs);
+        }
+
+        template <typename T>
+        inline bool equal_n(const T* lhs, const T* rhs, const std::size_t count, std::true_type) {
+            return std::memcmp(lhs, rhs, count * sizeof(T)) == 0;
+        }
+
+        template <typename T>
+        inline int compare_n(const T* lhs, const T* rhs, const std::size_t count) {
+            for (std::size_t i = 0; i < count; ++i) {
+                if (lhs[i] < rhs[i]) {
+                    return -1;
+                }
+                if (rhs[i] < lhs[i]) {
+                    return 1;
+                }
+            }
+            return 0;
+        }
+
+        inline int compare_n(const unsigned char* lhs, const unsigned char* rhs, const std::size_t count) {
+            return std::memcmp(lhs, rhs, count);
+        }
+    } // namespace detail
 } // namespace simpleContainers
 
+// bit-packed RingBuffer<bool> specialization, it has to be visible wherever RingBuffer is
+#include "simpleRingBufferBool.hpp"
+
 #endif // SIMPLE_RING_BUFFER_HPP
@@ -0,0 +1,1063 @@
+/// @file simpleRingBufferBool.hpp
+/// @brief File containing API and implementaiton of the bit-packed RingBuffer<bool> specialization
+
+#ifndef SIMPLE_RING_BUFFER_BOOL_HPP
+#define SIMPLE_RING_BUFFER_BOOL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// RingBuffer<bool> is declared by simpleRingBuffer.hpp, which also includes this header at its end, so including either
+// of the two headers first is fine
+#include "simpleRingBuffer.hpp"
+
+#if !defined(SIMPLE_RING_BUFFER_NO_SIMD) && (defined(__x86_64__) || defined(_M_X64))
+    /// @brief Defined to 1 when the POPCNT kernel for RingBuffer<bool> is compiled in, 0 otherwise
+    /// @details POPCNT is not part of baseline x86-64, so the kernel is only called if the CPU supports it, which is checked
+    ///          once at runtime. Define SIMPLE_RING_BUFFER_NO_SIMD before including this header to only use the portable kernel
+    #define SIMPLE_RING_BUFFER_HAS_X86_POPCNT 1
+#else
+    #define SIMPLE_RING_BUFFER_HAS_X86_POPCNT 0
+#endif // #if !defined(SIMPLE_RING_BUFFER_NO_SIMD) && (defined(__x86_64__) || defined(_M_X64))
+
+#if SIMPLE_RING_BUFFER_HAS_X86_POPCNT
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        // MSVC allows the POPCNT intrinsic in any function
+        #define SIMPLE_RING_BUFFER_TARGET_POPCNT
+    #else
+        // GCC and Clang only emit the POPCNT instruction in functions built for it
+        #define SIMPLE_RING_BUFFER_TARGET_POPCNT __attribute__((target("popcnt")))
+    #endif // #if defined(_MSC_VER) && !defined(__clang__)
+#endif // #if SIMPLE_RING_BUFFER_HAS_X86_POPCNT
+
+// ============================================================================================================================================
+// =================================================================== API ====================================================================
+// ============================================================================================================================================
+
+namespace simpleContainers {
+    namespace detail {
+        /// @brief Number of set bits in word, without relying on any CPU feature
+        unsigned popcount64(const std::uint64_t word) noexcept;
+        /// @brief Total number of set bits in count contiguous words, using the POPCNT instruction if the CPU supports it
+        std::size_t popcount_words(const std::uint64_t* words, const std::size_t count) noexcept;
+        /// @brief Mask with the lowest n bits set, n must be in range [0, 64]
+        std::uint64_t low_bits_mask(const std::size_t n) noexcept;
+
+#if SIMPLE_RING_BUFFER_HAS_X86_POPCNT
+        /// @brief True if the CPU running the program supports POPCNT. Queried on the first call only
+        bool cpu_has_popcnt() noexcept;
+        SIMPLE_RING_BUFFER_TARGET_POPCNT inline std::size_t popcount_words_popcnt(const std::uint64_t* words, const std::size_t count) noexcept;
+#endif // #if SIMPLE_RING_BUFFER_HAS_X86_POPCNT
+    } // namespace detail
+
+    /// @brief Bit-packed specialization of RingBuffer for bool
+    /// @details Elements are stored as single bits, 64 per std::uint64_t word, so a window of N flags takes N / 8 bytes instead
+    ///          of N. The bit of the element at position pos (in insertion order) is at storage index
+    ///          (oldest index + pos) wrapped around capacity(), same as for the primary template, and the storage index i is
+    ///          bit i % 64 of word i / 64. Bits of the last word past capacity() are never used.
+    ///          count(), count_last() and count(pos, n) count set elements a whole word at a time, with the POPCNT instruction
+    ///          when the CPU supports it, so they are O(n / 64) instead of O(n).
+    ///          Like std::vector<bool>, elements can not be referenced directly. Non-const access returns a proxy reference that
+    ///          converts to bool and can be assigned a bool, so iterators keep the same API as RingBuffer iterators except for
+    ///          operator->. Use `auto&&` or `const auto&` in range-for to modify or read elements.
+    ///          Only the part of the RingBuffer API that makes sense for single bits is provided: there is no data(), no
+    ///          array_one() / array_two() and no erase(). Capacity and overflow policies behave the same as for the primary template
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    class RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy> {
+        public:
+            using value_type = bool;
+            using allocator_type = Allocator;
+            using size_type = std::size_t;
+            using difference_type = std::ptrdiff_t;
+            using const_reference = bool;
+            using word_type = std::uint64_t;
+            using word_allocator_type = typename std::allocator_traits<allocator_type>::template rebind_alloc<word_type>;
+
+            SIMPLE_RING_BUFFER_STATIC_ASSERT((std::is_same<value_type, typename allocator_type::value_type>::value), "RingBuffer::value_type and RingBuffer::Allocator::value_type must be the same.");
+
+            /// @brief Proxy standing in for a reference to a single element
+            class reference {
+                public:
+                    reference(word_type* word, const word_type mask) noexcept;
+                    reference(const reference& other) noexcept = default;
+                    ~reference() noexcept = default;
+
+                    operator bool() const noexcept;
+                    reference& operator=(const bool value) noexcept;
+                    /// @brief Assigns the value of the element other refers to, not the proxy itself
+                    reference& operator=(const reference& other) noexcept;
+                    bool operator~() const noexcept;
+                    void flip() noexcept;
+
+                private:
+                    word_type* mWord;
+                    word_type mMask;
+            };
+
+            /// @brief Class representing iterators over RingBuffer<bool>
+            /// @details Same operations as RingBuffer iterators except operator->, all O(1). Like std::vector<bool>::iterator,
+            ///          the category is random access even though the reference type is a proxy
+            /// @tparam constTag Compile time indicator if iterator is a const iterator or not
+            template <bool constTag = false>
+            class RingBufferIterator {
+                public:
+                    friend class RingBufferIterator<false>;
+                    friend class RingBufferIterator<true>;
+
+                    using iterator_category = std::random_access_iterator_tag;
+                    using size_type = typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::size_type;
+                    using difference_type = typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::difference_type;
+                    using value_type = bool;
+                    using pointer = void;
+                    using reference = typename std::conditional<constTag, typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::const_reference, typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::reference>::type;
+                    using ring_buffer_ptr = typename std::conditional<constTag, const RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>*, RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>*>::type;
+
+                    /// @brief Construct iterator to the element at position pos (in insertion order) of rb
+                    RingBufferIterator(size_type pos = 0, ring_buffer_ptr rb = nullptr) noexcept;
+                    RingBufferIterator(const RingBufferIterator& other) noexcept = default;
+                    /// @brief Converting constructor to create a const iterator from a non-const iterator
+                    template <bool C = constTag, typename = typename std::enable_if<C>::type>
+                    RingBufferIterator(const RingBufferIterator<false>& other) noexcept;
+                    RingBufferIterator(RingBufferIterator&& other) noexcept = default;
+                    RingBufferIterator& operator=(const RingBufferIterator& rhs) noexcept = default;
+                    RingBufferIterator& operator=(RingBufferIterator&& rhs) noexcept = default;
+                    ~RingBufferIterator() noexcept = default;
+
+                    void swap(RingBufferIterator& other) noexcept;
+
+                    reference operator*() const noexcept;
+                    reference operator[](const difference_type n) const noexcept;
+
+                    RingBufferIterator& operator++() noexcept; // prefix
+                    RingBufferIterator operator++(int) noexcept; // postfix
+                    RingBufferIterator& operator+=(const difference_type n) noexcept;
+                    RingBufferIterator operator+(const difference_type n) const noexcept;
+                    friend RingBufferIterator operator+(const difference_type n, RingBufferIterator rhs) noexcept {
+                        rhs += n;
+                        return rhs;
+                    }
+
+                    RingBufferIterator& operator--() noexcept; // prefix
+                    RingBufferIterator operator--(int) noexcept; // postfix
+                    RingBufferIterator& operator-=(const difference_type n) noexcept;
+                    RingBufferIterator operator-(const difference_type n) const noexcept;
+                    difference_type operator-(const RingBufferIterator& other) const noexcept; // Subtraction between two iterators
+
+                    friend bool operator==(const RingBufferIterator& lhs, const RingBufferIterator& rhs) noexcept {
+                        SIMPLE_RING_BUFFER_ASSERT(lhs.mRingBufPtr == rhs.mRingBufPtr, "RingBufferIterator == comparison must be done on iterators of the same RingBuffer");
+                        return lhs.mPosition == rhs.mPosition;
+                    }
+
+                    friend bool operator!=(const RingBufferIterator& lhs, const RingBufferIterator& rhs) noexcept {
+                        SIMPLE_RING_BUFFER_ASSERT(lhs.mRingBufPtr == rhs.mRingBufPtr, "RingBufferIterator != comparison must be done on iterators of the same RingBuffer");
+                        return lhs.mPosition != rhs.mPosition;
+                    }
+
+                    friend bool operator<(const RingBufferIterator& lhs, const RingBufferIterator& rhs) noexcept {
+                        SIMPLE_RING_BUFFER_ASSERT(lhs.mRingBufPtr == rhs.mRingBufPtr, "RingBufferIterator < comparison must be done on iterators of the same RingBuffer");
+                        return lhs.mPosition < rhs.mPosition;
+                    }
+
+                    friend bool operator<=(const RingBufferIterator& lhs, const RingBufferIterator& rhs) noexcept {
+                        SIMPLE_RING_BUFFER_ASSERT(lhs.mRingBufPtr == rhs.mRingBufPtr, "RingBufferIterator <= comparison must be done on iterators of the same RingBuffer");
+                        return lhs.mPosition <= rhs.mPosition;
+                    }
+
+                    friend bool operator>(const RingBufferIterator& lhs, const RingBufferIterator& rhs) noexcept {
+                        SIMPLE_RING_BUFFER_ASSERT(lhs.mRingBufPtr == rhs.mRingBufPtr, "RingBufferIterator > comparison must be done on iterators of the same RingBuffer");
+                        return lhs.mPosition > rhs.mPosition;
+                    }
+
+                    friend bool operator>=(const RingBufferIterator& lhs, const RingBufferIterator& rhs) noexcept {
+                        SIMPLE_RING_BUFFER_ASSERT(lhs.mRingBufPtr == rhs.mRingBufPtr, "RingBufferIterator >= comparison must be done on iterators of the same RingBuffer");
+                        return lhs.mPosition >= rhs.mPosition;
+                    }
+
+                private:
+                    size_type mPosition;
+                    ring_buffer_ptr mRingBufPtr;
+            };
+
+            using iterator = RingBufferIterator<false>;
+            using const_iterator = RingBufferIterator<true>;
+
+            static constexpr size_type bitsPerWord = 64;
+            /// @brief RingBuffer cannot be constructed with 0 capacity so this arbitrary value was chosen as a default
+            static constexpr size_type defaultInitialCapacity = 64;
+
+            RingBuffer(const size_type initialCapacity = defaultInitialCapacity, const allocator_type& alloc = allocator_type{});
+            RingBuffer(const size_type initialCapacity, const value_type val, const allocator_type& alloc = allocator_type{});
+            RingBuffer(const std::vector<value_type, allocator_type>& initVec, const allocator_type& alloc = allocator_type{});
+            RingBuffer(std::initializer_list<value_type> initList, const allocator_type& alloc = allocator_type{});
+            template <typename Iterator>
+            RingBuffer(Iterator itStart, Iterator itEnd, const allocator_type& alloc = allocator_type{});
+
+            RingBuffer(const RingBuffer& other);
+            RingBuffer(RingBuffer&& other) noexcept;
+
+            /// @brief Same allocator propagation as RingBuffer::operator=(const RingBuffer&)
+            RingBuffer& operator=(const RingBuffer& rhs);
+            /// @brief Same allocator propagation as RingBuffer::operator=(RingBuffer&&)
+            RingBuffer& operator=(RingBuffer&& rhs) noexcept(std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value);
+
+            ~RingBuffer() noexcept;
+
+            allocator_type get_allocator() const noexcept;
+            /// @brief Access the overflow policy object, for example to read CountRejectedNew::rejected_count()
+            const OverflowPolicy& overflow_policy() const noexcept;
+            /// @brief Access the overflow policy object, for example to call CountRejectedNew::reset_rejected_count()
+            OverflowPolicy& overflow_policy() noexcept;
+            size_type capacity() const noexcept;
+            /// @brief Change capacity of the current RingBuffer
+            /// @details Same behavior as RingBuffer::change_capacity(): if the new capacity is lower than the current size,
+            ///          only the newest newCapacity elements are kept. Always allocates new storage, O(n)
+            void change_capacity(const size_type newCapacity);
+            size_type size() const noexcept;
+            size_type max_size() const noexcept;
+            bool empty() const noexcept;
+            bool full() const noexcept;
+            void clear() noexcept;
+            /// @brief Number of bytes of the internal storage, capacity() rounded up to whole words
+            size_type storage_bytes() const noexcept;
+
+            /// @brief Get elements in RingBuffer in order they were inserted (oldest first)
+            std::vector<value_type> get_elements() const;
+
+            /// @brief Number of elements that are true. O(size() / 64)
+            size_type count() const noexcept;
+            /// @brief Number of elements that are true among the k newest ones. O(k / 64)
+            /// @details k must not be greater than size(). This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            size_type count_last(const size_type k) const noexcept;
+            /// @brief Number of elements that are true at positions [pos, pos + n) in insertion order. O(n / 64)
+            /// @details pos + n must not be greater than size(). This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            size_type count(const size_type pos, const size_type n) const noexcept;
+
+            /// @brief Insert elem as the newest element
+            /// @details If RingBuffer is full, what happens depends on OverflowPolicy, same as for the primary template
+            void push_back(const value_type elem);
+            /// @brief Insert elem only if RingBuffer is not full, regardless of OverflowPolicy
+            /// @return true if elem was inserted
+            bool try_push_back(const value_type elem);
+            /// @brief Insert all elements in iterator range [first, last), as if push_back was called for each of them
+            template <typename Iterator>
+            void push_back(Iterator first, Iterator last);
+
+            /// @brief Swap contents with other. Allocators are swapped only if they propagate on swap, otherwise they must be
+            ///        equal. This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            void swap(RingBuffer& other) noexcept;
+
+            /// @brief Remove the oldest element. O(1)
+            /// @details RingBuffer must not be empty. This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            void pop_front() noexcept;
+            /// @brief Remove the n oldest elements. O(1)
+            /// @details n must not be greater than size(). This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            void pop_front(const size_type n) noexcept;
+            /// @brief Remove the newest element. O(1)
+            /// @details RingBuffer must not be empty. This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            void pop_back() noexcept;
+
+            /// @brief Access the oldest element
+            /// @details RingBuffer must not be empty. This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            reference front() noexcept;
+            const_reference front() const noexcept;
+            /// @brief Access the newest element
+            /// @details RingBuffer must not be empty. This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            reference back() noexcept;
+            const_reference back() const noexcept;
+            /// @brief Subscript operator
+            /// @details Indexing is done in insertion order, so the oldest element will be at position 0, the second oldest at position 1 etc.
+            ///          This operator performs out of range checks for pos only when SIMPLE_RING_BUFFER_DEBUG is defined
+            reference operator[](const size_type& pos) noexcept;
+            const_reference operator[](const size_type& pos) const noexcept;
+            /// @brief Access element at specified position
+            /// @details Indexing is done in insertion order. Validity of pos is always checked
+            reference at(const size_type& pos);
+            const_reference at(const size_type& pos) const;
+
+            iterator begin() noexcept;
+            iterator end() noexcept;
+            const_iterator begin() const noexcept;
+            const_iterator end() const noexcept;
+            const_iterator cbegin() const noexcept;
+            const_iterator cend() const noexcept;
+
+        private:
+            using word_allocator_traits = std::allocator_traits<word_allocator_type>;
+
+            static size_type words_for(const size_type bitCount) noexcept;
+
+            size_type to_storage_index(const size_type pos) const noexcept;
+            reference bit_reference(const size_type storageIndex) noexcept;
+            bool bit_value(const size_type storageIndex) const noexcept;
+            /// @brief Number of set bits at storage indices [first, last), last must not be greater than capacity()
+            size_type count_storage_range(const size_type first, const size_type last) const noexcept;
+
+            void allocate_storage();
+            void deallocate_storage() noexcept;
+            /// @brief Copy the words, oldest index, size and overflow policy of other. Both must have the same capacity
+            void copy_contents(const RingBuffer& other);
+            /// @brief Swap everything except the allocators with other
+            void swap_contents(RingBuffer& other) noexcept;
+            /// @brief Swap the allocators with other, used when the allocator propagates on the operation being done
+            void swap_allocators(RingBuffer& other, std::true_type) noexcept;
+            /// @brief Same as above, but the allocator does not propagate, so nothing is done
+            void swap_allocators(RingBuffer& other, std::false_type) noexcept;
+            /// @brief Move assignment when the allocator propagates, storage of rhs is always taken over
+            void move_assign(RingBuffer& rhs, std::true_type) noexcept;
+            /// @brief Move assignment when the allocator does not propagate, storage of rhs is taken over only if allocators are equal
+            void move_assign(RingBuffer& rhs, std::false_type);
+
+            word_allocator_type mAllocator;
+            word_type* mWords;
+            size_type mWordCount;
+            size_type mCurrentCapacity;
+            size_type mOldestElementIndex;
+            size_type mSize;
+            OverflowPolicy mOverflowPolicy;
+    };
+
+    // More specialized than the comparison operators of the primary template, which compare contiguous segments
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool operator==(const RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>& lhs, const RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>& rhs) noexcept;
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool operator!=(const RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>& lhs, const RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>& rhs) noexcept;
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool operator<(const RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>& lhs, const RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>& rhs) noexcept;
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool operator<=(const RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>& lhs, const RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>& rhs) noexcept;
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool operator>(const RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>& lhs, const RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>& rhs) noexcept;
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool operator>=(const RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>& lhs, const RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>& rhs) noexcept;
+} // namespace simpleContainers
+
+// ============================================================================================================================================
+// ============================================================== IMPLEMENTATION ==============================================================
+// ============================================================================================================================================
+
+namespace simpleContainers {
+    namespace detail {
+        inline unsigned popcount64(const std::uint64_t word) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<unsigned>(__builtin_popcountll(word));
+#else
+            std::uint64_t x = word - ((word >> 1) & 0x5555555555555555ULL);
+            x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+            x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+            return static_cast<unsigned>((x * 0x0101010101010101ULL) >> 56);
+#endif // #if defined(__GNUC__) || defined(__clang__)
+        }
+
+        inline std::size_t popcount_words(const std::uint64_t* words, const std::size_t count) noexcept {
+#if SIMPLE_RING_BUFFER_HAS_X86_POPCNT
+            if (cpu_has_popcnt()) {
+                return popcount_words_popcnt(words, count);
+            }
+#endif // #if SIMPLE_RING_BUFFER_HAS_X86_POPCNT
+            std::size_t result = 0;
+            for (std::size_t i = 0; i < count; ++i) {
+                result += popcount64(words[i]);
+            }
+            return result;
+        }
+
+        inline std::uint64_t low_bits_mask(const std::size_t n) noexcept {
+            return n >= 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << n) - 1;
+        }
+
+#if SIMPLE_RING_BUFFER_HAS_X86_POPCNT
+        inline bool cpu_has_popcnt() noexcept {
+    #if defined(_MSC_VER) && !defined(__clang__)
+            static const bool supported = []() {
+                int registers[4] = {0, 0, 0, 0};
+                __cpuid(registers, 1);
+                return (registers[2] & (1 << 23)) != 0;
+            }();
+    #else
+            static const bool supported = []() {
+                __builtin_cpu_init();
+                return __builtin_cpu_supports("popcnt") != 0;
+            }();
+    #endif // #if defined(_MSC_VER) && !defined(__clang__)
+            return supported;
+        }
+
+        SIMPLE_RING_BUFFER_TARGET_POPCNT inline std::size_t popcount_words_popcnt(const std::uint64_t* words, const std::size_t count) noexcept {
+            // four independent sums, so consecutive POPCNT instructions do not wait on each other
+            std::size_t sums[4] = {0, 0, 0, 0};
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+    #if defined(_MSC_VER) && !defined(__clang__)
+                sums[0] += __popcnt64(words[i]);
+                sums[1] += __popcnt64(words[i + 1]);
+                sums[2] += __popcnt64(words[i + 2]);
+                sums[3] += __popcnt64(words[i + 3]);
+    #else
+                sums[0] += static_cast<std::size_t>(__builtin_popcountll(words[i]));
+                sums[1] += static_cast<std::size_t>(__builtin_popcountll(words[i + 1]));
+                sums[2] += static_cast<std::size_t>(__builtin_popcountll(words[i + 2]));
+                sums[3] += static_cast<std::size_t>(__builtin_popcountll(words[i + 3]));
+    #endif // #if defined(_MSC_VER) && !defined(__clang__)
+            }
+            for (; i < count; ++i) {
+    #if defined(_MSC_VER) && !defined(__clang__)
+                sums[0] += __popcnt64(words[i]);
+    #else
+                sums[0] += static_cast<std::size_t>(__builtin_popcountll(words[i]));
+    #endif // #if defined(_MSC_VER) && !defined(__clang__)
+            }
+            return sums[0] + sums[1] + sums[2] + sums[3];
+        }
+#endif // #if SIMPLE_RING_BUFFER_HAS_X86_POPCNT
+    } // namespace detail
+
+    // ---------------------------------------------------------------- reference ---------------------------------------------------------------
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::reference::reference(word_type* word, const word_type mask) noexcept
+        : mWord{word}, mMask{mask}
+    {}
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::reference::operator bool() const noexcept {
+        return (*mWord & mMask) != 0;
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::reference&
+    RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::reference::operator=(const bool value) noexcept {
+        if (value) {
+            *mWord |= mMask;
+        }
+        else {
+            *mWord &= ~mMask;
+        }
+        return *this;
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::reference&
+    RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::reference::operator=(const reference& other) noexcept {
+        return *this = static_cast<bool>(other);
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::reference::operator~() const noexcept {
+        return (*mWord & mMask) == 0;
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::reference::flip() noexcept {
+        *mWord ^= mMask;
+    }
+
+    // ---------------------------------------------------------------- iterator ----------------------------------------------------------------
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    template <bool constTag>
+    inline RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::RingBufferIterator<constTag>::RingBufferIterator(size_type pos, ring_buffer_ptr rb) noexcept
+        : mPosition{pos}, mRingBufPtr{rb}
+    {}
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    template <bool constTag>
+    template <bool C, typename>
+    inline RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::RingBufferIterator<constTag>::RingBufferIterator(const RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::RingBufferIterator<false>& other) noexcept
+        : mPosition{other.mPosition}, mRingBufPtr{other.mRingBufPtr}
+    {}
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    template <bool constTag>
+    inline void RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::RingBufferIterator<constTag>::swap(RingBufferIterator& other) noexcept {
+        std::swap(mPosition, other.mPosition);
+        std::swap(mRingBufPtr, other.mRingBufPtr);
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    template <bool constTag>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::template RingBufferIterator<constTag>::reference
+    RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::RingBufferIterator<constTag>::operator*() const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(mRingBufPtr != nullptr, "RingBufferIterator::operator* trying to dereference mRingBufPtr which is a nullptr");
+        return (*mRingBufPtr)[mPosition];
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    template <bool constTag>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::template RingBufferIterator<constTag>::reference
+    RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::RingBufferIterator<constTag>::operator[](const difference_type n) const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(mRingBufPtr != nullptr, "RingBufferIterator::operator[] trying to dereference mRingBufPtr which is a nullptr");
+        return (*mRingBufPtr)[mPosition + static_cast<size_type>(n)];
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    template <bool constTag>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::template RingBufferIterator<constTag>&
+    RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::RingBufferIterator<constTag>::operator++() noexcept {
+        ++mPosition;
+        return *this;
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    template <bool constTag>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::template RingBufferIterator<constTag>
+    RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::RingBufferIterator<constTag>::operator++(int) noexcept {
+        RingBufferIterator tmp = *this;
+        ++(*this);
+        return tmp;
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    template <bool constTag>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::template RingBufferIterator<constTag>&
+    RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::RingBufferIterator<constTag>::operator+=(const difference_type n) noexcept {
+        mPosition += static_cast<size_type>(n);
+        return *this;
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    template <bool constTag>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::template RingBufferIterator<constTag>
+    RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::RingBufferIterator<constTag>::operator+(const difference_type n) const noexcept {
+        return RingBufferIterator<constTag>(mPosition + static_cast<size_type>(n), mRingBufPtr);
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    template <bool constTag>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::template RingBufferIterator<constTag>&
+    RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::RingBufferIterator<constTag>::operator--() noexcept {
+        --mPosition;
+        return *this;
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    template <bool constTag>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::template RingBufferIterator<constTag>
+    RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::RingBufferIterator<constTag>::operator--(int) noexcept {
+        RingBufferIterator tmp = *this;
+        --(*this);
+        return tmp;
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    template <bool constTag>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::template RingBufferIterator<constTag>&
+    RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::RingBufferIterator<constTag>::operator-=(const difference_type n) noexcept {
+        mPosition -= static_cast<size_type>(n);
+        return *this;
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    template <bool constTag>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::template RingBufferIterator<constTag>
+    RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::RingBufferIterator<constTag>::operator-(const difference_type n) const noexcept {
+        return RingBufferIterator<constTag>(mPosition - static_cast<size_type>(n), mRingBufPtr);
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    template <bool constTag>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::template RingBufferIterator<constTag>::difference_type
+    RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::RingBufferIterator<constTag>::operator-(const RingBufferIterator& other) const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(mRingBufPtr == other.mRingBufPtr, "RingBufferIterator subtraction must be done on iterators of the same RingBuffer");
+        return static_cast<difference_type>(mPosition) - static_cast<difference_type>(other.mPosition);
+    }
+
+    // --------------------------------------------------------------- RingBuffer ---------------------------------------------------------------
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    constexpr typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::size_type RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::bitsPerWord;
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    constexpr typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::size_type RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::defaultInitialCapacity;
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::RingBuffer(const size_type initialCapacity, const allocator_type& alloc)
+        : mAllocator(alloc), mWords{nullptr}, mWordCount{0}, mCurrentCapacity{CapacityPolicy::adjust_capacity(initialCapacity)}, mOldestElementIndex{0}, mSize{0}, mOverflowPolicy{}
+    {
+        SIMPLE_RING_BUFFER_ASSERT(initialCapacity != 0, "RingBuffer must not be constructed with initial capacity of 0");
+        allocate_storage();
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::RingBuffer(const size_type initialCapacity, const value_type val, const allocator_type& alloc)
+        : RingBuffer(initialCapacity, alloc)
+    {
+        for (size_type i = 0; i < initialCapacity; ++i) {
+            push_back(val);
+        }
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::RingBuffer(const std::vector<value_type, allocator_type>& initVec, const allocator_type& alloc)
+        : RingBuffer(initVec.begin(), initVec.end(), alloc)
+    {
+        SIMPLE_RING_BUFFER_ASSERT(initVec.size() != 0, "RingBuffer must not be constructed from an empty std::vector");
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::RingBuffer(std::initializer_list<value_type> initList, const allocator_type& alloc)
+        : RingBuffer(initList.begin(), initList.end(), alloc)
+    {
+        SIMPLE_RING_BUFFER_ASSERT(initList.size() != 0, "RingBuffer must not be constructed from an empty std::initializer_list");
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    template <typename Iterator>
+    inline RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::RingBuffer(Iterator itStart, Iterator itEnd, const allocator_type& alloc)
+        : RingBuffer(static_cast<size_type>(std::distance(itStart, itEnd)), alloc)
+    {
+        SIMPLE_RING_BUFFER_ASSERT(std::distance(itStart, itEnd) >= 0, "Distance between iterators cannot be negative");
+        push_back(itStart, itEnd);
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::RingBuffer(const RingBuffer& other)
+        : RingBuffer(other.mCurrentCapacity, allocator_type(word_allocator_traits::select_on_container_copy_construction(other.mAllocator)))
+    {
+        copy_contents(other);
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::RingBuffer(RingBuffer&& other) noexcept
+        : mAllocator{std::move(other.mAllocator)}, mWords{other.mWords}, mWordCount{other.mWordCount},
+          mCurrentCapacity{other.mCurrentCapacity}, mOldestElementIndex{other.mOldestElementIndex}, mSize{other.mSize},
+          mOverflowPolicy{other.mOverflowPolicy}
+    {
+        // other keeps its capacity so that it can still be used, but it needs new storage for that
+        other.mWords = nullptr;
+        other.mWordCount = 0;
+        other.mOldestElementIndex = 0;
+        other.mSize = 0;
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>& RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::operator=(const RingBuffer& rhs) {
+        if (this != &rhs) {
+            using propagate = typename word_allocator_traits::propagate_on_container_copy_assignment;
+
+            // the copy is made with the allocator this RingBuffer ends up with, so its storage can simply be swapped in
+            RingBuffer tmp(rhs.mCurrentCapacity, allocator_type(propagate::value ? rhs.mAllocator : mAllocator));
+            tmp.copy_contents(rhs);
+
+            swap_contents(tmp);
+            // tmp now owns the old storage, so it also needs the allocator that storage came from
+            swap_allocators(tmp, propagate{});
+        }
+
+        return *this;
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>& RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::operator=(RingBuffer&& rhs) noexcept(std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value) {
+        if (this != &rhs) {
+            move_assign(rhs, typename word_allocator_traits::propagate_on_container_move_assignment{});
+        }
+
+        return *this;
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::~RingBuffer() noexcept {
+        deallocate_storage();
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::allocator_type RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::get_allocator() const noexcept {
+        return allocator_type(mAllocator);
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline const OverflowPolicy& RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::overflow_policy() const noexcept {
+        return mOverflowPolicy;
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline OverflowPolicy& RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::overflow_policy() noexcept {
+        return mOverflowPolicy;
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::size_type RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::capacity() const noexcept {
+        return mCurrentCapacity;
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::change_capacity(const size_type newCapacity) {
+        SIMPLE_RING_BUFFER_ASSERT(newCapacity != 0, "RingBuffer capacity must not be changed to 0");
+        RingBuffer tmp(newCapacity, get_allocator());
+        const size_type keptCount = std::min(mSize, tmp.mCurrentCapacity);
+        for (size_type pos = mSize - keptCount; pos < mSize; ++pos) {
+            tmp.push_back(static_cast<bool>((*this)[pos]));
+        }
+        tmp.mOverflowPolicy = mOverflowPolicy;
+        swap(tmp);
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::size_type RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::size() const noexcept {
+        return mSize;
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::size_type RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::max_size() const noexcept {
+        const size_type maxWords = word_allocator_traits::max_size(mAllocator);
+        return maxWords > std::numeric_limits<size_type>::max() / bitsPerWord ? std::numeric_limits<size_type>::max() : maxWords * bitsPerWord;
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::empty() const noexcept {
+        return mSize == 0;
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::full() const noexcept {
+        return mSize == mCurrentCapacity;
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::clear() noexcept {
+        mOldestElementIndex = 0;
+        mSize = 0;
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::size_type RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::storage_bytes() const noexcept {
+        return words_for(mCurrentCapacity) * sizeof(word_type);
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline std::vector<typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::value_type> RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::get_elements() const {
+        return std::vector<value_type>(cbegin(), cend());
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::size_type RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::count() const noexcept {
+        return count(0, mSize);
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::size_type RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::count_last(const size_type k) const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(k <= mSize, "RingBuffer::count_last called with more elements than there are in RingBuffer");
+        return count(mSize - k, k);
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::size_type RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::count(const size_type pos, const size_type n) const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(pos <= mSize && n <= mSize - pos, "RingBuffer::count range out of range");
+        if (n == 0) {
+            return 0;
+        }
+
+        // the range is at most two runs of storage indices, split where it wraps around the end of the storage
+        const size_type first = to_storage_index(pos);
+        const size_type firstCount = std::min(n, mCurrentCapacity - first);
+        size_type result = count_storage_range(first, first + firstCount);
+        if (firstCount < n) {
+            result += count_storage_range(0, n - firstCount);
+        }
+        return result;
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::push_back(const value_type elem) {
+        if (mSize == mCurrentCapacity) {   // most common case
+            if (!OverflowPolicy::overwritesOldest) {
+                mOverflowPolicy.on_rejected(1);
+            }
+            else {
+                bit_reference(mOldestElementIndex) = elem;
+                mOldestElementIndex = CapacityPolicy::wrap_index(mOldestElementIndex + 1, mCurrentCapacity);
+            }
+        }
+        else { // only happens during the initial filling or after elements were removed
+            if (mWords == nullptr) { // storage was moved out of this RingBuffer
+                allocate_storage();
+            }
+            bit_reference(to_storage_index(mSize)) = elem;
+            ++mSize;
+        }
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::try_push_back(const value_type elem) {
+        if (mSize == mCurrentCapacity) {
+            mOverflowPolicy.on_rejected(1);
+            return false;
+        }
+
+        push_back(elem);
+        return true;
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    template <typename Iterator>
+    inline void RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::push_back(Iterator first, Iterator last) {
+        for (; first != last; ++first) {
+            push_back(static_cast<bool>(*first));
+        }
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::swap(RingBuffer& other) noexcept {
+        using propagate = typename word_allocator_traits::propagate_on_container_swap;
+        SIMPLE_RING_BUFFER_ASSERT(propagate::value || mAllocator == other.mAllocator, "RingBuffer::swap called with unequal allocators that do not propagate on swap");
+
+        swap_allocators(other, propagate{});
+        swap_contents(other);
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::swap_contents(RingBuffer& other) noexcept {
+        using std::swap;
+        swap(mWords, other.mWords);
+        swap(mWordCount, other.mWordCount);
+        swap(mCurrentCapacity, other.mCurrentCapacity);
+        swap(mOldestElementIndex, other.mOldestElementIndex);
+        swap(mSize, other.mSize);
+        swap(mOverflowPolicy, other.mOverflowPolicy);
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::swap_allocators(RingBuffer& other, std::true_type) noexcept {
+        using std::swap;
+        swap(mAllocator, other.mAllocator);
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::swap_allocators(RingBuffer&, std::false_type) noexcept {}
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::move_assign(RingBuffer& rhs, std::true_type) noexcept {
+        RingBuffer tmp{std::move(rhs)};
+        swap_contents(tmp);
+        swap_allocators(tmp, std::true_type{});
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::move_assign(RingBuffer& rhs, std::false_type) {
+        if (mAllocator == rhs.mAllocator) {
+            // storage of rhs can be released through this RingBuffer's allocator, so it is taken over as is
+            RingBuffer tmp{std::move(rhs)};
+            swap_contents(tmp);
+            return;
+        }
+
+        // storage of rhs must stay with its own allocator, only the bits are copied
+        RingBuffer tmp(rhs.mCurrentCapacity, allocator_type(mAllocator));
+        tmp.copy_contents(rhs);
+        swap_contents(tmp);
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::pop_front() noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(mSize != 0, "RingBuffer::pop_front called on an empty RingBuffer");
+        pop_front(1);
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::pop_front(const size_type n) noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(n <= mSize, "RingBuffer::pop_front called with more elements than there are in RingBuffer");
+        mOldestElementIndex = to_storage_index(n);
+        mSize -= n;
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::pop_back() noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(mSize != 0, "RingBuffer::pop_back called on an empty RingBuffer");
+        --mSize;
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::reference RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::front() noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(mSize != 0, "RingBuffer::front called on an empty RingBuffer");
+        return bit_reference(mOldestElementIndex);
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::const_reference RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::front() const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(mSize != 0, "RingBuffer::front called on an empty RingBuffer");
+        return bit_value(mOldestElementIndex);
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::reference RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::back() noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(mSize != 0, "RingBuffer::back called on an empty RingBuffer");
+        return bit_reference(to_storage_index(mSize - 1));
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::const_reference RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::back() const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(mSize != 0, "RingBuffer::back called on an empty RingBuffer");
+        return bit_value(to_storage_index(mSize - 1));
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::reference RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::operator[](const size_type& pos) noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(pos < mSize, "RingBuffer::operator[] position out of range");
+        return bit_reference(to_storage_index(pos));
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::const_reference RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::operator[](const size_type& pos) const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(pos < mSize, "RingBuffer::operator[] position out of range");
+        return bit_value(to_storage_index(pos));
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::reference RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::at(const size_type& pos) {
+        if (pos >= mSize) {
+            throw std::out_of_range("RingBuffer::at position out of range");
+        }
+        return (*this)[pos];
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::const_reference RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::at(const size_type& pos) const {
+        if (pos >= mSize) {
+            throw std::out_of_range("RingBuffer::at position out of range");
+        }
+        return (*this)[pos];
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::iterator RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::begin() noexcept {
+        return iterator(0, this);
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::iterator RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::end() noexcept {
+        return iterator(mSize, this);
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::const_iterator RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::begin() const noexcept {
+        return const_iterator(0, this);
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::const_iterator RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::end() const noexcept {
+        return const_iterator(mSize, this);
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::const_iterator RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::cbegin() const noexcept {
+        return const_iterator(0, this);
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::const_iterator RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::cend() const noexcept {
+        return const_iterator(mSize, this);
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::size_type RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::words_for(const size_type bitCount) noexcept {
+        return (bitCount + bitsPerWord - 1) / bitsPerWord;
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::size_type RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::to_storage_index(const size_type pos) const noexcept {
+        return CapacityPolicy::wrap_index(mOldestElementIndex + pos, mCurrentCapacity);
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::reference RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::bit_reference(const size_type storageIndex) noexcept {
+        return reference(mWords + storageIndex / bitsPerWord, word_type{1} << (storageIndex % bitsPerWord));
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::bit_value(const size_type storageIndex) const noexcept {
+        return ((mWords[storageIndex / bitsPerWord] >> (storageIndex % bitsPerWord)) & 1) != 0;
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline typename RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::size_type RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::count_storage_range(const size_type first, const size_type last) const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(first < last && last <= mCurrentCapacity, "RingBuffer::count_storage_range invalid range");
+        const size_type firstWord = first / bitsPerWord;
+        const size_type lastWord = (last - 1) / bitsPerWord;
+        const word_type firstMask = ~word_type{0} << (first % bitsPerWord);
+        const word_type lastMask = detail::low_bits_mask((last - 1) % bitsPerWord + 1);
+
+        if (firstWord == lastWord) {
+            return detail::popcount64(mWords[firstWord] & firstMask & lastMask);
+        }
+
+        return detail::popcount64(mWords[firstWord] & firstMask)
+            + detail::popcount_words(mWords + firstWord + 1, lastWord - firstWord - 1)
+            + detail::popcount64(mWords[lastWord] & lastMask);
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::allocate_storage() {
+        const size_type wordCount = words_for(mCurrentCapacity);
+        mWords = word_allocator_traits::allocate(mAllocator, wordCount);
+        mWordCount = wordCount;
+        std::fill(mWords, mWords + mWordCount, word_type{0});
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::deallocate_storage() noexcept {
+        if (mWords != nullptr) {
+            word_allocator_traits::deallocate(mAllocator, mWords, mWordCount);
+            mWords = nullptr;
+            mWordCount = 0;
+        }
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline void RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>::copy_contents(const RingBuffer& other) {
+        SIMPLE_RING_BUFFER_ASSERT(mCurrentCapacity == other.mCurrentCapacity, "RingBuffer::copy_contents called with a different capacity");
+        // bits are copied word by word, so the copy keeps the same oldest index
+        if (other.mWords != nullptr) {
+            std::copy(other.mWords, other.mWords + other.mWordCount, mWords);
+            mOldestElementIndex = other.mOldestElementIndex;
+            mSize = other.mSize;
+        }
+        mOverflowPolicy = other.mOverflowPolicy;
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool operator==(const RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>& lhs, const RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>& rhs) noexcept {
+        return lhs.size() == rhs.size() && std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin());
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool operator!=(const RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>& lhs, const RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>& rhs) noexcept {
+        return !(lhs == rhs);
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool operator<(const RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>& lhs, const RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>& rhs) noexcept {
+        return std::lexicographical_compare(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend());
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool operator<=(const RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>& lhs, const RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>& rhs) noexcept {
+        return !(rhs < lhs);
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool operator>(const RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>& lhs, const RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>& rhs) noexcept {
+        return rhs < lhs;
+    }
+
+    template <typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline bool operator>=(const RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>& lhs, const RingBuffer<bool, Allocator, CapacityPolicy, OverflowPolicy>& rhs) noexcept {
+        return !(lhs < rhs);
+    }
+} // namespace simpleContainers
+
+#endif // SIMPLE_RING_BUFFER_BOOL_HPP
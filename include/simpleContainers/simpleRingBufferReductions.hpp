@@ -0,0 +1,603 @@
+/// @file simpleRingBufferReductions.hpp
+/// @brief File containing API and implementaiton of vectorized reductions over RingBuffer elements
+
+#ifndef SIMPLE_RING_BUFFER_REDUCTIONS_HPP
+#define SIMPLE_RING_BUFFER_REDUCTIONS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "simpleRingBuffer.hpp"
+
+#if !defined(SIMPLE_RING_BUFFER_NO_SIMD) && (defined(__x86_64__) || defined(_M_X64))
+    /// @brief Defined to 1 when SSE2 and AVX2 reduction kernels are compiled in, 0 otherwise
+    /// @details SSE2 is part of every x86-64 CPU, AVX2 kernels are only called if the CPU supports them, which is checked
+    ///          once at runtime. Define SIMPLE_RING_BUFFER_NO_SIMD before including this header to only use scalar kernels
+    #define SIMPLE_RING_BUFFER_HAS_X86_SIMD 1
+#else
+    #define SIMPLE_RING_BUFFER_HAS_X86_SIMD 0
+#endif // #if !defined(SIMPLE_RING_BUFFER_NO_SIMD) && (defined(__x86_64__) || defined(_M_X64))
+
+#if SIMPLE_RING_BUFFER_HAS_X86_SIMD
+    #include <immintrin.h>
+
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        // MSVC allows AVX2 intrinsics in any function
+        #define SIMPLE_RING_BUFFER_TARGET_AVX2
+    #else
+        // GCC and Clang need AVX2 code generation enabled per function, since the rest of the program may not be built for it
+        #define SIMPLE_RING_BUFFER_TARGET_AVX2 __attribute__((target("avx2")))
+    #endif // #if defined(_MSC_VER) && !defined(__clang__)
+#endif // #if SIMPLE_RING_BUFFER_HAS_X86_SIMD
+
+// ============================================================================================================================================
+// =================================================================== API ====================================================================
+// ============================================================================================================================================
+
+/// @brief Namespace containing all relevant classes and functions
+namespace simpleContainers {
+    /// @brief Instruction sets that reduction kernels can use, ordered from the least to the most capable
+    enum class SimdLevel {
+        Scalar,
+        Sse2,
+        Avx2
+    };
+
+    /// @brief Most capable SimdLevel supported by both the build and the CPU running the program
+    /// @details CPU features are queried on the first call only
+    SimdLevel detected_simd_level() noexcept;
+
+    // Reductions over all elements of a RingBuffer. Each of them walks both contiguous parts of RingBuffer (see
+    // RingBuffer::array_one() and RingBuffer::array_two()). Kernels vectorized with SSE2 and AVX2 exist for double and
+    // std::int64_t elements, all other arithmetic types use the scalar kernel. level can be lowered to force a less capable
+    // kernel, for example to compare results, levels above detected_simd_level() are lowered to it.
+    // Vectorized kernels for double add elements in a different order than the scalar one, so sums and dot products can
+    // differ from it by rounding. Results are unspecified if elements are NaN, and integer overflow behaves like it does
+    // for std::accumulate
+
+    /// @brief Sum of all elements, 0 for an empty RingBuffer
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    T window_sum(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rb, const SimdLevel level = detected_simd_level());
+    /// @brief Smallest element. RingBuffer must not be empty. This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    T window_min(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rb, const SimdLevel level = detected_simd_level());
+    /// @brief Largest element. RingBuffer must not be empty. This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    T window_max(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rb, const SimdLevel level = detected_simd_level());
+    /// @brief Arithmetic mean of all elements. RingBuffer must not be empty. This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+    /// @details Unlike window_sum, elements narrower than 64 bits are summed as double, std::int64_t or std::uint64_t, so
+    ///          the mean of a full window of small integers does not overflow
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    double window_mean(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rb, const SimdLevel level = detected_simd_level());
+    /// @brief Sum of products of elements at the same positions (in insertion order) of lhs and rhs
+    /// @details lhs and rhs must have the same size. This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined.
+    ///          There is no vectorized kernel for std::int64_t, since neither SSE2 nor AVX2 can multiply 64 bit integers
+    template <typename T, typename Allocator1, typename CapacityPolicy1, typename OverflowPolicy1, typename Allocator2, typename CapacityPolicy2, typename OverflowPolicy2>
+    T window_dot(const RingBuffer<T, Allocator1, CapacityPolicy1, OverflowPolicy1>& lhs, const RingBuffer<T, Allocator2, CapacityPolicy2, OverflowPolicy2>& rhs,
+        const SimdLevel level = detected_simd_level());
+
+    namespace detail {
+        SimdLevel query_simd_level() noexcept;
+
+        // Kernels over count contiguous elements. The templates are the scalar fallback for every arithmetic type, the
+        // overloads for double and std::int64_t dispatch on level
+        template <typename T>
+        T sum_kernel(const T* data, const std::size_t count, const SimdLevel level);
+        template <typename T>
+        T min_kernel(const T* data, const std::size_t count, const SimdLevel level);
+        template <typename T>
+        T max_kernel(const T* data, const std::size_t count, const SimdLevel level);
+        template <typename T>
+        T dot_kernel(const T* lhs, const T* rhs, const std::size_t count, const SimdLevel level);
+
+        // Type used by window_mean to sum elements of type T
+        template <typename T>
+        using widened_sum_type = typename std::conditional<std::is_floating_point<T>::value, double,
+            typename std::conditional<std::is_signed<T>::value, std::int64_t, std::uint64_t>::type>::type;
+
+        template <typename T>
+        widened_sum_type<T> widened_sum_kernel(const T* data, const std::size_t count, const SimdLevel level);
+        inline double widened_sum_kernel(const double* data, const std::size_t count, const SimdLevel level);
+        inline std::int64_t widened_sum_kernel(const std::int64_t* data, const std::size_t count, const SimdLevel level);
+
+        inline double sum_kernel(const double* data, const std::size_t count, const SimdLevel level);
+        inline double min_kernel(const double* data, const std::size_t count, const SimdLevel level);
+        inline double max_kernel(const double* data, const std::size_t count, const SimdLevel level);
+        inline double dot_kernel(const double* lhs, const double* rhs, const std::size_t count, const SimdLevel level);
+        inline std::int64_t sum_kernel(const std::int64_t* data, const std::size_t count, const SimdLevel level);
+        inline std::int64_t min_kernel(const std::int64_t* data, const std::size_t count, const SimdLevel level);
+        inline std::int64_t max_kernel(const std::int64_t* data, const std::size_t count, const SimdLevel level);
+
+#if SIMPLE_RING_BUFFER_HAS_X86_SIMD
+        inline double sum_sse2(const double* data, const std::size_t count);
+        inline double min_sse2(const double* data, const std::size_t count);
+        inline double max_sse2(const double* data, const std::size_t count);
+        inline double dot_sse2(const double* lhs, const double* rhs, const std::size_t count);
+        inline std::int64_t sum_sse2(const std::int64_t* data, const std::size_t count);
+
+        SIMPLE_RING_BUFFER_TARGET_AVX2 inline double sum_avx2(const double* data, const std::size_t count);
+        SIMPLE_RING_BUFFER_TARGET_AVX2 inline double min_avx2(const double* data, const std::size_t count);
+        SIMPLE_RING_BUFFER_TARGET_AVX2 inline double max_avx2(const double* data, const std::size_t count);
+        SIMPLE_RING_BUFFER_TARGET_AVX2 inline double dot_avx2(const double* lhs, const double* rhs, const std::size_t count);
+        SIMPLE_RING_BUFFER_TARGET_AVX2 inline std::int64_t sum_avx2(const std::int64_t* data, const std::size_t count);
+        SIMPLE_RING_BUFFER_TARGET_AVX2 inline std::int64_t min_avx2(const std::int64_t* data, const std::size_t count);
+        SIMPLE_RING_BUFFER_TARGET_AVX2 inline std::int64_t max_avx2(const std::int64_t* data, const std::size_t count);
+#endif // #if SIMPLE_RING_BUFFER_HAS_X86_SIMD
+    } // namespace detail
+} // namespace simpleContainers
+
+// ============================================================================================================================================
+// ============================================================== IMPLEMENTATION ==============================================================
+// ============================================================================================================================================
+
+namespace simpleContainers {
+    inline SimdLevel detected_simd_level() noexcept {
+        static const SimdLevel level = detail::query_simd_level();
+        return level;
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline T window_sum(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rb, const SimdLevel level) {
+        SIMPLE_RING_BUFFER_STATIC_ASSERT(std::is_arithmetic<T>::value, "window_sum requires an arithmetic element type");
+        const SimdLevel usedLevel = std::min(level, detected_simd_level());
+        const Segment<const T> first = rb.array_one();
+        const Segment<const T> second = rb.array_two();
+        return static_cast<T>(detail::sum_kernel(first.data(), first.size(), usedLevel) + detail::sum_kernel(second.data(), second.size(), usedLevel));
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline T window_min(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rb, const SimdLevel level) {
+        SIMPLE_RING_BUFFER_STATIC_ASSERT(std::is_arithmetic<T>::value, "window_min requires an arithmetic element type");
+        SIMPLE_RING_BUFFER_ASSERT(!rb.empty(), "window_min called on an empty RingBuffer");
+        const SimdLevel usedLevel = std::min(level, detected_simd_level());
+        const Segment<const T> first = rb.array_one();
+        const Segment<const T> second = rb.array_two();
+        const T firstMin = detail::min_kernel(first.data(), first.size(), usedLevel);
+        return second.empty() ? firstMin : std::min(firstMin, detail::min_kernel(second.data(), second.size(), usedLevel));
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline T window_max(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rb, const SimdLevel level) {
+        SIMPLE_RING_BUFFER_STATIC_ASSERT(std::is_arithmetic<T>::value, "window_max requires an arithmetic element type");
+        SIMPLE_RING_BUFFER_ASSERT(!rb.empty(), "window_max called on an empty RingBuffer");
+        const SimdLevel usedLevel = std::min(level, detected_simd_level());
+        const Segment<const T> first = rb.array_one();
+        const Segment<const T> second = rb.array_two();
+        const T firstMax = detail::max_kernel(first.data(), first.size(), usedLevel);
+        return second.empty() ? firstMax : std::max(firstMax, detail::max_kernel(second.data(), second.size(), usedLevel));
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy, typename OverflowPolicy>
+    inline double window_mean(const RingBuffer<T, Allocator, CapacityPolicy, OverflowPolicy>& rb, const SimdLevel level) {
+        SIMPLE_RING_BUFFER_STATIC_ASSERT(std::is_arithmetic<T>::value, "window_mean requires an arithmetic element type");
+        SIMPLE_RING_BUFFER_ASSERT(!rb.empty(), "window_mean called on an empty RingBuffer");
+        const SimdLevel usedLevel = std::min(level, detected_simd_level());
+        const Segment<const T> first = rb.array_one();
+        const Segment<const T> second = rb.array_two();
+        const detail::widened_sum_type<T> sum = detail::widened_sum_kernel(first.data(), first.size(), usedLevel) + detail::widened_sum_kernel(second.data(), second.size(), usedLevel);
+        return static_cast<double>(sum) / static_cast<double>(rb.size());
+    }
+
+    template <typename T, typename Allocator1, typename CapacityPolicy1, typename OverflowPolicy1, typename Allocator2, typename CapacityPolicy2, typename OverflowPolicy2>
+    inline T window_dot(const RingBuffer<T, Allocator1, CapacityPolicy1, OverflowPolicy1>& lhs, const RingBuffer<T, Allocator2, CapacityPolicy2, OverflowPolicy2>& rhs,
+        const SimdLevel level)
+    {
+        SIMPLE_RING_BUFFER_STATIC_ASSERT(std::is_arithmetic<T>::value, "window_dot requires an arithmetic element type");
+        SIMPLE_RING_BUFFER_ASSERT(lhs.size() == rhs.size(), "window_dot called on RingBuffers of different sizes");
+        const SimdLevel usedLevel = std::min(level, detected_simd_level());
+
+        T result = T{};
+        detail::for_each_segment_pair(lhs, rhs, [&result, usedLevel](const T* lhsChunk, const T* rhsChunk, const std::size_t chunkSize) {
+            result = static_cast<T>(result + detail::dot_kernel(lhsChunk, rhsChunk, chunkSize, usedLevel));
+            return true;
+        });
+        return result;
+    }
+
+    namespace detail {
+        inline SimdLevel query_simd_level() noexcept {
+#if SIMPLE_RING_BUFFER_HAS_X86_SIMD
+    #if defined(_MSC_VER) && !defined(__clang__)
+            // AVX2 needs support from the CPU (leaf 7) and the OS saving the upper halves of the registers (OSXSAVE and XCR0)
+            int registers[4] = {0, 0, 0, 0};
+            __cpuid(registers, 0);
+            const int maxLeaf = registers[0];
+            __cpuid(registers, 1);
+            const bool osSavesAvxState = (registers[2] & (1 << 27)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+            if (maxLeaf >= 7 && osSavesAvxState) {
+                __cpuidex(registers, 7, 0);
+                if ((registers[1] & (1 << 5)) != 0) {
+                    return SimdLevel::Avx2;
+                }
+            }
+    #else
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2")) {
+                return SimdLevel::Avx2;
+            }
+    #endif // #if defined(_MSC_VER) && !defined(__clang__)
+            return SimdLevel::Sse2;
+#else
+            return SimdLevel::Scalar;
+#endif // #if SIMPLE_RING_BUFFER_HAS_X86_SIMD
+        }
+
+        template <typename T>
+        inline T sum_kernel(const T* data, const std::size_t count, const SimdLevel) {
+            T result = T{};
+            for (std::size_t i = 0; i < count; ++i) {
+                result = static_cast<T>(result + data[i]);
+            }
+            return result;
+        }
+
+        template <typename T>
+        inline T min_kernel(const T* data, const std::size_t count, const SimdLevel) {
+            return *std::min_element(data, data + count);
+        }
+
+        template <typename T>
+        inline T max_kernel(const T* data, const std::size_t count, const SimdLevel) {
+            return *std::max_element(data, data + count);
+        }
+
+        template <typename T>
+        inline T dot_kernel(const T* lhs, const T* rhs, const std::size_t count, const SimdLevel) {
+            T result = T{};
+            for (std::size_t i = 0; i < count; ++i) {
+                result = static_cast<T>(result + lhs[i] * rhs[i]);
+            }
+            return result;
+        }
+
+        template <typename T>
+        inline widened_sum_type<T> widened_sum_kernel(const T* data, const std::size_t count, const SimdLevel) {
+            widened_sum_type<T> result = widened_sum_type<T>{};
+            for (std::size_t i = 0; i < count; ++i) {
+                result += static_cast<widened_sum_type<T>>(data[i]);
+            }
+            return result;
+        }
+
+        inline double widened_sum_kernel(const double* data, const std::size_t count, const SimdLevel level) {
+            return sum_kernel(data, count, level);
+        }
+
+        inline std::int64_t widened_sum_kernel(const std::int64_t* data, const std::size_t count, const SimdLevel level) {
+            return sum_kernel(data, count, level);
+        }
+
+        inline double sum_kernel(const double* data, const std::size_t count, const SimdLevel level) {
+#if SIMPLE_RING_BUFFER_HAS_X86_SIMD
+            if (level == SimdLevel::Avx2) {
+                return sum_avx2(data, count);
+            }
+            if (level == SimdLevel::Sse2) {
+                return sum_sse2(data, count);
+            }
+#endif // #if SIMPLE_RING_BUFFER_HAS_X86_SIMD
+            return sum_kernel<double>(data, count, level);
+        }
+
+        inline double min_kernel(const double* data, const std::size_t count, const SimdLevel level) {
+#if SIMPLE_RING_BUFFER_HAS_X86_SIMD
+            if (level == SimdLevel::Avx2) {
+                return min_avx2(data, count);
+            }
+            if (level == SimdLevel::Sse2) {
+                return min_sse2(data, count);
+            }
+#endif // #if SIMPLE_RING_BUFFER_HAS_X86_SIMD
+            return min_kernel<double>(data, count, level);
+        }
+
+        inline double max_kernel(const double* data, const std::size_t count, const SimdLevel level) {
+#if SIMPLE_RING_BUFFER_HAS_X86_SIMD
+            if (level == SimdLevel::Avx2) {
+                return max_avx2(data, count);
+            }
+            if (level == SimdLevel::Sse2) {
+                return max_sse2(data, count);
+            }
+#endif // #if SIMPLE_RING_BUFFER_HAS_X86_SIMD
+            return max_kernel<double>(data, count, level);
+        }
+
+        inline double dot_kernel(const double* lhs, const double* rhs, const std::size_t count, const SimdLevel level) {
+#if SIMPLE_RING_BUFFER_HAS_X86_SIMD
+            if (level == SimdLevel::Avx2) {
+                return dot_avx2(lhs, rhs, count);
+            }
+            if (level == SimdLevel::Sse2) {
+                return dot_sse2(lhs, rhs, count);
+            }
+#endif // #if SIMPLE_RING_BUFFER_HAS_X86_SIMD
+            return dot_kernel<double>(lhs, rhs, count, level);
+        }
+
+        inline std::int64_t sum_kernel(const std::int64_t* data, const std::size_t count, const SimdLevel level) {
+#if SIMPLE_RING_BUFFER_HAS_X86_SIMD
+            if (level == SimdLevel::Avx2) {
+                return sum_avx2(data, count);
+            }
+            if (level == SimdLevel::Sse2) {
+                return sum_sse2(data, count);
+            }
+#endif // #if SIMPLE_RING_BUFFER_HAS_X86_SIMD
+            return sum_kernel<std::int64_t>(data, count, level);
+        }
+
+        // SSE2 has no 64 bit integer comparison, so only AVX2 has a vectorized kernel
+        inline std::int64_t min_kernel(const std::int64_t* data, const std::size_t count, const SimdLevel level) {
+#if SIMPLE_RING_BUFFER_HAS_X86_SIMD
+            if (level == SimdLevel::Avx2) {
+                return min_avx2(data, count);
+            }
+#endif // #if SIMPLE_RING_BUFFER_HAS_X86_SIMD
+            return min_kernel<std::int64_t>(data, count, level);
+        }
+
+        inline std::int64_t max_kernel(const std::int64_t* data, const std::size_t count, const SimdLevel level) {
+#if SIMPLE_RING_BUFFER_HAS_X86_SIMD
+            if (level == SimdLevel::Avx2) {
+                return max_avx2(data, count);
+            }
+#endif // #if SIMPLE_RING_BUFFER_HAS_X86_SIMD
+            return max_kernel<std::int64_t>(data, count, level);
+        }
+
+#if SIMPLE_RING_BUFFER_HAS_X86_SIMD
+        // Every kernel keeps two independent accumulators so that consecutive iterations do not wait for each other, then
+        // combines them and handles the elements that do not fill a whole register with a scalar loop
+
+        inline double sum_sse2(const double* data, const std::size_t count) {
+            __m128d acc0 = _mm_setzero_pd();
+            __m128d acc1 = _mm_setzero_pd();
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                acc0 = _mm_add_pd(acc0, _mm_loadu_pd(data + i));
+                acc1 = _mm_add_pd(acc1, _mm_loadu_pd(data + i + 2));
+            }
+
+            const __m128d acc = _mm_add_pd(acc0, acc1);
+            double result = _mm_cvtsd_f64(_mm_add_sd(acc, _mm_unpackhi_pd(acc, acc)));
+            for (; i < count; ++i) {
+                result += data[i];
+            }
+            return result;
+        }
+
+        inline double min_sse2(const double* data, const std::size_t count) {
+            if (count < 4) {
+                return min_kernel<double>(data, count, SimdLevel::Scalar);
+            }
+
+            __m128d acc0 = _mm_loadu_pd(data);
+            __m128d acc1 = _mm_loadu_pd(data + 2);
+            std::size_t i = 4;
+            for (; i + 4 <= count; i += 4) {
+                acc0 = _mm_min_pd(acc0, _mm_loadu_pd(data + i));
+                acc1 = _mm_min_pd(acc1, _mm_loadu_pd(data + i + 2));
+            }
+
+            const __m128d acc = _mm_min_pd(acc0, acc1);
+            double result = _mm_cvtsd_f64(_mm_min_sd(acc, _mm_unpackhi_pd(acc, acc)));
+            for (; i < count; ++i) {
+                result = std::min(result, data[i]);
+            }
+            return result;
+        }
+
+        inline double max_sse2(const double* data, const std::size_t count) {
+            if (count < 4) {
+                return max_kernel<double>(data, count, SimdLevel::Scalar);
+            }
+
+            __m128d acc0 = _mm_loadu_pd(data);
+            __m128d acc1 = _mm_loadu_pd(data + 2);
+            std::size_t i = 4;
+            for (; i + 4 <= count; i += 4) {
+                acc0 = _mm_max_pd(acc0, _mm_loadu_pd(data + i));
+                acc1 = _mm_max_pd(acc1, _mm_loadu_pd(data + i + 2));
+            }
+
+            const __m128d acc = _mm_max_pd(acc0, acc1);
+            double result = _mm_cvtsd_f64(_mm_max_sd(acc, _mm_unpackhi_pd(acc, acc)));
+            for (; i < count; ++i) {
+                result = std::max(result, data[i]);
+            }
+            return result;
+        }
+
+        inline double dot_sse2(const double* lhs, const double* rhs, const std::size_t count) {
+            __m128d acc0 = _mm_setzero_pd();
+            __m128d acc1 = _mm_setzero_pd();
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_loadu_pd(lhs + i), _mm_loadu_pd(rhs + i)));
+                acc1 = _mm_add_pd(acc1, _mm_mul_pd(_mm_loadu_pd(lhs + i + 2), _mm_loadu_pd(rhs + i + 2)));
+            }
+
+            const __m128d acc = _mm_add_pd(acc0, acc1);
+            double result = _mm_cvtsd_f64(_mm_add_sd(acc, _mm_unpackhi_pd(acc, acc)));
+            for (; i < count; ++i) {
+                result += lhs[i] * rhs[i];
+            }
+            return result;
+        }
+
+        inline std::int64_t sum_sse2(const std::int64_t* data, const std::size_t count) {
+            __m128i acc0 = _mm_setzero_si128();
+            __m128i acc1 = _mm_setzero_si128();
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                acc0 = _mm_add_epi64(acc0, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)));
+                acc1 = _mm_add_epi64(acc1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 2)));
+            }
+
+            std::int64_t lanes[2];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), _mm_add_epi64(acc0, acc1));
+            std::int64_t result = lanes[0] + lanes[1];
+            for (; i < count; ++i) {
+                result += data[i];
+            }
+            return result;
+        }
+
+        SIMPLE_RING_BUFFER_TARGET_AVX2 inline double sum_avx2(const double* data, const std::size_t count) {
+            __m256d acc0 = _mm256_setzero_pd();
+            __m256d acc1 = _mm256_setzero_pd();
+            std::size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                acc0 = _mm256_add_pd(acc0, _mm256_loadu_pd(data + i));
+                acc1 = _mm256_add_pd(acc1, _mm256_loadu_pd(data + i + 4));
+            }
+
+            const __m256d acc256 = _mm256_add_pd(acc0, acc1);
+            const __m128d acc = _mm_add_pd(_mm256_castpd256_pd128(acc256), _mm256_extractf128_pd(acc256, 1));
+            double result = _mm_cvtsd_f64(_mm_add_sd(acc, _mm_unpackhi_pd(acc, acc)));
+            for (; i < count; ++i) {
+                result += data[i];
+            }
+            return result;
+        }
+
+        SIMPLE_RING_BUFFER_TARGET_AVX2 inline double min_avx2(const double* data, const std::size_t count) {
+            if (count < 8) {
+                return min_kernel<double>(data, count, SimdLevel::Scalar);
+            }
+
+            __m256d acc0 = _mm256_loadu_pd(data);
+            __m256d acc1 = _mm256_loadu_pd(data + 4);
+            std::size_t i = 8;
+            for (; i + 8 <= count; i += 8) {
+                acc0 = _mm256_min_pd(acc0, _mm256_loadu_pd(data + i));
+                acc1 = _mm256_min_pd(acc1, _mm256_loadu_pd(data + i + 4));
+            }
+
+            const __m256d acc256 = _mm256_min_pd(acc0, acc1);
+            const __m128d acc = _mm_min_pd(_mm256_castpd256_pd128(acc256), _mm256_extractf128_pd(acc256, 1));
+            double result = _mm_cvtsd_f64(_mm_min_sd(acc, _mm_unpackhi_pd(acc, acc)));
+            for (; i < count; ++i) {
+                result = std::min(result, data[i]);
+            }
+            return result;
+        }
+
+        SIMPLE_RING_BUFFER_TARGET_AVX2 inline double max_avx2(const double* data, const std::size_t count) {
+            if (count < 8) {
+                return max_kernel<double>(data, count, SimdLevel::Scalar);
+            }
+
+            __m256d acc0 = _mm256_loadu_pd(data);
+            __m256d acc1 = _mm256_loadu_pd(data + 4);
+            std::size_t i = 8;
+            for (; i + 8 <= count; i += 8) {
+                acc0 = _mm256_max_pd(acc0, _mm256_loadu_pd(data + i));
+                acc1 = _mm256_max_pd(acc1, _mm256_loadu_pd(data + i + 4));
+            }
+
+            const __m256d acc256 = _mm256_max_pd(acc0, acc1);
+            const __m128d acc = _mm_max_pd(_mm256_castpd256_pd128(acc256), _mm256_extractf128_pd(acc256, 1));
+            double result = _mm_cvtsd_f64(_mm_max_sd(acc, _mm_unpackhi_pd(acc, acc)));
+            for (; i < count; ++i) {
+                result = std::max(result, data[i]);
+            }
+            return result;
+        }
+
+        SIMPLE_RING_BUFFER_TARGET_AVX2 inline double dot_avx2(const double* lhs, const double* rhs, const std::size_t count) {
+            __m256d acc0 = _mm256_setzero_pd();
+            __m256d acc1 = _mm256_setzero_pd();
+            std::size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                acc0 = _mm256_add_pd(acc0, _mm256_mul_pd(_mm256_loadu_pd(lhs + i), _mm256_loadu_pd(rhs + i)));
+                acc1 = _mm256_add_pd(acc1, _mm256_mul_pd(_mm256_loadu_pd(lhs + i + 4), _mm256_loadu_pd(rhs + i + 4)));
+            }
+
+            const __m256d acc256 = _mm256_add_pd(acc0, acc1);
+            const __m128d acc = _mm_add_pd(_mm256_castpd256_pd128(acc256), _mm256_extractf128_pd(acc256, 1));
+            double result = _mm_cvtsd_f64(_mm_add_sd(acc, _mm_unpackhi_pd(acc, acc)));
+            for (; i < count; ++i) {
+                result += lhs[i] * rhs[i];
+            }
+            return result;
+        }
+
+        SIMPLE_RING_BUFFER_TARGET_AVX2 inline std::int64_t sum_avx2(const std::int64_t* data, const std::size_t count) {
+            __m256i acc0 = _mm256_setzero_si256();
+            __m256i acc1 = _mm256_setzero_si256();
+            std::size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                acc0 = _mm256_add_epi64(acc0, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)));
+                acc1 = _mm256_add_epi64(acc1, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 4)));
+            }
+
+            std::int64_t lanes[4];
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), _mm256_add_epi64(acc0, acc1));
+            std::int64_t result = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+            for (; i < count; ++i) {
+                result += data[i];
+            }
+            return result;
+        }
+
+        SIMPLE_RING_BUFFER_TARGET_AVX2 inline std::int64_t min_avx2(const std::int64_t* data, const std::size_t count) {
+            if (count < 8) {
+                return min_kernel<std::int64_t>(data, count, SimdLevel::Scalar);
+            }
+
+            __m256i acc0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+            __m256i acc1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 4));
+            std::size_t i = 8;
+            for (; i + 8 <= count; i += 8) {
+                const __m256i values0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                const __m256i values1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 4));
+                // take the new value in every lane where the accumulator is greater
+                acc0 = _mm256_blendv_epi8(acc0, values0, _mm256_cmpgt_epi64(acc0, values0));
+                acc1 = _mm256_blendv_epi8(acc1, values1, _mm256_cmpgt_epi64(acc1, values1));
+            }
+
+            std::int64_t lanes[8];
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), acc0);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes + 4), acc1);
+            std::int64_t result = *std::min_element(lanes, lanes + 8);
+            for (; i < count; ++i) {
+                result = std::min(result, data[i]);
+            }
+            return result;
+        }
+
+        SIMPLE_RING_BUFFER_TARGET_AVX2 inline std::int64_t max_avx2(const std::int64_t* data, const std::size_t count) {
+            if (count < 8) {
+                return max_kernel<std::int64_t>(data, count, SimdLevel::Scalar);
+            }
+
+            __m256i acc0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+            __m256i acc1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 4));
+            std::size_t i = 8;
+            for (; i + 8 <= count; i += 8) {
+                const __m256i values0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                const __m256i values1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 4));
+                // take the new value in every lane where it is greater than the accumulator
+                acc0 = _mm256_blendv_epi8(acc0, values0, _mm256_cmpgt_epi64(values0, acc0));
+                acc1 = _mm256_blendv_epi8(acc1, values1, _mm256_cmpgt_epi64(values1, acc1));
+            }
+
+            std::int64_t lanes[8];
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), acc0);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes + 4), acc1);
+            std::int64_t result = *std::max_element(lanes, lanes + 8);
+            for (; i < count; ++i) {
+                result = std::max(result, data[i]);
+            }
+            return result;
+        }
+#endif // #if SIMPLE_RING_BUFFER_HAS_X86_SIMD
+    } // namespace detail
+} // namespace simpleContainers
+
+#endif // SIMPLE_RING_BUFFER_REDUCTIONS_HPP
@@ -0,0 +1,675 @@
+/// @file simpleRingBufferSoA.hpp
+/// @brief File containing API and implementaiton of RingBufferSoA class
+
+#ifndef SIMPLE_RING_BUFFER_SOA_HPP
+#define SIMPLE_RING_BUFFER_SOA_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "simpleRingBuffer.hpp"
+
+// ============================================================================================================================================
+// =================================================================== API ====================================================================
+// ============================================================================================================================================
+
+namespace simpleContainers {
+    namespace detail {
+        // C++11 replacements for std::index_sequence and std::conjunction
+        template <std::size_t... Is>
+        struct index_sequence {};
+
+        template <std::size_t N, std::size_t... Is>
+        struct make_index_sequence_impl : make_index_sequence_impl<N - 1, N - 1, Is...> {};
+
+        template <std::size_t... Is>
+        struct make_index_sequence_impl<0, Is...> {
+            using type = index_sequence<Is...>;
+        };
+
+        template <std::size_t N>
+        using make_index_sequence = typename make_index_sequence_impl<N>::type;
+
+        template <bool... Bs>
+        struct bool_pack {};
+
+        template <bool... Bs>
+        using all_true = std::is_same<bool_pack<true, Bs...>, bool_pack<Bs..., true>>;
+
+        // used to evaluate an expression for every element of a pack, in order
+        using expand_pack = int[];
+    } // namespace detail
+
+    /// @brief Ring buffer of records with fields of types Ts..., stored as one contiguous column per field (structure of arrays)
+    /// @details All columns share one head, size and capacity, so the field I of the record at position pos is always at the same
+    ///          storage index in column I as every other field of that record. Code that reads only one field, for example
+    ///          summing prices, can scan that column through column<I>() and never pulls the other fields through cache,
+    ///          which for a RingBuffer<Record> it has to do since the fields are interleaved.
+    ///          Records are accessed through proxy references, std::tuple<Ts&...>, so like std::vector<bool> the iterators
+    ///          can be used with range-for as `for (auto&& record : rb)` or `for (const auto& record : rb)`, but not with `auto&`.
+    ///          Fields are required to be trivially copyable, which makes every operation noexcept except construction
+    /// @tparam Ts Types of the fields of one record
+    template <typename... Ts>
+    class RingBufferSoA {
+        public:
+            using value_type = std::tuple<Ts...>;
+            using reference = std::tuple<Ts&...>;
+            using const_reference = std::tuple<const Ts&...>;
+            using size_type = std::size_t;
+            using difference_type = std::ptrdiff_t;
+
+            template <std::size_t I>
+            using column_type = typename std::tuple_element<I, value_type>::type;
+            template <std::size_t I>
+            using column_segments = std::pair<Segment<column_type<I>>, Segment<column_type<I>>>;
+            template <std::size_t I>
+            using const_column_segments = std::pair<Segment<const column_type<I>>, Segment<const column_type<I>>>;
+
+            SIMPLE_RING_BUFFER_STATIC_ASSERT((sizeof...(Ts) > 0), "RingBufferSoA must have at least one column.");
+            SIMPLE_RING_BUFFER_STATIC_ASSERT((detail::all_true<std::is_trivially_copyable<Ts>::value...>::value), "RingBufferSoA<Ts...> requires trivially copyable Ts.");
+
+            /// @brief Random access iterator over the records, dereferencing it returns a proxy reference by value
+            template <bool constTag = false>
+            class RingBufferSoAIterator {
+                public:
+                    // same as std::vector<bool>::iterator, the category is random access even though reference is a proxy
+                    using iterator_category = std::random_access_iterator_tag;
+                    using value_type = typename RingBufferSoA<Ts...>::value_type;
+                    using difference_type = typename RingBufferSoA<Ts...>::difference_type;
+                    using size_type = typename RingBufferSoA<Ts...>::size_type;
+                    using pointer = void;
+                    using reference = typename std::conditional<constTag, typename RingBufferSoA<Ts...>::const_reference, typename RingBufferSoA<Ts...>::reference>::type;
+                    using ring_buffer_ptr = typename std::conditional<constTag, const RingBufferSoA<Ts...>*, RingBufferSoA<Ts...>*>::type;
+
+                    /// @brief Construct iterator to the record at position pos (in insertion order) of rb
+                    RingBufferSoAIterator(size_type pos = 0, ring_buffer_ptr rb = nullptr) noexcept;
+                    RingBufferSoAIterator(const RingBufferSoAIterator& other) noexcept = default;
+                    /// @brief Converting constructor to create a const iterator from a non-const iterator
+                    template <bool C = constTag, typename = typename std::enable_if<C>::type>
+                    RingBufferSoAIterator(const RingBufferSoAIterator<false>& other) noexcept;
+                    RingBufferSoAIterator(RingBufferSoAIterator&& other) noexcept = default;
+                    RingBufferSoAIterator& operator=(const RingBufferSoAIterator& rhs) noexcept = default;
+                    RingBufferSoAIterator& operator=(RingBufferSoAIterator&& rhs) noexcept = default;
+                    ~RingBufferSoAIterator() noexcept = default;
+
+                    void swap(RingBufferSoAIterator& other) noexcept;
+
+                    reference operator*() const noexcept;
+                    reference operator[](const difference_type n) const noexcept;
+
+                    RingBufferSoAIterator& operator++() noexcept; // prefix
+                    RingBufferSoAIterator operator++(int) noexcept; // postfix
+                    RingBufferSoAIterator& operator+=(const difference_type n) noexcept;
+                    RingBufferSoAIterator operator+(const difference_type n) const noexcept;
+                    friend RingBufferSoAIterator operator+(const difference_type n, RingBufferSoAIterator rhs) noexcept {
+                        rhs += n;
+                        return rhs;
+                    }
+
+                    RingBufferSoAIterator& operator--() noexcept; // prefix
+                    RingBufferSoAIterator operator--(int) noexcept; // postfix
+                    RingBufferSoAIterator& operator-=(const difference_type n) noexcept;
+                    RingBufferSoAIterator operator-(const difference_type n) const noexcept;
+                    difference_type operator-(const RingBufferSoAIterator& other) const noexcept; // Subtraction between two iterators
+
+                    friend bool operator==(const RingBufferSoAIterator& lhs, const RingBufferSoAIterator& rhs) noexcept {
+                        SIMPLE_RING_BUFFER_ASSERT(lhs.mRingBufPtr == rhs.mRingBufPtr, "RingBufferSoAIterator == comparison must be done on iterators of the same RingBufferSoA");
+                        return lhs.mPosition == rhs.mPosition;
+                    }
+
+                    friend bool operator!=(const RingBufferSoAIterator& lhs, const RingBufferSoAIterator& rhs) noexcept {
+                        SIMPLE_RING_BUFFER_ASSERT(lhs.mRingBufPtr == rhs.mRingBufPtr, "RingBufferSoAIterator != comparison must be done on iterators of the same RingBufferSoA");
+                        return lhs.mPosition != rhs.mPosition;
+                    }
+
+                    friend bool operator<(const RingBufferSoAIterator& lhs, const RingBufferSoAIterator& rhs) noexcept {
+                        SIMPLE_RING_BUFFER_ASSERT(lhs.mRingBufPtr == rhs.mRingBufPtr, "RingBufferSoAIterator < comparison must be done on iterators of the same RingBufferSoA");
+                        return lhs.mPosition < rhs.mPosition;
+                    }
+
+                    friend bool operator<=(const RingBufferSoAIterator& lhs, const RingBufferSoAIterator& rhs) noexcept {
+                        SIMPLE_RING_BUFFER_ASSERT(lhs.mRingBufPtr == rhs.mRingBufPtr, "RingBufferSoAIterator <= comparison must be done on iterators of the same RingBufferSoA");
+                        return lhs.mPosition <= rhs.mPosition;
+                    }
+
+                    friend bool operator>(const RingBufferSoAIterator& lhs, const RingBufferSoAIterator& rhs) noexcept {
+                        SIMPLE_RING_BUFFER_ASSERT(lhs.mRingBufPtr == rhs.mRingBufPtr, "RingBufferSoAIterator > comparison must be done on iterators of the same RingBufferSoA");
+                        return lhs.mPosition > rhs.mPosition;
+                    }
+
+                    friend bool operator>=(const RingBufferSoAIterator& lhs, const RingBufferSoAIterator& rhs) noexcept {
+                        SIMPLE_RING_BUFFER_ASSERT(lhs.mRingBufPtr == rhs.mRingBufPtr, "RingBufferSoAIterator >= comparison must be done on iterators of the same RingBufferSoA");
+                        return lhs.mPosition >= rhs.mPosition;
+                    }
+
+                private:
+                    friend class RingBufferSoAIterator<!constTag>;
+
+                    size_type mPosition;
+                    ring_buffer_ptr mRingBufPtr;
+            };
+
+            using iterator = RingBufferSoAIterator<false>;
+            using const_iterator = RingBufferSoAIterator<true>;
+
+            static constexpr size_type columnCount = sizeof...(Ts);
+            /// @brief RingBufferSoA cannot be constructed with 0 capacity so this arbitrary value was chosen as a default
+            static constexpr size_type defaultInitialCapacity = 64;
+
+            RingBufferSoA(const size_type initialCapacity = defaultInitialCapacity);
+            RingBufferSoA(const RingBufferSoA& other);
+            /// @brief Moved-from RingBufferSoA has no storage and can only be assigned to or destroyed
+            RingBufferSoA(RingBufferSoA&& other) noexcept;
+            RingBufferSoA& operator=(const RingBufferSoA& other);
+            RingBufferSoA& operator=(RingBufferSoA&& other) noexcept;
+            ~RingBufferSoA() noexcept;
+
+            void swap(RingBufferSoA& other) noexcept;
+
+            size_type capacity() const noexcept;
+            size_type size() const noexcept;
+            bool empty() const noexcept;
+            bool full() const noexcept;
+            /// @brief Remove all records. O(1) since fields are trivially destructible
+            void clear() noexcept;
+
+            /// @brief Insert a record with the given fields, overwriting the oldest record if the buffer is full
+            void push_back(const Ts&... fields) noexcept;
+            void push_back(const value_type& record) noexcept;
+            /// @brief Remove the oldest record. Buffer must not be empty.
+            ///        This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            void pop_front() noexcept;
+            /// @brief Remove the n oldest records in O(1). n must not be greater than size().
+            ///        This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            void pop_front(const size_type n) noexcept;
+
+            /// @brief Views of column I in insertion order, the second view is empty unless the column wraps around
+            ///        the end of the storage. Same as RingBuffer::segments(), but for one field of every record
+            template <std::size_t I>
+            column_segments<I> column() noexcept;
+            template <std::size_t I>
+            const_column_segments<I> column() const noexcept;
+
+            /// @brief Field I of the record at position pos in insertion order
+            /// @details This performs out of range checks for pos only when SIMPLE_RING_BUFFER_DEBUG is defined
+            template <std::size_t I>
+            column_type<I>& field(const size_type pos) noexcept;
+            template <std::size_t I>
+            const column_type<I>& field(const size_type pos) const noexcept;
+
+            /// @brief Proxy reference to the oldest record. Buffer must not be empty.
+            ///        This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            reference front() noexcept;
+            const_reference front() const noexcept;
+            /// @brief Proxy reference to the newest record. Buffer must not be empty.
+            ///        This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            reference back() noexcept;
+            const_reference back() const noexcept;
+            /// @brief Subscript operator
+            /// @details Indexing is done in insertion order, like for RingBuffer.
+            ///          This operator performs out of range checks for pos only when SIMPLE_RING_BUFFER_DEBUG is defined
+            reference operator[](const size_type pos) noexcept;
+            const_reference operator[](const size_type pos) const noexcept;
+            /// @brief Access record at specified position. Validity of pos is always checked
+            reference at(const size_type pos);
+            const_reference at(const size_type pos) const;
+
+            iterator begin() noexcept;
+            iterator end() noexcept;
+            const_iterator begin() const noexcept;
+            const_iterator end() const noexcept;
+            const_iterator cbegin() const noexcept;
+            const_iterator cend() const noexcept;
+
+        private:
+            using sequence = detail::make_index_sequence<sizeof...(Ts)>;
+
+            /// @brief Map a position in insertion order to an index in the columns
+            size_type storage_index(const size_type pos) const noexcept;
+
+            template <std::size_t... Is>
+            void allocate_columns(detail::index_sequence<Is...>);
+            template <std::size_t... Is>
+            void deallocate_columns(detail::index_sequence<Is...>) noexcept;
+            template <std::size_t... Is>
+            void copy_columns(const RingBufferSoA& other, detail::index_sequence<Is...>) noexcept;
+            template <std::size_t... Is>
+            void write_record(const size_type index, detail::index_sequence<Is...>, const Ts&... fields) noexcept;
+            template <std::size_t... Is>
+            void write_record(const size_type index, detail::index_sequence<Is...>, const value_type& record) noexcept;
+            template <std::size_t... Is>
+            reference make_reference(const size_type index, detail::index_sequence<Is...>) noexcept;
+            template <std::size_t... Is>
+            const_reference make_reference(const size_type index, detail::index_sequence<Is...>) const noexcept;
+
+            /// @brief Index in the columns where the next record is written, advancing head if the buffer is full
+            size_type next_write_index() noexcept;
+
+            std::tuple<Ts*...> mColumns;
+            size_type mCapacity;
+            // storage index of the oldest record
+            size_type mHead;
+            size_type mSize;
+    };
+} // namespace simpleContainers
+
+// ============================================================================================================================================
+// ============================================================== IMPLEMENTATION ==============================================================
+// ============================================================================================================================================
+
+namespace simpleContainers {
+    // ---------------------------------------------------------------- iterator ----------------------------------------------------------------
+
+    template <typename... Ts>
+    template <bool constTag>
+    inline RingBufferSoA<Ts...>::RingBufferSoAIterator<constTag>::RingBufferSoAIterator(size_type pos, ring_buffer_ptr rb) noexcept
+        : mPosition{pos}, mRingBufPtr{rb}
+    {}
+
+    template <typename... Ts>
+    template <bool constTag>
+    template <bool C, typename>
+    inline RingBufferSoA<Ts...>::RingBufferSoAIterator<constTag>::RingBufferSoAIterator(const RingBufferSoA<Ts...>::RingBufferSoAIterator<false>& other) noexcept
+        : mPosition{other.mPosition}, mRingBufPtr{other.mRingBufPtr}
+    {}
+
+    template <typename... Ts>
+    template <bool constTag>
+    inline void RingBufferSoA<Ts...>::RingBufferSoAIterator<constTag>::swap(RingBufferSoAIterator& other) noexcept {
+        std::swap(mPosition, other.mPosition);
+        std::swap(mRingBufPtr, other.mRingBufPtr);
+    }
+
+    template <typename... Ts>
+    template <bool constTag>
+    inline typename RingBufferSoA<Ts...>::template RingBufferSoAIterator<constTag>::reference
+    RingBufferSoA<Ts...>::RingBufferSoAIterator<constTag>::operator*() const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(mRingBufPtr != nullptr, "RingBufferSoAIterator::operator* trying to dereference mRingBufPtr which is a nullptr");
+        return (*mRingBufPtr)[mPosition];
+    }
+
+    template <typename... Ts>
+    template <bool constTag>
+    inline typename RingBufferSoA<Ts...>::template RingBufferSoAIterator<constTag>::reference
+    RingBufferSoA<Ts...>::RingBufferSoAIterator<constTag>::operator[](const difference_type n) const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(mRingBufPtr != nullptr, "RingBufferSoAIterator::operator[] trying to dereference mRingBufPtr which is a nullptr");
+        return (*mRingBufPtr)[mPosition + static_cast<size_type>(n)];
+    }
+
+    template <typename... Ts>
+    template <bool constTag>
+    inline typename RingBufferSoA<Ts...>::template RingBufferSoAIterator<constTag>&
+    RingBufferSoA<Ts...>::RingBufferSoAIterator<constTag>::operator++() noexcept {
+        ++mPosition;
+        return *this;
+    }
+
+    template <typename... Ts>
+    template <bool constTag>
+    inline typename RingBufferSoA<Ts...>::template RingBufferSoAIterator<constTag>
+    RingBufferSoA<Ts...>::RingBufferSoAIterator<constTag>::operator++(int) noexcept {
+        RingBufferSoAIterator tmp = *this;
+        ++(*this);
+        return tmp;
+    }
+
+    template <typename... Ts>
+    template <bool constTag>
+    inline typename RingBufferSoA<Ts...>::template RingBufferSoAIterator<constTag>&
+    RingBufferSoA<Ts...>::RingBufferSoAIterator<constTag>::operator+=(const difference_type n) noexcept {
+        mPosition += static_cast<size_type>(n);
+        return *this;
+    }
+
+    template <typename... Ts>
+    template <bool constTag>
+    inline typename RingBufferSoA<Ts...>::template RingBufferSoAIterator<constTag>
+    RingBufferSoA<Ts...>::RingBufferSoAIterator<constTag>::operator+(const difference_type n) const noexcept {
+        return RingBufferSoAIterator<constTag>(mPosition + static_cast<size_type>(n), mRingBufPtr);
+    }
+
+    template <typename... Ts>
+    template <bool constTag>
+    inline typename RingBufferSoA<Ts...>::template RingBufferSoAIterator<constTag>&
+    RingBufferSoA<Ts...>::RingBufferSoAIterator<constTag>::operator--() noexcept {
+        --mPosition;
+        return *this;
+    }
+
+    template <typename... Ts>
+    template <bool constTag>
+    inline typename RingBufferSoA<Ts...>::template RingBufferSoAIterator<constTag>
+    RingBufferSoA<Ts...>::RingBufferSoAIterator<constTag>::operator--(int) noexcept {
+        RingBufferSoAIterator tmp = *this;
+        --(*this);
+        return tmp;
+    }
+
+    template <typename... Ts>
+    template <bool constTag>
+    inline typename RingBufferSoA<Ts...>::template RingBufferSoAIterator<constTag>&
+    RingBufferSoA<Ts...>::RingBufferSoAIterator<constTag>::operator-=(const difference_type n) noexcept {
+        mPosition -= static_cast<size_type>(n);
+        return *this;
+    }
+
+    template <typename... Ts>
+    template <bool constTag>
+    inline typename RingBufferSoA<Ts...>::template RingBufferSoAIterator<constTag>
+    RingBufferSoA<Ts...>::RingBufferSoAIterator<constTag>::operator-(const difference_type n) const noexcept {
+        return RingBufferSoAIterator<constTag>(mPosition - static_cast<size_type>(n), mRingBufPtr);
+    }
+
+    template <typename... Ts>
+    template <bool constTag>
+    inline typename RingBufferSoA<Ts...>::template RingBufferSoAIterator<constTag>::difference_type
+    RingBufferSoA<Ts...>::RingBufferSoAIterator<constTag>::operator-(const RingBufferSoAIterator& other) const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(mRingBufPtr == other.mRingBufPtr, "RingBufferSoAIterator subtraction must be done on iterators of the same RingBufferSoA");
+        return static_cast<difference_type>(mPosition) - static_cast<difference_type>(other.mPosition);
+    }
+
+    // ------------------------------------------------------------- RingBufferSoA --------------------------------------------------------------
+
+    template <typename... Ts>
+    constexpr typename RingBufferSoA<Ts...>::size_type RingBufferSoA<Ts...>::columnCount;
+
+    template <typename... Ts>
+    constexpr typename RingBufferSoA<Ts...>::size_type RingBufferSoA<Ts...>::defaultInitialCapacity;
+
+    template <typename... Ts>
+    inline RingBufferSoA<Ts...>::RingBufferSoA(const size_type initialCapacity)
+        : mColumns{}, mCapacity{initialCapacity}, mHead{0}, mSize{0}
+    {
+        SIMPLE_RING_BUFFER_ASSERT(initialCapacity > 0, "RingBufferSoA capacity must not be 0");
+        allocate_columns(sequence{});
+    }
+
+    template <typename... Ts>
+    inline RingBufferSoA<Ts...>::RingBufferSoA(const RingBufferSoA& other)
+        : mColumns{}, mCapacity{other.mCapacity}, mHead{0}, mSize{other.mSize}
+    {
+        allocate_columns(sequence{});
+        copy_columns(other, sequence{});
+    }
+
+    template <typename... Ts>
+    inline RingBufferSoA<Ts...>::RingBufferSoA(RingBufferSoA&& other) noexcept
+        : mColumns{other.mColumns}, mCapacity{other.mCapacity}, mHead{other.mHead}, mSize{other.mSize}
+    {
+        other.mColumns = std::tuple<Ts*...>{};
+        other.mCapacity = 0;
+        other.mHead = 0;
+        other.mSize = 0;
+    }
+
+    template <typename... Ts>
+    inline RingBufferSoA<Ts...>& RingBufferSoA<Ts...>::operator=(const RingBufferSoA& other) {
+        if (this != &other) {
+            RingBufferSoA tmp(other);
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    template <typename... Ts>
+    inline RingBufferSoA<Ts...>& RingBufferSoA<Ts...>::operator=(RingBufferSoA&& other) noexcept {
+        if (this != &other) {
+            RingBufferSoA tmp(std::move(other));
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    template <typename... Ts>
+    inline RingBufferSoA<Ts...>::~RingBufferSoA() noexcept {
+        deallocate_columns(sequence{});
+    }
+
+    template <typename... Ts>
+    inline void RingBufferSoA<Ts...>::swap(RingBufferSoA& other) noexcept {
+        std::swap(mColumns, other.mColumns);
+        std::swap(mCapacity, other.mCapacity);
+        std::swap(mHead, other.mHead);
+        std::swap(mSize, other.mSize);
+    }
+
+    template <typename... Ts>
+    inline typename RingBufferSoA<Ts...>::size_type RingBufferSoA<Ts...>::capacity() const noexcept {
+        return mCapacity;
+    }
+
+    template <typename... Ts>
+    inline typename RingBufferSoA<Ts...>::size_type RingBufferSoA<Ts...>::size() const noexcept {
+        return mSize;
+    }
+
+    template <typename... Ts>
+    inline bool RingBufferSoA<Ts...>::empty() const noexcept {
+        return mSize == 0;
+    }
+
+    template <typename... Ts>
+    inline bool RingBufferSoA<Ts...>::full() const noexcept {
+        return mSize == mCapacity;
+    }
+
+    template <typename... Ts>
+    inline void RingBufferSoA<Ts...>::clear() noexcept {
+        mHead = 0;
+        mSize = 0;
+    }
+
+    template <typename... Ts>
+    inline void RingBufferSoA<Ts...>::push_back(const Ts&... fields) noexcept {
+        write_record(next_write_index(), sequence{}, fields...);
+    }
+
+    template <typename... Ts>
+    inline void RingBufferSoA<Ts...>::push_back(const value_type& record) noexcept {
+        write_record(next_write_index(), sequence{}, record);
+    }
+
+    template <typename... Ts>
+    inline void RingBufferSoA<Ts...>::pop_front() noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(!empty(), "RingBufferSoA::pop_front called on an empty buffer");
+        pop_front(1);
+    }
+
+    template <typename... Ts>
+    inline void RingBufferSoA<Ts...>::pop_front(const size_type n) noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(n <= mSize, "RingBufferSoA::pop_front trying to remove more records than there are in the buffer");
+        mHead = n < mSize ? storage_index(n) : 0;
+        mSize -= n;
+    }
+
+    template <typename... Ts>
+    template <std::size_t I>
+    inline typename RingBufferSoA<Ts...>::template column_segments<I> RingBufferSoA<Ts...>::column() noexcept {
+        column_type<I>* const storage = std::get<I>(mColumns);
+        const size_type firstSize = std::min(mSize, mCapacity - mHead);
+        return column_segments<I>(Segment<column_type<I>>(storage + mHead, firstSize), Segment<column_type<I>>(storage, mSize - firstSize));
+    }
+
+    template <typename... Ts>
+    template <std::size_t I>
+    inline typename RingBufferSoA<Ts...>::template const_column_segments<I> RingBufferSoA<Ts...>::column() const noexcept {
+        const column_type<I>* const storage = std::get<I>(mColumns);
+        const size_type firstSize = std::min(mSize, mCapacity - mHead);
+        return const_column_segments<I>(Segment<const column_type<I>>(storage + mHead, firstSize), Segment<const column_type<I>>(storage, mSize - firstSize));
+    }
+
+    template <typename... Ts>
+    template <std::size_t I>
+    inline typename RingBufferSoA<Ts...>::template column_type<I>& RingBufferSoA<Ts...>::field(const size_type pos) noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(pos < mSize, "RingBufferSoA::field position out of range");
+        return std::get<I>(mColumns)[storage_index(pos)];
+    }
+
+    template <typename... Ts>
+    template <std::size_t I>
+    inline const typename RingBufferSoA<Ts...>::template column_type<I>& RingBufferSoA<Ts...>::field(const size_type pos) const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(pos < mSize, "RingBufferSoA::field position out of range");
+        return std::get<I>(mColumns)[storage_index(pos)];
+    }
+
+    template <typename... Ts>
+    inline typename RingBufferSoA<Ts...>::reference RingBufferSoA<Ts...>::front() noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(!empty(), "RingBufferSoA::front called on an empty buffer");
+        return make_reference(mHead, sequence{});
+    }
+
+    template <typename... Ts>
+    inline typename RingBufferSoA<Ts...>::const_reference RingBufferSoA<Ts...>::front() const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(!empty(), "RingBufferSoA::front called on an empty buffer");
+        return make_reference(mHead, sequence{});
+    }
+
+    template <typename... Ts>
+    inline typename RingBufferSoA<Ts...>::reference RingBufferSoA<Ts...>::back() noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(!empty(), "RingBufferSoA::back called on an empty buffer");
+        return make_reference(storage_index(mSize - 1), sequence{});
+    }
+
+    template <typename... Ts>
+    inline typename RingBufferSoA<Ts...>::const_reference RingBufferSoA<Ts...>::back() const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(!empty(), "RingBufferSoA::back called on an empty buffer");
+        return make_reference(storage_index(mSize - 1), sequence{});
+    }
+
+    template <typename... Ts>
+    inline typename RingBufferSoA<Ts...>::reference RingBufferSoA<Ts...>::operator[](const size_type pos) noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(pos < mSize, "RingBufferSoA::operator[] position out of range");
+        return make_reference(storage_index(pos), sequence{});
+    }
+
+    template <typename... Ts>
+    inline typename RingBufferSoA<Ts...>::const_reference RingBufferSoA<Ts...>::operator[](const size_type pos) const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(pos < mSize, "RingBufferSoA::operator[] position out of range");
+        return make_reference(storage_index(pos), sequence{});
+    }
+
+    template <typename... Ts>
+    inline typename RingBufferSoA<Ts...>::reference RingBufferSoA<Ts...>::at(const size_type pos) {
+        if (pos >= mSize) {
+            throw std::out_of_range("RingBufferSoA::at position out of range");
+        }
+        return (*this)[pos];
+    }
+
+    template <typename... Ts>
+    inline typename RingBufferSoA<Ts...>::const_reference RingBufferSoA<Ts...>::at(const size_type pos) const {
+        if (pos >= mSize) {
+            throw std::out_of_range("RingBufferSoA::at position out of range");
+        }
+        return (*this)[pos];
+    }
+
+    template <typename... Ts>
+    inline typename RingBufferSoA<Ts...>::iterator RingBufferSoA<Ts...>::begin() noexcept {
+        return iterator(0, this);
+    }
+
+    template <typename... Ts>
+    inline typename RingBufferSoA<Ts...>::iterator RingBufferSoA<Ts...>::end() noexcept {
+        return iterator(mSize, this);
+    }
+
+    template <typename... Ts>
+    inline typename RingBufferSoA<Ts...>::const_iterator RingBufferSoA<Ts...>::begin() const noexcept {
+        return const_iterator(0, this);
+    }
+
+    template <typename... Ts>
+    inline typename RingBufferSoA<Ts...>::const_iterator RingBufferSoA<Ts...>::end() const noexcept {
+        return const_iterator(mSize, this);
+    }
+
+    template <typename... Ts>
+    inline typename RingBufferSoA<Ts...>::const_iterator RingBufferSoA<Ts...>::cbegin() const noexcept {
+        return const_iterator(0, this);
+    }
+
+    template <typename... Ts>
+    inline typename RingBufferSoA<Ts...>::const_iterator RingBufferSoA<Ts...>::cend() const noexcept {
+        return const_iterator(mSize, this);
+    }
+
+    template <typename... Ts>
+    inline typename RingBufferSoA<Ts...>::size_type RingBufferSoA<Ts...>::storage_index(const size_type pos) const noexcept {
+        const size_type index = mHead + pos;
+        return index < mCapacity ? index : index - mCapacity;
+    }
+
+    template <typename... Ts>
+    template <std::size_t... Is>
+    inline void RingBufferSoA<Ts...>::allocate_columns(detail::index_sequence<Is...>) {
+        try {
+            (void)detail::expand_pack{0, (std::get<Is>(mColumns) = std::allocator<Ts>().allocate(mCapacity), 0)...};
+        }
+        catch (...) {
+            deallocate_columns(sequence{});
+            throw;
+        }
+    }
+
+    template <typename... Ts>
+    template <std::size_t... Is>
+    inline void RingBufferSoA<Ts...>::deallocate_columns(detail::index_sequence<Is...>) noexcept {
+        // fields are trivially destructible, only the storage has to be released
+        (void)detail::expand_pack{0, (std::get<Is>(mColumns) != nullptr ? (std::allocator<Ts>().deallocate(std::get<Is>(mColumns), mCapacity), 0) : 0)...};
+    }
+
+    template <typename... Ts>
+    template <std::size_t... Is>
+    inline void RingBufferSoA<Ts...>::copy_columns(const RingBufferSoA& other, detail::index_sequence<Is...>) noexcept {
+        // records are linearized so the copy starts at storage index 0
+        (void)detail::expand_pack{0, (std::uninitialized_copy(other.template column<Is>().second.begin(), other.template column<Is>().second.end(),
+            std::uninitialized_copy(other.template column<Is>().first.begin(), other.template column<Is>().first.end(), std::get<Is>(mColumns))), 0)...};
+    }
+
+    template <typename... Ts>
+    template <std::size_t... Is>
+    inline void RingBufferSoA<Ts...>::write_record(const size_type index, detail::index_sequence<Is...>, const Ts&... fields) noexcept {
+        (void)detail::expand_pack{0, (::new (static_cast<void*>(std::get<Is>(mColumns) + index)) Ts(fields), 0)...};
+    }
+
+    template <typename... Ts>
+    template <std::size_t... Is>
+    inline void RingBufferSoA<Ts...>::write_record(const size_type index, detail::index_sequence<Is...> indices, const value_type& record) noexcept {
+        write_record(index, indices, std::get<Is>(record)...);
+    }
+
+    template <typename... Ts>
+    template <std::size_t... Is>
+    inline typename RingBufferSoA<Ts...>::reference RingBufferSoA<Ts...>::make_reference(const size_type index, detail::index_sequence<Is...>) noexcept {
+        return reference(std::get<Is>(mColumns)[index]...);
+    }
+
+    template <typename... Ts>
+    template <std::size_t... Is>
+    inline typename RingBufferSoA<Ts...>::const_reference RingBufferSoA<Ts...>::make_reference(const size_type index, detail::index_sequence<Is...>) const noexcept {
+        return const_reference(std::get<Is>(mColumns)[index]...);
+    }
+
+    template <typename... Ts>
+    inline typename RingBufferSoA<Ts...>::size_type RingBufferSoA<Ts...>::next_write_index() noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(mCapacity > 0, "RingBufferSoA::push_back called on a moved-from buffer");
+        if (full()) {
+            // overwrite the oldest record
+            const size_type index = mHead;
+            mHead = storage_index(1);
+            return index;
+        }
+        ++mSize;
+        return storage_index(mSize - 1);
+    }
+} // namespace simpleContainers
+
+#endif // SIMPLE_RING_BUFFER_SOA_HPP
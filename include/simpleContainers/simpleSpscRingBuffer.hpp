@@ -0,0 +1,231 @@
+/// @file simpleSpscRingBuffer.hpp
+/// @brief File containing API and implementaiton of SpscRingBuffer class
+
+#ifndef SIMPLE_SPSC_RING_BUFFER_HPP
+#define SIMPLE_SPSC_RING_BUFFER_HPP
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+#include "simpleRingBuffer.hpp"
+
+// ============================================================================================================================================
+// =================================================================== API ====================================================================
+// ============================================================================================================================================
+
+namespace simpleContainers {
+    /// @brief Class representing a lock-free single-producer/single-consumer ring buffer
+    /// @details Unlike RingBuffer, SpscRingBuffer never overwrites elements. It is a bounded FIFO queue meant to pass elements
+    ///          from exactly one producer thread to exactly one consumer thread without locking. Insertion fails when the buffer
+    ///          is full and removal fails when it is empty. Read and write indices are atomics placed on separate cache lines,
+    ///          and each side keeps a cached copy of the other side's index so that the shared cache line is only touched when
+    ///          the cached value says the buffer looks full (producer) or empty (consumer).
+    ///          Only try_push, try_emplace are allowed to be called from the producer thread, and only try_pop, front and pop
+    ///          from the consumer thread. size and empty can be called from either thread, but the result is only a snapshot.
+    ///          The cache line alignment of the indices holds for objects with static or automatic storage. Before C++17,
+    ///          operator new only guarantees alignof(std::max_align_t), so a heap allocated SpscRingBuffer may start in the
+    ///          middle of a cache line and the indices can then share one with the neighbouring members or objects.
+    ///          Build with C++17 aligned new, or allocate it with suitably aligned storage, if that matters.
+    /// @tparam T Type of object contained inside SpscRingBuffer. T must be move constructible
+    /// @tparam Allocator Allocator for said type. Storage for capacity + 1 elements is allocated once on construction
+    template <typename T, typename Allocator = std::allocator<T>>
+    class SpscRingBuffer {
+        public:
+            using value_type = T;
+            using allocator_type = Allocator;
+            using reference = T&;
+            using const_reference = const T&;
+            using pointer = typename std::allocator_traits<allocator_type>::pointer;
+            using const_pointer = typename std::allocator_traits<allocator_type>::const_pointer;
+            using size_type = typename std::allocator_traits<allocator_type>::size_type;
+            using difference_type = typename std::allocator_traits<allocator_type>::difference_type;
+
+            SIMPLE_RING_BUFFER_STATIC_ASSERT((std::is_same<value_type, typename allocator_type::value_type>::value), "SpscRingBuffer::value_type and SpscRingBuffer::Allocator::value_type must be the same.");
+
+            /// @brief SpscRingBuffer cannot be constructed with 0 capacity so this arbitrary value was chosen as a default
+            static constexpr size_type defaultInitialCapacity = 64;
+
+            SpscRingBuffer(const size_type initialCapacity = defaultInitialCapacity, const allocator_type& alloc = allocator_type{});
+
+            SpscRingBuffer(const SpscRingBuffer& other) = delete;
+            SpscRingBuffer(SpscRingBuffer&& other) = delete;
+
+            SpscRingBuffer& operator=(const SpscRingBuffer& rhs) = delete;
+            SpscRingBuffer& operator=(SpscRingBuffer&& rhs) = delete;
+
+            ~SpscRingBuffer() noexcept;
+
+            allocator_type get_allocator() const noexcept;
+            size_type capacity() const noexcept;
+            /// @brief Approximate number of elements in the buffer
+            /// @details Exact only when neither the producer nor the consumer is running concurrently with the call
+            size_type size() const noexcept;
+            bool empty() const noexcept;
+
+            /// @brief Try to insert a copy of elem (producer only)
+            /// @return true if the element was inserted, false if the buffer was full
+            bool try_push(const value_type& elem);
+            /// @brief Try to insert elem by moving it (producer only)
+            /// @return true if the element was inserted, false if the buffer was full. elem is not moved from on failure
+            bool try_push(value_type&& elem);
+            /// @brief Try to construct an element in place from args (producer only)
+            /// @return true if the element was constructed, false if the buffer was full. No object is constructed on failure
+            template <typename ...Args>
+            bool try_emplace(Args&&... args);
+
+            /// @brief Try to move the oldest element into out and remove it (consumer only)
+            /// @return true if an element was removed, false if the buffer was empty
+            bool try_pop(value_type& out);
+            /// @brief Access the oldest element without removing it (consumer only)
+            /// @return Pointer to the oldest element, or nullptr if the buffer is empty
+            value_type* front() noexcept;
+            /// @brief Remove the oldest element (consumer only)
+            /// @details Must only be called after front() returned a non null pointer
+            void pop() noexcept;
+
+        private:
+            using allocator_traits = std::allocator_traits<allocator_type>;
+
+            size_type next_index(const size_type index) const noexcept;
+
+            allocator_type mAllocator;
+            size_type mCapacity;
+            // one slot is always left empty so that a full buffer can be told apart from an empty one
+            size_type mSlotCount;
+            pointer mSlots;
+
+            // written by the producer, read by the consumer
+            alignas(SIMPLE_RING_BUFFER_CACHE_LINE_SIZE) std::atomic<size_type> mWriteIndex;
+            // producer local copy of mReadIndex
+            size_type mCachedReadIndex;
+
+            // written by the consumer, read by the producer
+            alignas(SIMPLE_RING_BUFFER_CACHE_LINE_SIZE) std::atomic<size_type> mReadIndex;
+            // consumer local copy of mWriteIndex
+            size_type mCachedWriteIndex;
+    };
+} // namespace simpleContainers
+
+// ============================================================================================================================================
+// ============================================================== IMPLEMENTATION ==============================================================
+// ============================================================================================================================================
+
+namespace simpleContainers {
+    template <typename T, typename Allocator>
+    inline SpscRingBuffer<T, Allocator>::SpscRingBuffer(const size_type initialCapacity, const allocator_type& alloc)
+        : mAllocator{alloc}, mCapacity{initialCapacity}, mSlotCount{initialCapacity + 1}, mSlots{nullptr},
+          mWriteIndex{0}, mCachedReadIndex{0}, mReadIndex{0}, mCachedWriteIndex{0}
+    {
+        SIMPLE_RING_BUFFER_ASSERT(initialCapacity != 0, "SpscRingBuffer must not be constructed with initial capacity of 0");
+        mSlots = allocator_traits::allocate(mAllocator, mSlotCount);
+    }
+
+    template <typename T, typename Allocator>
+    inline SpscRingBuffer<T, Allocator>::~SpscRingBuffer() noexcept {
+        while (front() != nullptr) {
+            pop();
+        }
+
+        allocator_traits::deallocate(mAllocator, mSlots, mSlotCount);
+    }
+
+    template <typename T, typename Allocator>
+    inline typename SpscRingBuffer<T, Allocator>::allocator_type SpscRingBuffer<T, Allocator>::get_allocator() const noexcept {
+        return mAllocator;
+    }
+
+    template <typename T, typename Allocator>
+    inline typename SpscRingBuffer<T, Allocator>::size_type SpscRingBuffer<T, Allocator>::capacity() const noexcept {
+        return mCapacity;
+    }
+
+    template <typename T, typename Allocator>
+    inline typename SpscRingBuffer<T, Allocator>::size_type SpscRingBuffer<T, Allocator>::size() const noexcept {
+        const size_type writeIndex = mWriteIndex.load(std::memory_order_acquire);
+        const size_type readIndex = mReadIndex.load(std::memory_order_acquire);
+
+        if (writeIndex >= readIndex) {
+            return writeIndex - readIndex;
+        }
+
+        return mSlotCount - readIndex + writeIndex;
+    }
+
+    template <typename T, typename Allocator>
+    inline bool SpscRingBuffer<T, Allocator>::empty() const noexcept {
+        return mWriteIndex.load(std::memory_order_acquire) == mReadIndex.load(std::memory_order_acquire);
+    }
+
+    template <typename T, typename Allocator>
+    inline bool SpscRingBuffer<T, Allocator>::try_push(const value_type& elem) {
+        return try_emplace(elem);
+    }
+
+    template <typename T, typename Allocator>
+    inline bool SpscRingBuffer<T, Allocator>::try_push(value_type&& elem) {
+        return try_emplace(std::move(elem));
+    }
+
+    template <typename T, typename Allocator>
+    template <typename ...Args>
+    inline bool SpscRingBuffer<T, Allocator>::try_emplace(Args&&... args) {
+        const size_type writeIndex = mWriteIndex.load(std::memory_order_relaxed);
+        const size_type nextWriteIndex = next_index(writeIndex);
+
+        if (nextWriteIndex == mCachedReadIndex) {   // looks full, refresh the cached value before giving up
+            mCachedReadIndex = mReadIndex.load(std::memory_order_acquire);
+            if (nextWriteIndex == mCachedReadIndex) {
+                return false;
+            }
+        }
+
+        allocator_traits::construct(mAllocator, &mSlots[writeIndex], std::forward<Args>(args)...);
+        mWriteIndex.store(nextWriteIndex, std::memory_order_release);
+        return true;
+    }
+
+    template <typename T, typename Allocator>
+    inline bool SpscRingBuffer<T, Allocator>::try_pop(value_type& out) {
+        value_type* elem = front();
+        if (elem == nullptr) {
+            return false;
+        }
+
+        out = std::move(*elem);
+        pop();
+        return true;
+    }
+
+    template <typename T, typename Allocator>
+    inline typename SpscRingBuffer<T, Allocator>::value_type* SpscRingBuffer<T, Allocator>::front() noexcept {
+        const size_type readIndex = mReadIndex.load(std::memory_order_relaxed);
+
+        if (readIndex == mCachedWriteIndex) {   // looks empty, refresh the cached value before giving up
+            mCachedWriteIndex = mWriteIndex.load(std::memory_order_acquire);
+            if (readIndex == mCachedWriteIndex) {
+                return nullptr;
+            }
+        }
+
+        return &mSlots[readIndex];
+    }
+
+    template <typename T, typename Allocator>
+    inline void SpscRingBuffer<T, Allocator>::pop() noexcept {
+        const size_type readIndex = mReadIndex.load(std::memory_order_relaxed);
+        SIMPLE_RING_BUFFER_ASSERT(readIndex != mWriteIndex.load(std::memory_order_acquire), "SpscRingBuffer::pop called on an empty buffer");
+
+        allocator_traits::destroy(mAllocator, &mSlots[readIndex]);
+        mReadIndex.store(next_index(readIndex), std::memory_order_release);
+    }
+
+    template <typename T, typename Allocator>
+    inline typename SpscRingBuffer<T, Allocator>::size_type SpscRingBuffer<T, Allocator>::next_index(const size_type index) const noexcept {
+        const size_type next = index + 1;
+        return next == mSlotCount ? 0 : next;
+    }
+
+} // namespace simpleContainers
+
+#endif // SIMPLE_SPSC_RING_BUFFER_HPP
@@ -0,0 +1,635 @@
+/// @file simpleStaticRingBuffer.hpp
+/// @brief File containing API and implementaiton of StaticRingBuffer class
+
+#ifndef SIMPLE_STATIC_RING_BUFFER_HPP
+#define SIMPLE_STATIC_RING_BUFFER_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "simpleRingBuffer.hpp"
+
+// ============================================================================================================================================
+// =================================================================== API ====================================================================
+// ============================================================================================================================================
+
+namespace simpleContainers {
+    template <typename T, std::size_t N>
+    class StaticRingBuffer;
+
+    template <typename T, std::size_t N>
+    inline bool operator==(const StaticRingBuffer<T, N>& lhs, const StaticRingBuffer<T, N>& rhs) noexcept;
+
+    template <typename T, std::size_t N>
+    inline bool operator!=(const StaticRingBuffer<T, N>& lhs, const StaticRingBuffer<T, N>& rhs) noexcept;
+
+    template <typename T, std::size_t N>
+    inline bool operator<(const StaticRingBuffer<T, N>& lhs, const StaticRingBuffer<T, N>& rhs) noexcept;
+
+    template <typename T, std::size_t N>
+    inline bool operator<=(const StaticRingBuffer<T, N>& lhs, const StaticRingBuffer<T, N>& rhs) noexcept;
+
+    template <typename T, std::size_t N>
+    inline bool operator>(const StaticRingBuffer<T, N>& lhs, const StaticRingBuffer<T, N>& rhs) noexcept;
+
+    template <typename T, std::size_t N>
+    inline bool operator>=(const StaticRingBuffer<T, N>& lhs, const StaticRingBuffer<T, N>& rhs) noexcept;
+
+    /// @brief Class representing a ring buffer structure with a capacity fixed at compile time
+    /// @details Behaves like RingBuffer of capacity N: it holds at most the last N inserted elements and every insertion
+    ///          after the N-th overwrites the oldest element. Elements are stored inline in an aligned array inside the object,
+    ///          so no heap allocation is ever made and there is no pointer indirection when accessing them.
+    ///          When N is a power of two, wrapping an index around the end of the storage is a single mask operation.
+    ///          A strict weak ordering can be established between instances of StaticRingBuffer, behavior is the same as std::vector
+    /// @tparam T Type of object contained inside StaticRingBuffer
+    /// @tparam N Capacity of the buffer, must not be 0
+    template <typename T, std::size_t N>
+    class StaticRingBuffer {
+        public:
+            using value_type = T;
+            using reference = T&;
+            using const_reference = const T&;
+            using pointer = T*;
+            using const_pointer = const T*;
+            using size_type = std::size_t;
+            using difference_type = std::ptrdiff_t;
+
+            SIMPLE_RING_BUFFER_STATIC_ASSERT((N != 0), "StaticRingBuffer capacity must not be 0.");
+            SIMPLE_RING_BUFFER_STATIC_ASSERT((!std::is_same<value_type, bool>::value), "StaticRingBuffer<bool> currently not supported.");
+
+            /// @brief Class representing iterators over StaticRingBuffer
+            /// @details StaticRingBuffer iterators are compliant with the LegacyRandomAccessIterator named requirement.
+            ///          All methods are O(1) time complexity
+            /// @tparam constTag Compile time indicator if iterator is a const iterator or not
+            template <bool constTag = false>
+            class StaticRingBufferIterator {
+                public:
+                    friend class StaticRingBufferIterator<false>;
+                    friend class StaticRingBufferIterator<true>;
+
+                    using iterator_category = std::random_access_iterator_tag;
+                    using size_type = typename StaticRingBuffer<T, N>::size_type;
+                    using difference_type = typename StaticRingBuffer<T, N>::difference_type;
+                    using value_type = typename StaticRingBuffer<T, N>::value_type;
+                    using pointer = typename std::conditional<constTag, typename StaticRingBuffer<T, N>::const_pointer, typename StaticRingBuffer<T, N>::pointer>::type;
+                    using reference = typename std::conditional<constTag, typename StaticRingBuffer<T, N>::const_reference, typename StaticRingBuffer<T, N>::reference>::type;
+                    using ring_buffer_ptr = typename std::conditional<constTag, const StaticRingBuffer<T, N>*, StaticRingBuffer<T, N>*>::type;
+
+                    StaticRingBufferIterator(size_type pos = 0, ring_buffer_ptr rb = nullptr) noexcept;
+                    StaticRingBufferIterator(const StaticRingBufferIterator& other) noexcept = default;
+                    /// @brief Converting constructor to create a const iterator from a non-const iterator
+                    /// @details By using SFINAE, this constructor is only available for const iterators since they must
+                    ///          be implicitly constructible from a non-const iterator
+                    template <bool C = constTag, typename = typename std::enable_if<C>::type>
+                    StaticRingBufferIterator(const StaticRingBufferIterator<false>& other) noexcept;
+                    StaticRingBufferIterator(StaticRingBufferIterator&& other) noexcept = default;
+                    StaticRingBufferIterator& operator=(const StaticRingBufferIterator& rhs) noexcept = default;
+                    StaticRingBufferIterator& operator=(StaticRingBufferIterator&& rhs) noexcept = default;
+                    ~StaticRingBufferIterator() noexcept = default;
+
+                    void swap(StaticRingBufferIterator& other) noexcept;
+
+                    reference operator*() const noexcept;
+                    pointer operator->() const noexcept;
+
+                    reference operator[](const difference_type n) const noexcept;
+
+                    StaticRingBufferIterator& operator++() noexcept; // prefix
+                    StaticRingBufferIterator operator++(int) noexcept; // postfix
+                    StaticRingBufferIterator& operator+=(const difference_type n) noexcept;
+                    StaticRingBufferIterator operator+(const difference_type n) const noexcept;
+                    friend StaticRingBufferIterator operator+(const difference_type n, StaticRingBufferIterator rhs) noexcept {
+                        rhs += n;
+                        return rhs;
+                    }
+
+                    StaticRingBufferIterator& operator--() noexcept; // prefix
+                    StaticRingBufferIterator operator--(int) noexcept; // postfix
+                    StaticRingBufferIterator& operator-=(const difference_type n) noexcept;
+                    StaticRingBufferIterator operator-(const difference_type n) const noexcept;
+                    difference_type operator-(const StaticRingBufferIterator& other) const noexcept; // Subtraction between two iterators
+
+                    friend bool operator==(const StaticRingBufferIterator& lhs, const StaticRingBufferIterator& rhs) noexcept {
+                        SIMPLE_RING_BUFFER_ASSERT(lhs.mRingBufPtr == rhs.mRingBufPtr, "StaticRingBufferIterator == comparison must be done on iterators of the same StaticRingBuffer");
+                        return lhs.mPosition == rhs.mPosition;
+                    }
+
+                    friend bool operator!=(const StaticRingBufferIterator& lhs, const StaticRingBufferIterator& rhs) noexcept {
+                        SIMPLE_RING_BUFFER_ASSERT(lhs.mRingBufPtr == rhs.mRingBufPtr, "StaticRingBufferIterator != comparison must be done on iterators of the same StaticRingBuffer");
+                        return lhs.mPosition != rhs.mPosition;
+                    }
+
+                    friend bool operator<(const StaticRingBufferIterator& lhs, const StaticRingBufferIterator& rhs) noexcept {
+                        SIMPLE_RING_BUFFER_ASSERT(lhs.mRingBufPtr == rhs.mRingBufPtr, "StaticRingBufferIterator < comparison must be done on iterators of the same StaticRingBuffer");
+                        return lhs.mPosition < rhs.mPosition;
+                    }
+
+                    friend bool operator<=(const StaticRingBufferIterator& lhs, const StaticRingBufferIterator& rhs) noexcept {
+                        SIMPLE_RING_BUFFER_ASSERT(lhs.mRingBufPtr == rhs.mRingBufPtr, "StaticRingBufferIterator <= comparison must be done on iterators of the same StaticRingBuffer");
+                        return lhs.mPosition <= rhs.mPosition;
+                    }
+
+                    friend bool operator>(const StaticRingBufferIterator& lhs, const StaticRingBufferIterator& rhs) noexcept {
+                        SIMPLE_RING_BUFFER_ASSERT(lhs.mRingBufPtr == rhs.mRingBufPtr, "StaticRingBufferIterator > comparison must be done on iterators of the same StaticRingBuffer");
+                        return lhs.mPosition > rhs.mPosition;
+                    }
+
+                    friend bool operator>=(const StaticRingBufferIterator& lhs, const StaticRingBufferIterator& rhs) noexcept {
+                        SIMPLE_RING_BUFFER_ASSERT(lhs.mRingBufPtr == rhs.mRingBufPtr, "StaticRingBufferIterator >= comparison must be done on iterators of the same StaticRingBuffer");
+                        return lhs.mPosition >= rhs.mPosition;
+                    }
+
+                private:
+                    // mPosition represents the element in order from oldest to newest inserted, it is not the actual
+                    // offset position from beginning of the storage
+                    size_type mPosition;
+                    ring_buffer_ptr mRingBufPtr;
+            };
+
+            using iterator = StaticRingBufferIterator<false>;
+            using const_iterator = StaticRingBufferIterator<true>;
+
+        public:
+            StaticRingBuffer() noexcept;
+            /// @brief Construct a full buffer with N copies of val
+            explicit StaticRingBuffer(const value_type& val);
+            /// @brief Construct from an initializer list. If it holds more than N elements, only the last N are kept
+            StaticRingBuffer(std::initializer_list<value_type> initList);
+            /// @brief Construct from an iterator range. If it holds more than N elements, only the last N are kept
+            template <typename Iterator>
+            StaticRingBuffer(Iterator itStart, Iterator itEnd);
+
+            StaticRingBuffer(const StaticRingBuffer& other);
+            StaticRingBuffer(StaticRingBuffer&& other) noexcept(std::is_nothrow_move_constructible<value_type>::value);
+
+            StaticRingBuffer& operator=(const StaticRingBuffer& rhs);
+            StaticRingBuffer& operator=(StaticRingBuffer&& rhs) noexcept(std::is_nothrow_move_constructible<value_type>::value);
+
+            ~StaticRingBuffer() noexcept;
+
+            size_type capacity() const noexcept;
+            size_type size() const noexcept;
+            size_type max_size() const noexcept;
+            bool empty() const noexcept;
+            bool full() const noexcept;
+            void clear() noexcept;
+
+            /// @brief Get elements in StaticRingBuffer in order they were inserted (oldest first)
+            std::vector<value_type> get_elements() const;
+
+            void push_back(const value_type& elem);
+            void push_back(value_type&& elem);
+            template <typename ...Args>
+            void emplace_back(Args&&... args);
+
+            /// @brief Swap contents with other
+            /// @details Elements are stored inline, so unlike RingBuffer::swap this is O(n)
+            void swap(StaticRingBuffer& other);
+
+            /// @brief Subscript operator
+            /// @details Indexing is done in insertion order, so the oldest element will be at position 0, the second oldest at position 1 etc.
+            ///          This operator performs out of range checks for pos only when SIMPLE_RING_BUFFER_DEBUG is defined
+            /// @return Reference to element at index pos.
+            reference operator[](const size_type& pos) noexcept;
+            /// @brief Subscript operator
+            /// @details Indexing is done in insertion order, so the oldest element will be at position 0, the second oldest at position 1 etc.
+            ///          This operator performs out of range checks for pos only when SIMPLE_RING_BUFFER_DEBUG is defined
+            const_reference operator[](const size_type& pos) const noexcept;
+            /// @brief Access element at specified position
+            /// @details Indexing is done in insertion order, so the oldest element will be at position 0, the second oldest at position 1 etc.
+            ///          Validity of pos is always checked
+            reference at(const size_type& pos);
+            /// @brief Access element at specified position
+            /// @details Indexing is done in insertion order, so the oldest element will be at position 0, the second oldest at position 1 etc.
+            ///          Validity of pos is always checked
+            const_reference at(const size_type& pos) const;
+
+            iterator begin() noexcept;
+            iterator end() noexcept;
+            const_iterator begin() const noexcept;
+            const_iterator end() const noexcept;
+            const_iterator cbegin() const noexcept;
+            const_iterator cend() const noexcept;
+
+        private:
+            static constexpr bool capacityIsPowerOfTwo = (N & (N - 1)) == 0;
+
+            /// @brief Map an index in [0, 2N) to a storage index in [0, N)
+            static size_type wrap(const size_type index) noexcept;
+
+            pointer slot(const size_type storageIndex) noexcept;
+            const_pointer slot(const size_type storageIndex) const noexcept;
+
+            typename std::aligned_storage<sizeof(value_type), alignof(value_type)>::type mStorage[N];
+            // storage index of the oldest element
+            size_type mHead;
+            size_type mSize;
+    };
+} // namespace simpleContainers
+
+// ============================================================================================================================================
+// ============================================================== IMPLEMENTATION ==============================================================
+// ============================================================================================================================================
+
+namespace simpleContainers {
+    template <typename T, std::size_t N>
+    template <bool constTag>
+    inline StaticRingBuffer<T, N>::StaticRingBufferIterator<constTag>::StaticRingBufferIterator(size_type pos, ring_buffer_ptr rb) noexcept
+        : mPosition{pos}, mRingBufPtr{rb}
+    {}
+
+    template <typename T, std::size_t N>
+    template <bool constTag>
+    template <bool C, typename>
+    inline StaticRingBuffer<T, N>::StaticRingBufferIterator<constTag>::StaticRingBufferIterator(const StaticRingBuffer<T, N>::StaticRingBufferIterator<false> &other) noexcept
+        : mPosition{other.mPosition}, mRingBufPtr{other.mRingBufPtr}
+    {}
+
+    template <typename T, std::size_t N>
+    template <bool constTag>
+    inline void StaticRingBuffer<T, N>::StaticRingBufferIterator<constTag>::swap(StaticRingBufferIterator& other) noexcept {
+        std::swap(mPosition, other.mPosition);
+        std::swap(mRingBufPtr, other.mRingBufPtr);
+    }
+
+    template <typename T, std::size_t N>
+    template <bool constTag>
+    inline typename StaticRingBuffer<T, N>::template StaticRingBufferIterator<constTag>::reference
+    StaticRingBuffer<T, N>::StaticRingBufferIterator<constTag>::operator*() const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(mRingBufPtr != nullptr, "StaticRingBufferIterator::operator* trying to dereference mRingBufPtr which is a nullptr");
+        return (*mRingBufPtr)[mPosition];
+    }
+
+    template <typename T, std::size_t N>
+    template <bool constTag>
+    inline typename StaticRingBuffer<T, N>::template StaticRingBufferIterator<constTag>::pointer
+    StaticRingBuffer<T, N>::StaticRingBufferIterator<constTag>::operator->() const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(mRingBufPtr != nullptr, "StaticRingBufferIterator::operator-> trying to dereference mRingBufPtr which is a nullptr");
+        return &((*mRingBufPtr)[mPosition]);
+    }
+
+    template <typename T, std::size_t N>
+    template <bool constTag>
+    inline typename StaticRingBuffer<T, N>::template StaticRingBufferIterator<constTag>::reference
+    StaticRingBuffer<T, N>::StaticRingBufferIterator<constTag>::operator[](const difference_type n) const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(mRingBufPtr != nullptr, "StaticRingBufferIterator::operator[] trying to dereference mRingBufPtr which is a nullptr");
+        return (*mRingBufPtr)[mPosition + static_cast<size_type>(n)];
+    }
+
+    template <typename T, std::size_t N>
+    template <bool constTag>
+    inline typename StaticRingBuffer<T, N>::template StaticRingBufferIterator<constTag>&
+    StaticRingBuffer<T, N>::StaticRingBufferIterator<constTag>::operator++() noexcept {
+        ++mPosition;
+        return *this;
+    }
+
+    template <typename T, std::size_t N>
+    template <bool constTag>
+    inline typename StaticRingBuffer<T, N>::template StaticRingBufferIterator<constTag>
+    StaticRingBuffer<T, N>::StaticRingBufferIterator<constTag>::operator++(int) noexcept {
+        StaticRingBufferIterator tmp = *this;
+        ++(*this);
+        return tmp;
+    }
+
+    template <typename T, std::size_t N>
+    template <bool constTag>
+    inline typename StaticRingBuffer<T, N>::template StaticRingBufferIterator<constTag>&
+    StaticRingBuffer<T, N>::StaticRingBufferIterator<constTag>::operator+=(const difference_type n) noexcept {
+        mPosition += static_cast<size_type>(n);
+        return *this;
+    }
+
+    template <typename T, std::size_t N>
+    template <bool constTag>
+    inline typename StaticRingBuffer<T, N>::template StaticRingBufferIterator<constTag>
+    StaticRingBuffer<T, N>::StaticRingBufferIterator<constTag>::operator+(const difference_type n) const noexcept {
+        return StaticRingBufferIterator<constTag>(mPosition + static_cast<size_type>(n), mRingBufPtr);
+    }
+
+    template <typename T, std::size_t N>
+    template <bool constTag>
+    inline typename StaticRingBuffer<T, N>::template StaticRingBufferIterator<constTag>&
+    StaticRingBuffer<T, N>::StaticRingBufferIterator<constTag>::operator--() noexcept {
+        --mPosition;
+        return *this;
+    }
+
+    template <typename T, std::size_t N>
+    template <bool constTag>
+    inline typename StaticRingBuffer<T, N>::template StaticRingBufferIterator<constTag>
+    StaticRingBuffer<T, N>::StaticRingBufferIterator<constTag>::operator--(int) noexcept {
+        StaticRingBufferIterator tmp = *this;
+        --(*this);
+        return tmp;
+    }
+
+    template <typename T, std::size_t N>
+    template <bool constTag>
+    inline typename StaticRingBuffer<T, N>::template StaticRingBufferIterator<constTag>&
+    StaticRingBuffer<T, N>::StaticRingBufferIterator<constTag>::operator-=(const difference_type n) noexcept {
+        mPosition -= static_cast<size_type>(n);
+        return *this;
+    }
+
+    template <typename T, std::size_t N>
+    template <bool constTag>
+    inline typename StaticRingBuffer<T, N>::template StaticRingBufferIterator<constTag>
+    StaticRingBuffer<T, N>::StaticRingBufferIterator<constTag>::operator-(const difference_type n) const noexcept {
+        return StaticRingBufferIterator<constTag>(mPosition - static_cast<size_type>(n), mRingBufPtr);
+    }
+
+    template <typename T, std::size_t N>
+    template <bool constTag>
+    inline typename StaticRingBuffer<T, N>::template StaticRingBufferIterator<constTag>::difference_type
+    StaticRingBuffer<T, N>::StaticRingBufferIterator<constTag>::operator-(const StaticRingBufferIterator& other) const noexcept {
+        return static_cast<difference_type>(mPosition - other.mPosition);
+    }
+
+    template <typename T, std::size_t N>
+    inline StaticRingBuffer<T, N>::StaticRingBuffer() noexcept
+        : mHead{0}, mSize{0}
+    {}
+
+    template <typename T, std::size_t N>
+    inline StaticRingBuffer<T, N>::StaticRingBuffer(const value_type& val)
+        : StaticRingBuffer()
+    {
+        for (size_type i = 0; i < N; ++i) {
+            push_back(val);
+        }
+    }
+
+    template <typename T, std::size_t N>
+    inline StaticRingBuffer<T, N>::StaticRingBuffer(std::initializer_list<value_type> initList)
+        : StaticRingBuffer(initList.begin(), initList.end())
+    {}
+
+    template <typename T, std::size_t N>
+    template <typename Iterator>
+    inline StaticRingBuffer<T, N>::StaticRingBuffer(Iterator itStart, Iterator itEnd)
+        : StaticRingBuffer()
+    {
+        for (; itStart != itEnd; ++itStart) {
+            push_back(*itStart);
+        }
+    }
+
+    template <typename T, std::size_t N>
+    inline StaticRingBuffer<T, N>::StaticRingBuffer(const StaticRingBuffer& other)
+        : StaticRingBuffer()
+    {
+        for (size_type i = 0; i < other.mSize; ++i) {
+            ::new (static_cast<void*>(slot(i))) value_type(other[i]);
+            ++mSize;
+        }
+    }
+
+    template <typename T, std::size_t N>
+    inline StaticRingBuffer<T, N>::StaticRingBuffer(StaticRingBuffer&& other) noexcept(std::is_nothrow_move_constructible<value_type>::value)
+        : StaticRingBuffer()
+    {
+        for (size_type i = 0; i < other.mSize; ++i) {
+            ::new (static_cast<void*>(slot(i))) value_type(std::move(other[i]));
+            ++mSize;
+        }
+        other.clear();
+    }
+
+    template <typename T, std::size_t N>
+    inline StaticRingBuffer<T, N>& StaticRingBuffer<T, N>::operator=(const StaticRingBuffer& rhs) {
+        if (this != &rhs) {
+            clear();
+            for (size_type i = 0; i < rhs.mSize; ++i) {
+                ::new (static_cast<void*>(slot(i))) value_type(rhs[i]);
+                ++mSize;
+            }
+        }
+        return *this;
+    }
+
+    template <typename T, std::size_t N>
+    inline StaticRingBuffer<T, N>& StaticRingBuffer<T, N>::operator=(StaticRingBuffer&& rhs) noexcept(std::is_nothrow_move_constructible<value_type>::value) {
+        if (this != &rhs) {
+            clear();
+            for (size_type i = 0; i < rhs.mSize; ++i) {
+                ::new (static_cast<void*>(slot(i))) value_type(std::move(rhs[i]));
+                ++mSize;
+            }
+            rhs.clear();
+        }
+        return *this;
+    }
+
+    template <typename T, std::size_t N>
+    inline StaticRingBuffer<T, N>::~StaticRingBuffer() noexcept {
+        clear();
+    }
+
+    template <typename T, std::size_t N>
+    inline typename StaticRingBuffer<T, N>::size_type StaticRingBuffer<T, N>::capacity() const noexcept {
+        return N;
+    }
+
+    template <typename T, std::size_t N>
+    inline typename StaticRingBuffer<T, N>::size_type StaticRingBuffer<T, N>::size() const noexcept {
+        return mSize;
+    }
+
+    template <typename T, std::size_t N>
+    inline typename StaticRingBuffer<T, N>::size_type StaticRingBuffer<T, N>::max_size() const noexcept {
+        return N;
+    }
+
+    template <typename T, std::size_t N>
+    inline bool StaticRingBuffer<T, N>::empty() const noexcept {
+        return mSize == 0;
+    }
+
+    template <typename T, std::size_t N>
+    inline bool StaticRingBuffer<T, N>::full() const noexcept {
+        return mSize == N;
+    }
+
+    template <typename T, std::size_t N>
+    inline void StaticRingBuffer<T, N>::clear() noexcept {
+        if (!std::is_trivially_destructible<value_type>::value) {
+            for (size_type i = 0; i < mSize; ++i) {
+                slot(wrap(mHead + i))->~value_type();
+            }
+        }
+
+        mHead = 0;
+        mSize = 0;
+    }
+
+    template <typename T, std::size_t N>
+    inline std::vector<typename StaticRingBuffer<T, N>::value_type> StaticRingBuffer<T, N>::get_elements() const {
+        return std::vector<value_type>(begin(), end());
+    }
+
+    template <typename T, std::size_t N>
+    inline void StaticRingBuffer<T, N>::push_back(const value_type& elem) {
+        if (mSize == N) {   // most common case
+            *slot(mHead) = elem;
+            mHead = wrap(mHead + 1);
+        }
+        else {  // only happens during the initial filling
+            ::new (static_cast<void*>(slot(wrap(mHead + mSize)))) value_type(elem);
+            ++mSize;
+        }
+    }
+
+    template <typename T, std::size_t N>
+    inline void StaticRingBuffer<T, N>::push_back(value_type&& elem) {
+        if (mSize == N) {   // most common case
+            *slot(mHead) = std::move(elem);
+            mHead = wrap(mHead + 1);
+        }
+        else {  // only happens during the initial filling
+            ::new (static_cast<void*>(slot(wrap(mHead + mSize)))) value_type(std::move(elem));
+            ++mSize;
+        }
+    }
+
+    template <typename T, std::size_t N>
+    template <typename ...Args>
+    inline void StaticRingBuffer<T, N>::emplace_back(Args&&... args) {
+        if (mSize == N) {   // most common case
+            *slot(mHead) = value_type(std::forward<Args>(args)...);
+            mHead = wrap(mHead + 1);
+        }
+        else {  // only happens during the initial filling
+            ::new (static_cast<void*>(slot(wrap(mHead + mSize)))) value_type(std::forward<Args>(args)...);
+            ++mSize;
+        }
+    }
+
+    template <typename T, std::size_t N>
+    inline void StaticRingBuffer<T, N>::swap(StaticRingBuffer& other) {
+        StaticRingBuffer tmp{std::move(other)};
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+
+    template <typename T, std::size_t N>
+    inline typename StaticRingBuffer<T, N>::reference StaticRingBuffer<T, N>::operator[](const size_type& pos) noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(pos < mSize, "StaticRingBuffer subscript operator out of range");
+        return *slot(wrap(mHead + pos));
+    }
+
+    template <typename T, std::size_t N>
+    inline typename StaticRingBuffer<T, N>::const_reference StaticRingBuffer<T, N>::operator[](const size_type& pos) const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(pos < mSize, "StaticRingBuffer subscript operator out of range");
+        return *slot(wrap(mHead + pos));
+    }
+
+    template <typename T, std::size_t N>
+    inline typename StaticRingBuffer<T, N>::reference StaticRingBuffer<T, N>::at(const size_type& pos) {
+        if (pos >= mSize) {
+            throw std::out_of_range("StaticRingBuffer::at position out of range");
+        }
+
+        return *slot(wrap(mHead + pos));
+    }
+
+    template <typename T, std::size_t N>
+    inline typename StaticRingBuffer<T, N>::const_reference StaticRingBuffer<T, N>::at(const size_type& pos) const {
+        if (pos >= mSize) {
+            throw std::out_of_range("StaticRingBuffer::at position out of range");
+        }
+
+        return *slot(wrap(mHead + pos));
+    }
+
+    template <typename T, std::size_t N>
+    inline typename StaticRingBuffer<T, N>::iterator StaticRingBuffer<T, N>::begin() noexcept {
+        return iterator{0, this};
+    }
+
+    template <typename T, std::size_t N>
+    inline typename StaticRingBuffer<T, N>::iterator StaticRingBuffer<T, N>::end() noexcept {
+        return iterator{mSize, this};
+    }
+
+    template <typename T, std::size_t N>
+    inline typename StaticRingBuffer<T, N>::const_iterator StaticRingBuffer<T, N>::begin() const noexcept {
+        return const_iterator{0, this};
+    }
+
+    template <typename T, std::size_t N>
+    inline typename StaticRingBuffer<T, N>::const_iterator StaticRingBuffer<T, N>::end() const noexcept {
+        return const_iterator{mSize, this};
+    }
+
+    template <typename T, std::size_t N>
+    inline typename StaticRingBuffer<T, N>::const_iterator StaticRingBuffer<T, N>::cbegin() const noexcept {
+        return begin();
+    }
+
+    template <typename T, std::size_t N>
+    inline typename StaticRingBuffer<T, N>::const_iterator StaticRingBuffer<T, N>::cend() const noexcept {
+        return end();
+    }
+
+    template <typename T, std::size_t N>
+    inline typename StaticRingBuffer<T, N>::size_type StaticRingBuffer<T, N>::wrap(const size_type index) noexcept {
+        // capacityIsPowerOfTwo is a compile time constant so only one of the branches is ever generated
+        if (capacityIsPowerOfTwo) {
+            return index & (N - 1);
+        }
+
+        return index >= N ? index - N : index;
+    }
+
+    template <typename T, std::size_t N>
+    inline typename StaticRingBuffer<T, N>::pointer StaticRingBuffer<T, N>::slot(const size_type storageIndex) noexcept {
+        return reinterpret_cast<pointer>(&mStorage[storageIndex]);
+    }
+
+    template <typename T, std::size_t N>
+    inline typename StaticRingBuffer<T, N>::const_pointer StaticRingBuffer<T, N>::slot(const size_type storageIndex) const noexcept {
+        return reinterpret_cast<const_pointer>(&mStorage[storageIndex]);
+    }
+
+    template <typename T, std::size_t N>
+    inline bool operator==(const StaticRingBuffer<T, N>& lhs, const StaticRingBuffer<T, N>& rhs) noexcept {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template <typename T, std::size_t N>
+    inline bool operator!=(const StaticRingBuffer<T, N>& lhs, const StaticRingBuffer<T, N>& rhs) noexcept {
+        return !(lhs == rhs);
+    }
+
+    template <typename T, std::size_t N>
+    inline bool operator<(const StaticRingBuffer<T, N>& lhs, const StaticRingBuffer<T, N>& rhs) noexcept {
+        return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <typename T, std::size_t N>
+    inline bool operator<=(const StaticRingBuffer<T, N>& lhs, const StaticRingBuffer<T, N>& rhs) noexcept {
+        return !(rhs < lhs);
+    }
+
+    template <typename T, std::size_t N>
+    inline bool operator>(const StaticRingBuffer<T, N>& lhs, const StaticRingBuffer<T, N>& rhs) noexcept {
+        return rhs < lhs;
+    }
+
+    template <typename T, std::size_t N>
+    inline bool operator>=(const StaticRingBuffer<T, N>& lhs, const StaticRingBuffer<T, N>& rhs) noexcept {
+        return !(lhs < rhs);
+    }
+
+} // namespace simpleContainers
+
+#endif // SIMPLE_STATIC_RING_BUFFER_HPP
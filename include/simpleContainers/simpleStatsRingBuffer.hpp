@@ -0,0 +1,379 @@
+/// @file simpleStatsRingBuffer.hpp
+/// @brief File containing API and implementaiton of StatsRingBuffer class
+
+#ifndef SIMPLE_STATS_RING_BUFFER_HPP
+#define SIMPLE_STATS_RING_BUFFER_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "simpleRingBuffer.hpp"
+
+// ============================================================================================================================================
+// =================================================================== API ====================================================================
+// ============================================================================================================================================
+
+namespace simpleContainers {
+    /// @brief Floating point accumulator using compensated (Kahan-Babuska-Neumaier) summation
+    /// @details Keeps the rounding error of every addition in a separate term, so the error of the result does not grow with
+    ///          the number of additions. Unlike plain Kahan summation, the error is also kept when the added value is larger
+    ///          than the running sum, which happens when values are subtracted back out of it
+    class CompensatedSum {
+        public:
+            CompensatedSum() noexcept = default;
+
+            void add(const double value) noexcept;
+            void reset() noexcept;
+            double value() const noexcept;
+
+        private:
+            double mSum = 0.0;
+            double mCompensation = 0.0;
+    };
+
+    /// @brief RingBuffer of arithmetic elements that keeps statistics of the elements it currently holds
+    /// @details Statistics are updated in O(1) whenever an element is inserted or evicted, so mean, variance and standard
+    ///          deviation of the window are O(1) queries instead of a pass over all elements.
+    ///          Sums are compensated (see CompensatedSum) and taken relative to the first element inserted into an empty
+    ///          buffer, so the variance does not lose precision when the values are large compared to their spread and
+    ///          the statistics do not drift after billions of insertions. Sums start over from zero whenever the buffer
+    ///          becomes empty.
+    ///          An exponentially weighted moving average (EWMA) of all inserted values is kept as well. Unlike the other
+    ///          statistics it is not limited to the window, evicted elements still contribute to it.
+    ///          Elements can only be modified through StatsRingBuffer, the underlying RingBuffer is available read-only
+    /// @tparam T Arithmetic type of the elements
+    /// @tparam Allocator Allocator type of the underlying RingBuffer
+    /// @tparam CapacityPolicy Capacity policy of the underlying RingBuffer
+    template <typename T, typename Allocator = std::allocator<T>, typename CapacityPolicy = ExactCapacity>
+    class StatsRingBuffer {
+        public:
+            using ring_buffer_type = RingBuffer<T, Allocator, CapacityPolicy>;
+            using value_type = typename ring_buffer_type::value_type;
+            using const_reference = typename ring_buffer_type::const_reference;
+            using size_type = typename ring_buffer_type::size_type;
+            using allocator_type = typename ring_buffer_type::allocator_type;
+            using const_iterator = typename ring_buffer_type::const_iterator;
+
+            SIMPLE_RING_BUFFER_STATIC_ASSERT(std::is_arithmetic<T>::value, "StatsRingBuffer requires an arithmetic element type.");
+
+            /// @brief Weight of the newest value in the EWMA used if none is given
+            static constexpr double defaultEwmaAlpha = 0.1;
+
+            /// @param ewmaAlpha Weight of the newest value in the EWMA, must be in (0, 1].
+            ///        This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            StatsRingBuffer(const size_type initialCapacity = ring_buffer_type::defaultInitialCapacity, const double ewmaAlpha = defaultEwmaAlpha,
+                const allocator_type& alloc = allocator_type{});
+
+            size_type capacity() const noexcept;
+            size_type size() const noexcept;
+            bool empty() const noexcept;
+            bool full() const noexcept;
+            /// @brief Remove all elements and reset all statistics, including the EWMA
+            void clear() noexcept;
+
+            /// @brief Insert elem and update the statistics, evicting the oldest element if the buffer is full
+            void push_back(const value_type& elem);
+            template <typename ...Args>
+            void emplace_back(Args&&... args);
+            /// @brief Remove the oldest element. Buffer must not be empty.
+            ///        This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            void pop_front() noexcept;
+
+            /// @brief Sum of elements in the window
+            double sum() const noexcept;
+            /// @brief Mean of elements in the window. Buffer must not be empty.
+            ///        This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            double mean() const noexcept;
+            /// @brief Population variance of elements in the window. Buffer must not be empty.
+            ///        This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            double variance() const noexcept;
+            /// @brief Sample (Bessel corrected) variance of elements in the window. Buffer must hold at least 2 elements.
+            ///        This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            double sample_variance() const noexcept;
+            /// @brief Square root of variance()
+            double stddev() const noexcept;
+            /// @brief EWMA of all values inserted since construction or the last clear(). Equals the first inserted value
+            ///        after it is inserted. Buffer must not have been empty since the last clear().
+            ///        This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            double ewma() const noexcept;
+            double ewma_alpha() const noexcept;
+
+            /// @brief Recalculate sums from the elements currently in the buffer, O(n)
+            /// @details Not needed for precision under normal use, but it also rebases the sums on the current oldest
+            ///          element, which helps when the values have drifted far away from the first inserted one
+            void recalculate() noexcept;
+
+            /// @brief Read-only access to the underlying RingBuffer, for example to use segment algorithms on it
+            const ring_buffer_type& elements() const noexcept;
+
+            const_reference front() const noexcept;
+            const_reference back() const noexcept;
+            const_reference operator[](const size_type& pos) const noexcept;
+            const_reference at(const size_type& pos) const;
+
+            const_iterator begin() const noexcept;
+            const_iterator end() const noexcept;
+            const_iterator cbegin() const noexcept;
+            const_iterator cend() const noexcept;
+
+        private:
+            void on_inserted(const double value) noexcept;
+            void on_evicted(const double value) noexcept;
+
+        private:
+            ring_buffer_type mBuffer;
+            // all elements are summed as their difference from mShift, see class description
+            double mShift;
+            CompensatedSum mShiftedSum;
+            CompensatedSum mShiftedSumOfSquares;
+            double mEwmaAlpha;
+            double mEwma;
+            bool mHasEwma;
+    };
+} // namespace simpleContainers
+
+// ============================================================================================================================================
+// ============================================================== IMPLEMENTATION ==============================================================
+// ============================================================================================================================================
+
+namespace simpleContainers {
+    // ================================================================================
+    // CompensatedSum
+
+    inline void CompensatedSum::add(const double value) noexcept {
+        const double newSum = mSum + value;
+        // the smaller of the two operands is the one whose low order bits were lost
+        if (std::fabs(mSum) >= std::fabs(value)) {
+            mCompensation += (mSum - newSum) + value;
+        }
+        else {
+            mCompensation += (value - newSum) + mSum;
+        }
+        mSum = newSum;
+    }
+
+    inline void CompensatedSum::reset() noexcept {
+        mSum = 0.0;
+        mCompensation = 0.0;
+    }
+
+    inline double CompensatedSum::value() const noexcept {
+        return mSum + mCompensation;
+    }
+
+    // ================================================================================
+    // StatsRingBuffer
+
+    template <typename T, typename Allocator, typename CapacityPolicy>
+    constexpr double StatsRingBuffer<T, Allocator, CapacityPolicy>::defaultEwmaAlpha;
+
+    template <typename T, typename Allocator, typename CapacityPolicy>
+    inline StatsRingBuffer<T, Allocator, CapacityPolicy>::StatsRingBuffer(const size_type initialCapacity, const double ewmaAlpha, const allocator_type& alloc)
+        :   mBuffer(initialCapacity, alloc),
+            mShift{0.0},
+            mShiftedSum{},
+            mShiftedSumOfSquares{},
+            mEwmaAlpha{ewmaAlpha},
+            mEwma{0.0},
+            mHasEwma{false}
+    {
+        SIMPLE_RING_BUFFER_ASSERT(ewmaAlpha > 0.0 && ewmaAlpha <= 1.0, "StatsRingBuffer EWMA alpha must be in (0, 1]");
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy>
+    inline typename StatsRingBuffer<T, Allocator, CapacityPolicy>::size_type StatsRingBuffer<T, Allocator, CapacityPolicy>::capacity() const noexcept {
+        return mBuffer.capacity();
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy>
+    inline typename StatsRingBuffer<T, Allocator, CapacityPolicy>::size_type StatsRingBuffer<T, Allocator, CapacityPolicy>::size() const noexcept {
+        return mBuffer.size();
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy>
+    inline bool StatsRingBuffer<T, Allocator, CapacityPolicy>::empty() const noexcept {
+        return mBuffer.empty();
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy>
+    inline bool StatsRingBuffer<T, Allocator, CapacityPolicy>::full() const noexcept {
+        return mBuffer.full();
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy>
+    inline void StatsRingBuffer<T, Allocator, CapacityPolicy>::clear() noexcept {
+        mBuffer.clear();
+        mShift = 0.0;
+        mShiftedSum.reset();
+        mShiftedSumOfSquares.reset();
+        mEwma = 0.0;
+        mHasEwma = false;
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy>
+    inline void StatsRingBuffer<T, Allocator, CapacityPolicy>::push_back(const value_type& elem) {
+        emplace_back(elem);
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy>
+    template <typename ...Args>
+    inline void StatsRingBuffer<T, Allocator, CapacityPolicy>::emplace_back(Args&&... args) {
+        // the oldest element is read before it is overwritten, statistics are only updated after the insertion succeeded
+        const bool evicts = mBuffer.full();
+        const double evicted = evicts ? static_cast<double>(mBuffer.front()) : 0.0;
+        mBuffer.emplace_back(std::forward<Args>(args)...);
+
+        if (evicts) {
+            on_evicted(evicted);
+        }
+        on_inserted(static_cast<double>(mBuffer.back()));
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy>
+    inline void StatsRingBuffer<T, Allocator, CapacityPolicy>::pop_front() noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(!mBuffer.empty(), "StatsRingBuffer::pop_front called on an empty buffer");
+        const double evicted = static_cast<double>(mBuffer.front());
+        mBuffer.pop_front();
+        on_evicted(evicted);
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy>
+    inline double StatsRingBuffer<T, Allocator, CapacityPolicy>::sum() const noexcept {
+        return mShift * static_cast<double>(mBuffer.size()) + mShiftedSum.value();
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy>
+    inline double StatsRingBuffer<T, Allocator, CapacityPolicy>::mean() const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(!mBuffer.empty(), "StatsRingBuffer::mean called on an empty buffer");
+        return mShift + mShiftedSum.value() / static_cast<double>(mBuffer.size());
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy>
+    inline double StatsRingBuffer<T, Allocator, CapacityPolicy>::variance() const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(!mBuffer.empty(), "StatsRingBuffer::variance called on an empty buffer");
+        const double count = static_cast<double>(mBuffer.size());
+        const double shiftedSum = mShiftedSum.value();
+        // variance of the shifted values is the same as of the original ones, rounding can make it slightly negative
+        const double result = (mShiftedSumOfSquares.value() - shiftedSum * shiftedSum / count) / count;
+        return result > 0.0 ? result : 0.0;
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy>
+    inline double StatsRingBuffer<T, Allocator, CapacityPolicy>::sample_variance() const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(mBuffer.size() > 1, "StatsRingBuffer::sample_variance called on a buffer with less than 2 elements");
+        const double count = static_cast<double>(mBuffer.size());
+        return variance() * count / (count - 1.0);
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy>
+    inline double StatsRingBuffer<T, Allocator, CapacityPolicy>::stddev() const noexcept {
+        return std::sqrt(variance());
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy>
+    inline double StatsRingBuffer<T, Allocator, CapacityPolicy>::ewma() const noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(mHasEwma, "StatsRingBuffer::ewma called before any element was inserted");
+        return mEwma;
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy>
+    inline double StatsRingBuffer<T, Allocator, CapacityPolicy>::ewma_alpha() const noexcept {
+        return mEwmaAlpha;
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy>
+    inline void StatsRingBuffer<T, Allocator, CapacityPolicy>::recalculate() noexcept {
+        mShiftedSum.reset();
+        mShiftedSumOfSquares.reset();
+        mShift = mBuffer.empty() ? 0.0 : static_cast<double>(mBuffer.front());
+
+        for_each_segment(mBuffer, [this](const Segment<const T> segment) {
+            for (std::size_t i = 0; i < segment.size(); ++i) {
+                const double shifted = static_cast<double>(segment[i]) - mShift;
+                mShiftedSum.add(shifted);
+                mShiftedSumOfSquares.add(shifted * shifted);
+            }
+        });
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy>
+    inline const typename StatsRingBuffer<T, Allocator, CapacityPolicy>::ring_buffer_type& StatsRingBuffer<T, Allocator, CapacityPolicy>::elements() const noexcept {
+        return mBuffer;
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy>
+    inline typename StatsRingBuffer<T, Allocator, CapacityPolicy>::const_reference StatsRingBuffer<T, Allocator, CapacityPolicy>::front() const noexcept {
+        return mBuffer.front();
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy>
+    inline typename StatsRingBuffer<T, Allocator, CapacityPolicy>::const_reference StatsRingBuffer<T, Allocator, CapacityPolicy>::back() const noexcept {
+        return mBuffer.back();
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy>
+    inline typename StatsRingBuffer<T, Allocator, CapacityPolicy>::const_reference StatsRingBuffer<T, Allocator, CapacityPolicy>::operator[](const size_type& pos) const noexcept {
+        return mBuffer[pos];
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy>
+    inline typename StatsRingBuffer<T, Allocator, CapacityPolicy>::const_reference StatsRingBuffer<T, Allocator, CapacityPolicy>::at(const size_type& pos) const {
+        return mBuffer.at(pos);
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy>
+    inline typename StatsRingBuffer<T, Allocator, CapacityPolicy>::const_iterator StatsRingBuffer<T, Allocator, CapacityPolicy>::begin() const noexcept {
+        return mBuffer.begin();
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy>
+    inline typename StatsRingBuffer<T, Allocator, CapacityPolicy>::const_iterator StatsRingBuffer<T, Allocator, CapacityPolicy>::end() const noexcept {
+        return mBuffer.end();
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy>
+    inline typename StatsRingBuffer<T, Allocator, CapacityPolicy>::const_iterator StatsRingBuffer<T, Allocator, CapacityPolicy>::cbegin() const noexcept {
+        return mBuffer.cbegin();
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy>
+    inline typename StatsRingBuffer<T, Allocator, CapacityPolicy>::const_iterator StatsRingBuffer<T, Allocator, CapacityPolicy>::cend() const noexcept {
+        return mBuffer.cend();
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy>
+    inline void StatsRingBuffer<T, Allocator, CapacityPolicy>::on_inserted(const double value) noexcept {
+        if (mBuffer.size() == 1) {
+            // buffer was empty, start over with sums relative to the new element
+            mShift = value;
+            mShiftedSum.reset();
+            mShiftedSumOfSquares.reset();
+        }
+        else {
+            const double shifted = value - mShift;
+            mShiftedSum.add(shifted);
+            mShiftedSumOfSquares.add(shifted * shifted);
+        }
+
+        mEwma = mHasEwma ? mEwma + mEwmaAlpha * (value - mEwma) : value;
+        mHasEwma = true;
+    }
+
+    template <typename T, typename Allocator, typename CapacityPolicy>
+    inline void StatsRingBuffer<T, Allocator, CapacityPolicy>::on_evicted(const double value) noexcept {
+        if (mBuffer.empty()) {
+            mShiftedSum.reset();
+            mShiftedSumOfSquares.reset();
+            return;
+        }
+
+        const double shifted = value - mShift;
+        mShiftedSum.add(-shifted);
+        mShiftedSumOfSquares.add(-(shifted * shifted));
+    }
+} // namespace simpleContainers
+
+#endif // SIMPLE_STATS_RING_BUFFER_HPP
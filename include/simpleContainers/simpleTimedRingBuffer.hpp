@@ -0,0 +1,321 @@
+/// @file simpleTimedRingBuffer.hpp
+/// @brief File containing API and implementaiton of TimedRingBuffer class
+
+#ifndef SIMPLE_TIMED_RING_BUFFER_HPP
+#define SIMPLE_TIMED_RING_BUFFER_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "simpleRingBuffer.hpp"
+
+// ============================================================================================================================================
+// =================================================================== API ====================================================================
+// ============================================================================================================================================
+
+namespace simpleContainers {
+    /// @brief RingBuffer of elements with a timestamp each, meant for windows defined by time instead of by count
+    /// @details Values and timestamps are stored in two RingBuffers of the same capacity that are always modified together,
+    ///          so the timestamps are one contiguous array (split in two segments exactly where the values are) and
+    ///          searching them does not pull values through cache.
+    ///          Timestamps must not decrease from one insertion to the next, which makes them sorted in insertion order.
+    ///          Finding the elements older than some time point is then a binary search over at most two segments, and
+    ///          dropping them is O(1) for trivially destructible T (see RingBuffer::pop_front(size_type)), so
+    ///          expire_older_than() is O(log n) and never looks at the expired elements one by one.
+    ///          Capacity is still an upper bound on the number of elements: if more elements are inserted within the time
+    ///          window than fit, the oldest ones are overwritten like in RingBuffer
+    /// @tparam T Type of the elements
+    /// @tparam Clock Clock whose time points are used as timestamps, for example std::chrono::steady_clock
+    /// @tparam Allocator Allocator type of the underlying RingBuffer of values, timestamps use the same allocator rebound to time_point
+    /// @tparam CapacityPolicy Capacity policy of both underlying RingBuffers
+    template <typename T, typename Clock = std::chrono::steady_clock, typename Allocator = std::allocator<T>, typename CapacityPolicy = ExactCapacity>
+    class TimedRingBuffer {
+        public:
+            using clock_type = Clock;
+            using time_point = typename Clock::time_point;
+            using duration = typename Clock::duration;
+            using value_ring_buffer_type = RingBuffer<T, Allocator, CapacityPolicy>;
+            using timestamp_ring_buffer_type = RingBuffer<time_point, typename std::allocator_traits<Allocator>::template rebind_alloc<time_point>, CapacityPolicy>;
+            using value_type = typename value_ring_buffer_type::value_type;
+            using reference = typename value_ring_buffer_type::reference;
+            using const_reference = typename value_ring_buffer_type::const_reference;
+            using size_type = typename value_ring_buffer_type::size_type;
+            using allocator_type = typename value_ring_buffer_type::allocator_type;
+            using const_iterator = typename value_ring_buffer_type::const_iterator;
+
+            TimedRingBuffer(const size_type initialCapacity = value_ring_buffer_type::defaultInitialCapacity, const allocator_type& alloc = allocator_type{});
+
+            size_type capacity() const noexcept;
+            size_type size() const noexcept;
+            bool empty() const noexcept;
+            bool full() const noexcept;
+            void clear() noexcept;
+
+            /// @brief Insert elem with the given timestamp, overwriting the oldest element if the buffer is full
+            /// @details timestamp must not be earlier than newest_timestamp(). This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            void push_back(const value_type& elem, const time_point timestamp);
+            void push_back(value_type&& elem, const time_point timestamp);
+            /// @brief Same as above, with Clock::now() as the timestamp
+            void push_back(const value_type& elem);
+            void push_back(value_type&& elem);
+            /// @brief Construct an element from args in place, with the given timestamp
+            template <typename ...Args>
+            void emplace_back(const time_point timestamp, Args&&... args);
+            /// @brief Remove the oldest element. Buffer must not be empty.
+            ///        This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            void pop_front() noexcept;
+
+            /// @brief Remove all elements with a timestamp earlier than cutoff. O(log n) for trivially destructible T
+            /// @return Number of removed elements
+            size_type expire_older_than(const time_point cutoff) noexcept;
+            /// @brief Position (in insertion order) of the first element with a timestamp not earlier than t, size() if there is none. O(log n)
+            size_type lower_bound(const time_point t) const noexcept;
+            /// @brief Number of elements with a timestamp in [t0, t1). O(log n)
+            size_type count_in(const time_point t0, const time_point t1) const noexcept;
+            /// @brief Read-only views of the elements with a timestamp in [t0, t1), in insertion order. O(log n)
+            /// @details The second view is empty unless the range wraps around the end of the storage, see RingBuffer::segments()
+            std::pair<Segment<const value_type>, Segment<const value_type>> range(const time_point t0, const time_point t1) const noexcept;
+            /// @brief Read-only views of the timestamps in [t0, t1), they match the views returned by range() element for element
+            std::pair<Segment<const time_point>, Segment<const time_point>> timestamp_range(const time_point t0, const time_point t1) const noexcept;
+
+            /// @brief Timestamp of element at position pos in insertion order
+            /// @details This performs out of range checks for pos only when SIMPLE_RING_BUFFER_DEBUG is defined
+            time_point timestamp(const size_type pos) const noexcept;
+            /// @brief Timestamp of the oldest element. Buffer must not be empty.
+            ///        This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            time_point oldest_timestamp() const noexcept;
+            /// @brief Timestamp of the newest element. Buffer must not be empty.
+            ///        This is checked only when SIMPLE_RING_BUFFER_DEBUG is defined
+            time_point newest_timestamp() const noexcept;
+
+            /// @brief Read-only access to the underlying RingBuffer of values, for example to use segment algorithms on it
+            const value_ring_buffer_type& values() const noexcept;
+            /// @brief Read-only access to the underlying RingBuffer of timestamps
+            const timestamp_ring_buffer_type& timestamps() const noexcept;
+
+            reference front() noexcept;
+            const_reference front() const noexcept;
+            reference back() noexcept;
+            const_reference back() const noexcept;
+            /// @brief Indexing is done in insertion order, like for RingBuffer. Elements can be modified, timestamps can not
+            reference operator[](const size_type& pos) noexcept;
+            const_reference operator[](const size_type& pos) const noexcept;
+            reference at(const size_type& pos);
+            const_reference at(const size_type& pos) const;
+
+            const_iterator begin() const noexcept;
+            const_iterator end() const noexcept;
+            const_iterator cbegin() const noexcept;
+            const_iterator cend() const noexcept;
+
+        private:
+            value_ring_buffer_type mValues;
+            timestamp_ring_buffer_type mTimestamps;
+    };
+} // namespace simpleContainers
+
+// ============================================================================================================================================
+// ============================================================== IMPLEMENTATION ==============================================================
+// ============================================================================================================================================
+
+namespace simpleContainers {
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::TimedRingBuffer(const size_type initialCapacity, const allocator_type& alloc)
+        :   mValues(initialCapacity, alloc),
+            mTimestamps(initialCapacity, typename timestamp_ring_buffer_type::allocator_type(alloc))
+    {}
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline typename TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::size_type TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::capacity() const noexcept {
+        return mValues.capacity();
+    }
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline typename TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::size_type TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::size() const noexcept {
+        return mValues.size();
+    }
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline bool TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::empty() const noexcept {
+        return mValues.empty();
+    }
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline bool TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::full() const noexcept {
+        return mValues.full();
+    }
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline void TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::clear() noexcept {
+        mValues.clear();
+        mTimestamps.clear();
+    }
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline void TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::push_back(const value_type& elem, const time_point timestamp) {
+        emplace_back(timestamp, elem);
+    }
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline void TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::push_back(value_type&& elem, const time_point timestamp) {
+        emplace_back(timestamp, std::move(elem));
+    }
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline void TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::push_back(const value_type& elem) {
+        emplace_back(Clock::now(), elem);
+    }
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline void TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::push_back(value_type&& elem) {
+        emplace_back(Clock::now(), std::move(elem));
+    }
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    template <typename ...Args>
+    inline void TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::emplace_back(const time_point timestamp, Args&&... args) {
+        SIMPLE_RING_BUFFER_ASSERT(mTimestamps.empty() || !(timestamp < mTimestamps.back()), "TimedRingBuffer timestamps must not decrease");
+        // the value is inserted first, if its constructor throws neither buffer is changed
+        mValues.emplace_back(std::forward<Args>(args)...);
+        // both buffers have the same capacity and size, so this overwrites exactly when the value insertion did
+        mTimestamps.push_back(timestamp);
+    }
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline void TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::pop_front() noexcept {
+        SIMPLE_RING_BUFFER_ASSERT(!mValues.empty(), "TimedRingBuffer::pop_front called on an empty buffer");
+        mValues.pop_front();
+        mTimestamps.pop_front();
+    }
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline typename TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::size_type TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::expire_older_than(const time_point cutoff) noexcept {
+        const size_type expiredCount = lower_bound(cutoff);
+        mValues.pop_front(expiredCount);
+        mTimestamps.pop_front(expiredCount);
+        return expiredCount;
+    }
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline typename TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::size_type TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::lower_bound(const time_point t) const noexcept {
+        const Segment<const time_point> first = mTimestamps.array_one();
+        const Segment<const time_point> second = mTimestamps.array_two();
+
+        // every timestamp in the first segment is earlier than every timestamp in the second one, so only one is searched
+        if (second.empty() || !(first[first.size() - 1] < t)) {
+            return static_cast<size_type>(std::lower_bound(first.begin(), first.end(), t) - first.begin());
+        }
+        return first.size() + static_cast<size_type>(std::lower_bound(second.begin(), second.end(), t) - second.begin());
+    }
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline typename TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::size_type TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::count_in(const time_point t0, const time_point t1) const noexcept {
+        const size_type firstPos = lower_bound(t0);
+        const size_type lastPos = lower_bound(t1);
+        return lastPos > firstPos ? lastPos - firstPos : 0;
+    }
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline std::pair<Segment<const typename TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::value_type>, Segment<const typename TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::value_type>>
+    TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::range(const time_point t0, const time_point t1) const noexcept {
+        const size_type firstPos = lower_bound(t0);
+        return mValues.segments(firstPos, count_in(t0, t1));
+    }
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline std::pair<Segment<const typename TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::time_point>, Segment<const typename TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::time_point>>
+    TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::timestamp_range(const time_point t0, const time_point t1) const noexcept {
+        const size_type firstPos = lower_bound(t0);
+        return mTimestamps.segments(firstPos, count_in(t0, t1));
+    }
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline typename TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::time_point TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::timestamp(const size_type pos) const noexcept {
+        return mTimestamps[pos];
+    }
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline typename TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::time_point TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::oldest_timestamp() const noexcept {
+        return mTimestamps.front();
+    }
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline typename TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::time_point TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::newest_timestamp() const noexcept {
+        return mTimestamps.back();
+    }
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline const typename TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::value_ring_buffer_type& TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::values() const noexcept {
+        return mValues;
+    }
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline const typename TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::timestamp_ring_buffer_type& TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::timestamps() const noexcept {
+        return mTimestamps;
+    }
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline typename TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::reference TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::front() noexcept {
+        return mValues.front();
+    }
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline typename TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::const_reference TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::front() const noexcept {
+        return mValues.front();
+    }
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline typename TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::reference TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::back() noexcept {
+        return mValues.back();
+    }
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline typename TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::const_reference TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::back() const noexcept {
+        return mValues.back();
+    }
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline typename TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::reference TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::operator[](const size_type& pos) noexcept {
+        return mValues[pos];
+    }
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline typename TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::const_reference TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::operator[](const size_type& pos) const noexcept {
+        return mValues[pos];
+    }
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline typename TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::reference TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::at(const size_type& pos) {
+        return mValues.at(pos);
+    }
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline typename TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::const_reference TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::at(const size_type& pos) const {
+        return mValues.at(pos);
+    }
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline typename TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::const_iterator TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::begin() const noexcept {
+        return mValues.begin();
+    }
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline typename TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::const_iterator TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::end() const noexcept {
+        return mValues.end();
+    }
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline typename TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::const_iterator TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::cbegin() const noexcept {
+        return mValues.cbegin();
+    }
+
+    template <typename T, typename Clock, typename Allocator, typename CapacityPolicy>
+    inline typename TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::const_iterator TimedRingBuffer<T, Clock, Allocator, CapacityPolicy>::cend() const noexcept {
+        return mValues.cend();
+    }
+} // namespace simpleContainers
+
+#endif // SIMPLE_TIMED_RING_BUFFER_HPP
@@ -0,0 +1,265 @@
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+
+#include "simpleContainers/simpleRingBuffer.hpp"
+#include "simpleContainers/simpleBipRingBuffer.hpp"
+
+void test_bip_ring_buffer_construction();
+void test_bip_ring_buffer_reserve_commit();
+void test_bip_ring_buffer_wrapping();
+void test_bip_ring_buffer_randomized();
+
+int main() {
+    test_bip_ring_buffer_construction();
+    test_bip_ring_buffer_reserve_commit();
+    test_bip_ring_buffer_wrapping();
+    test_bip_ring_buffer_randomized();
+    return 0;
+}
+
+namespace {
+    std::string to_string(const simpleContainers::Segment<const unsigned char> payload) {
+        return std::string(payload.begin(), payload.end());
+    }
+
+    bool push_string(simpleContainers::BipRingBuffer& rb, const std::string& message) {
+        return rb.try_push_back(message.data(), message.size());
+    }
+
+    std::string pop_string(simpleContainers::BipRingBuffer& rb) {
+        const std::string result = to_string(rb.peek());
+        rb.release();
+        return result;
+    }
+} // namespace
+
+void test_bip_ring_buffer_construction() {
+    std::cout << "================= TESTING BIP RING BUFFER CONSTRUCTION =================" << std::endl;
+
+    simpleContainers::BipRingBuffer rb1;
+    assert(rb1.capacity() == simpleContainers::BipRingBuffer::defaultInitialCapacity);
+    assert(rb1.empty() && rb1.size() == 0 && rb1.used_bytes() == 0);
+    assert(rb1.max_reservable() == rb1.capacity() - sizeof(simpleContainers::BipRingBuffer::header_type));
+
+    // capacity is rounded up to whole alignment units
+    simpleContainers::BipRingBuffer rb2(30);
+    assert(rb2.capacity() == 32);
+
+    const bool pushedHello = push_string(rb2, "hello");
+    const bool pushedEmpty = push_string(rb2, "");
+    const bool pushedWorld = push_string(rb2, "world");
+    assert(pushedHello && pushedEmpty && pushedWorld);
+    assert(rb2.size() == 3 && rb2.used_bytes() == 12 + 4 + 12);
+
+    // copies are independent
+    simpleContainers::BipRingBuffer rb2Cpy(rb2);
+    const std::string popped = pop_string(rb2);
+    assert(popped == "hello");
+    assert(rb2Cpy.size() == 3 && to_string(rb2Cpy.peek()) == "hello");
+
+    simpleContainers::BipRingBuffer rb3(8);
+    rb3 = rb2Cpy;
+    assert(rb3.capacity() == 32 && rb3.size() == 3);
+
+    simpleContainers::BipRingBuffer rb4(std::move(rb3));
+    assert(rb4.size() == 3 && rb3.empty() && rb3.capacity() == 0);
+    const bool pushedToMovedFrom = push_string(rb3, "x");
+    assert(!pushedToMovedFrom);
+    rb3 = std::move(rb4);
+    assert(rb3.size() == 3);
+    const std::string first = pop_string(rb3);
+    const std::string second = pop_string(rb3);
+    const std::string third = pop_string(rb3);
+    assert(first == "hello" && second == "" && third == "world");
+    assert(rb3.empty() && rb3.used_bytes() == 0);
+
+    rb3.swap(rb2);
+    assert(rb3.size() == 2 && rb2.empty());
+    swap(rb3, rb2);
+    assert(rb2.size() == 2 && rb3.empty());
+
+    rb2.clear();
+    assert(rb2.empty() && rb2.used_bytes() == 0 && rb2.max_reservable() == 28);
+}
+
+void test_bip_ring_buffer_reserve_commit() {
+    std::cout << "================= TESTING BIP RING BUFFER RESERVE AND COMMIT =================" << std::endl;
+
+    simpleContainers::BipRingBuffer rb1(64);
+
+    // reserve more than needed and commit only what was written
+    simpleContainers::Segment<unsigned char> space = rb1.reserve(40);
+    assert(space.data() != nullptr && space.size() == 40);
+    assert(reinterpret_cast<std::uintptr_t>(space.data()) % simpleContainers::BipRingBuffer::recordAlignment == 0);
+    std::memcpy(space.data(), "abc", 3);
+    rb1.commit(3);
+    assert(rb1.size() == 1 && rb1.used_bytes() == 8 && to_string(rb1.peek()) == "abc");
+
+    // a cancelled reservation leaves nothing behind
+    space = rb1.reserve(10);
+    assert(space.data() != nullptr);
+    space[0] = 'z';
+    rb1.cancel();
+    assert(rb1.size() == 1 && rb1.used_bytes() == 8);
+
+    // too large for the contiguous room
+    space = rb1.reserve(60);
+    assert(space.data() == nullptr);
+    assert(rb1.max_reservable() == 52);
+    space = rb1.reserve(52);
+    assert(space.data() != nullptr);
+    rb1.commit(52);
+    assert(rb1.max_reservable() == 0);
+    space = rb1.reserve(0);
+    assert(space.data() == nullptr);
+
+    // records can be released while a reservation is active, the payload being read does not move
+    const simpleContainers::Segment<const unsigned char> oldest = rb1.peek();
+    rb1.release();
+    assert(to_string(oldest) == "abc");
+    space = rb1.reserve(4);
+    assert(space.data() != nullptr && space.data() == oldest.data());
+    rb1.release();
+    assert(rb1.empty());
+    std::memcpy(space.data(), "wxyz", 4);
+    rb1.commit(4);
+    assert(rb1.size() == 1 && to_string(rb1.peek()) == "wxyz");
+
+    // payloads hold arbitrary bytes
+    simpleContainers::BipRingBuffer rb2(32);
+    const std::uint64_t values[2] = {0x0123456789abcdefULL, 0};
+    const bool pushedValues = rb2.try_push_back(values, sizeof(values));
+    assert(pushedValues);
+    std::uint64_t readBack[2] = {1, 1};
+    assert(rb2.peek().size() == sizeof(readBack));
+    std::memcpy(readBack, rb2.peek().data(), sizeof(readBack));
+    assert(readBack[0] == values[0] && readBack[1] == values[1]);
+}
+
+void test_bip_ring_buffer_wrapping() {
+    std::cout << "================= TESTING BIP RING BUFFER WRAPPING =================" << std::endl;
+
+    // records of up to 4 bytes take 8 bytes with their length prefix, records of 5 to 8 bytes take 12
+    simpleContainers::BipRingBuffer rb1(40);
+    bool pushed = push_string(rb1, "one!");
+    pushed = push_string(rb1, "two!") && pushed;
+    pushed = push_string(rb1, "three") && pushed;
+    pushed = push_string(rb1, "four") && pushed;
+    assert(pushed && rb1.used_bytes() == 36);
+    pushed = push_string(rb1, "five");
+    assert(!pushed);
+
+    // room at the start of the storage is used once there is none at the end
+    std::string popped = pop_string(rb1);
+    assert(popped == "one!");
+    assert(rb1.max_reservable() == 4);
+    pushed = push_string(rb1, "fi");
+    assert(pushed && rb1.size() == 4);
+    assert(rb1.max_reservable() == 0);
+
+    // region B only grows up to region A, leaving 8 bytes. The 4 free bytes at the end stay unused
+    popped = pop_string(rb1);
+    assert(popped == "two!");
+    pushed = push_string(rb1, "sixsixsi");
+    assert(!pushed);
+    pushed = push_string(rb1, "six");
+    assert(pushed && rb1.size() == 4);
+
+    // region B becomes region A once the old records are released
+    popped = pop_string(rb1);
+    assert(popped == "three");
+    popped = pop_string(rb1);
+    assert(popped == "four");
+    assert(rb1.size() == 2 && rb1.used_bytes() == 16);
+    pushed = push_string(rb1, "seven");
+    pushed = push_string(rb1, "eight") && pushed;
+    assert(pushed);
+    for (const char* expected : {"fi", "six", "seven", "eight"}) {
+        popped = pop_string(rb1);
+        assert(popped == expected);
+    }
+    assert(rb1.empty() && rb1.max_reservable() == 36);
+
+    // a reservation for region B becomes part of region A if region A is released before commit
+    pushed = push_string(rb1, "aaaaaaaaaaaaaaaaaaaa");
+    pushed = push_string(rb1, "bbbbbbbbbbbb") && pushed;
+    assert(pushed);
+    simpleContainers::Segment<unsigned char> space = rb1.reserve(8);
+    assert(space.data() == nullptr);
+    popped = pop_string(rb1);
+    assert(popped == "aaaaaaaaaaaaaaaaaaaa");
+    space = rb1.reserve(8);
+    assert(space.data() != nullptr);
+    popped = pop_string(rb1);
+    assert(popped == "bbbbbbbbbbbb" && rb1.empty());
+    std::memcpy(space.data(), "cccccccc", 8);
+    rb1.commit(8);
+    pushed = push_string(rb1, "dd");
+    assert(pushed);
+    popped = pop_string(rb1);
+    assert(popped == "cccccccc");
+    popped = pop_string(rb1);
+    assert(popped == "dd" && rb1.empty());
+}
+
+void test_bip_ring_buffer_randomized() {
+    std::cout << "================= TESTING BIP RING BUFFER AGAINST RING BUFFER OF STRINGS =================" << std::endl;
+
+    std::mt19937_64 rng(2025);
+    std::uniform_int_distribution<int> actionDist(0, 9);
+    std::uniform_int_distribution<std::size_t> lengthDist(0, 100);
+    std::uniform_int_distribution<int> byteDist(0, 255);
+
+    simpleContainers::BipRingBuffer rb1(1000);
+    // large enough that it never overwrites, since BipRingBuffer holds at most capacity / 4 records
+    simpleContainers::RingBuffer<std::string> expected(1000);
+    std::size_t expectedBytes = 0;
+
+    for (std::size_t i = 0; i < 50000; ++i) {
+        const int action = actionDist(rng);
+        if (action < 4 && !expected.empty()) {
+            assert(to_string(rb1.peek()) == expected.front());
+            expectedBytes -= (4 + expected.front().size() + 3) / 4 * 4;
+            rb1.release();
+            expected.pop_front();
+        }
+        else {
+            std::string message(lengthDist(rng), '\0');
+            for (char& c : message) {
+                c = static_cast<char>(byteDist(rng));
+            }
+
+            const std::size_t room = rb1.max_reservable();
+            simpleContainers::Segment<unsigned char> space = rb1.reserve(message.size() + 16);
+            assert((space.data() != nullptr) == (message.size() + 16 <= room));
+            if (space.data() != nullptr) {
+                std::memcpy(space.data(), message.data(), message.size());
+                if (action == 9) {
+                    rb1.cancel();
+                }
+                else {
+                    rb1.commit(message.size());
+                    expected.push_back(message);
+                    expectedBytes += (4 + message.size() + 3) / 4 * 4;
+                }
+            }
+        }
+
+        assert(rb1.size() == expected.size() && rb1.used_bytes() == expectedBytes);
+        assert(rb1.used_bytes() <= rb1.capacity());
+    }
+
+    while (!expected.empty()) {
+        const std::string popped = pop_string(rb1);
+        assert(popped == expected.front());
+        expected.pop_front();
+    }
+    assert(rb1.empty() && rb1.used_bytes() == 0);
+}
@@ -0,0 +1,294 @@
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "simpleContainers/simpleRingBuffer.hpp"
+#include "simpleContainers/simpleCompressedRingBuffer.hpp"
+
+void test_compressed_ring_buffer_bit_stream();
+void test_compressed_ring_buffer_integers();
+void test_compressed_ring_buffer_doubles();
+void test_compressed_ring_buffer_block_eviction();
+void test_compressed_ring_buffer_randomized();
+
+int main() {
+    test_compressed_ring_buffer_bit_stream();
+    test_compressed_ring_buffer_integers();
+    test_compressed_ring_buffer_doubles();
+    test_compressed_ring_buffer_block_eviction();
+    test_compressed_ring_buffer_randomized();
+    return 0;
+}
+
+namespace {
+    std::uint64_t bits_of(const double value) {
+        std::uint64_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    // doubles are compared by their bits, so NaN payloads and the sign of zero must survive the round trip as well
+    bool same_bits(const std::vector<double>& lhs, const std::vector<double>& rhs) {
+        if (lhs.size() != rhs.size()) {
+            return false;
+        }
+        for (std::size_t i = 0; i < lhs.size(); ++i) {
+            if (bits_of(lhs[i]) != bits_of(rhs[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // push all values into a buffer large enough to hold them and check that they decode unchanged
+    template <typename T, std::size_t SamplesPerBlock>
+    void check_round_trip(const std::vector<T>& values) {
+        simpleContainers::CompressedRingBuffer<T, SamplesPerBlock> rb(values.size() + 1);
+        for (const T value : values) {
+            rb.push_back(value);
+        }
+        assert(rb.size() == values.size());
+        assert(rb.get_elements() == values);
+        if (!values.empty()) {
+            assert(rb.front() == values.front() && rb.back() == values.back());
+        }
+    }
+} // namespace
+
+void test_compressed_ring_buffer_bit_stream() {
+    std::cout << "================= TESTING COMPRESSED RING BUFFER BIT STREAM =================" << std::endl;
+
+    std::vector<std::uint64_t> words;
+    std::size_t bitCount = 0;
+    simpleContainers::detail::append_bits(words, bitCount, 0x5, 3);
+    simpleContainers::detail::append_bits(words, bitCount, 0xffffffffffffffffULL, 64);   // crosses a word boundary
+    simpleContainers::detail::append_bits(words, bitCount, 0x0, 1);
+    simpleContainers::detail::append_bits(words, bitCount, 0x1234, 60);
+    assert(bitCount == 128 && words.size() == 2);
+    simpleContainers::detail::append_bits(words, bitCount, 0x1, 1);
+    assert(bitCount == 129 && words.size() == 3);
+
+    std::size_t bitPosition = 0;
+    assert(simpleContainers::detail::read_bits(words.data(), bitPosition, 3) == 0x5);
+    assert(simpleContainers::detail::read_bits(words.data(), bitPosition, 64) == 0xffffffffffffffffULL);
+    assert(simpleContainers::detail::read_bits(words.data(), bitPosition, 1) == 0x0);
+    assert(simpleContainers::detail::read_bits(words.data(), bitPosition, 60) == 0x1234);
+    assert(simpleContainers::detail::read_bits(words.data(), bitPosition, 1) == 0x1);
+    assert(bitPosition == bitCount);
+
+    for (const std::int64_t value : {std::int64_t{0}, std::int64_t{1}, std::int64_t{-1}, std::int64_t{63}, std::int64_t{-64},
+                                     std::numeric_limits<std::int64_t>::max(), std::numeric_limits<std::int64_t>::min()}) {
+        const std::uint64_t bits = static_cast<std::uint64_t>(value);
+        assert(simpleContainers::detail::zigzag_decode(simpleContainers::detail::zigzag_encode(bits)) == bits);
+    }
+    // small magnitudes of either sign map to small codes
+    assert(simpleContainers::detail::zigzag_encode(static_cast<std::uint64_t>(std::int64_t{-1})) == 1);
+    assert(simpleContainers::detail::zigzag_encode(1) == 2);
+
+    assert(simpleContainers::detail::lowest_bit_index(1) == 0 && simpleContainers::detail::lowest_bit_index(0x80) == 7);
+    assert(simpleContainers::detail::lowest_bit_index(0x8000000000000000ULL) == 63);
+}
+
+void test_compressed_ring_buffer_integers() {
+    std::cout << "================= TESTING COMPRESSED RING BUFFER INTEGERS =================" << std::endl;
+
+    static_assert((std::is_same<std::iterator_traits<simpleContainers::CompressedRingBuffer<int>::const_iterator>::iterator_category, std::forward_iterator_tag>::value), "");
+    static_assert((std::is_same<simpleContainers::CompressedRingBuffer<int>::codec_type, simpleContainers::detail::DeltaOfDeltaCodec>::value), "");
+
+    simpleContainers::CompressedRingBuffer<std::int64_t> rb1;
+    assert(rb1.capacity() == (simpleContainers::CompressedRingBuffer<std::int64_t>::defaultInitialCapacity));
+    assert(rb1.empty() && rb1.block_count() == 0 && rb1.encoded_bytes() == 0 && rb1.begin() == rb1.end());
+
+    // timestamps of a periodic scrape: after the first two samples every delta-of-delta is 0, one bit per sample
+    const std::int64_t start = 1700000000000;
+    for (std::int64_t i = 0; i < 1000; ++i) {
+        rb1.push_back(start + i * 15000);
+    }
+    assert(rb1.size() == 1000 && rb1.block_count() == 1);
+    assert(rb1.front() == start && rb1.back() == start + 999 * 15000);
+    assert(rb1.encoded_bytes() < 8 + 8 + 1000 / 8);
+
+    std::int64_t expected = start;
+    for (const std::int64_t value : rb1) {
+        assert(value == expected);
+        expected += 15000;
+    }
+
+    // every bucket of the encoding, including both extremes of the type
+    check_round_trip<std::int64_t, 16>({0, 1, 3, 6, 10, 10, 10, -50, 70, -3000, 5000, -400000, 600000,
+                                        std::numeric_limits<std::int64_t>::max(), std::numeric_limits<std::int64_t>::min(),
+                                        std::numeric_limits<std::int64_t>::max(), 0, -1, -1, -1});
+    check_round_trip<std::uint64_t, 4>({0, std::numeric_limits<std::uint64_t>::max(), 1, std::numeric_limits<std::uint64_t>::max() - 1, 7});
+    check_round_trip<int, 3>({-5, -4, -3, -2, -1, 0, 1, 2, std::numeric_limits<int>::min(), std::numeric_limits<int>::max()});
+    check_round_trip<unsigned char, 2>({0, 255, 128, 1, 254});
+    check_round_trip<short, 1024>({});
+
+    // iterator
+    simpleContainers::CompressedRingBuffer<int, 2> rb2(6);
+    for (int i = 1; i <= 5; ++i) {
+        rb2.push_back(i * i);
+    }
+    auto it = rb2.begin();
+    assert(*it == 1);
+    assert(*(it++) == 1 && *it == 4);
+    ++it;
+    assert(*it == 9 && it != rb2.end());
+    assert(std::distance(rb2.begin(), rb2.end()) == 5);
+
+    // the iterator reads blocks in order across block boundaries
+    std::vector<int> seen(rb2.cbegin(), rb2.cend());
+    assert((seen == std::vector<int>{1, 4, 9, 16, 25}));
+    assert(rb2.block_count() == 3);
+
+    rb2.clear();
+    assert(rb2.empty() && rb2.block_count() == 0 && rb2.begin() == rb2.end() && rb2.capacity() == 6);
+    rb2.push_back(-7);
+    assert(rb2.size() == 1 && rb2.front() == -7 && rb2.back() == -7);
+}
+
+void test_compressed_ring_buffer_doubles() {
+    std::cout << "================= TESTING COMPRESSED RING BUFFER DOUBLES =================" << std::endl;
+
+    static_assert((std::is_same<simpleContainers::CompressedRingBuffer<double>::codec_type, simpleContainers::detail::XorCodec>::value), "");
+
+    // a constant metric takes one bit per sample after the first one
+    simpleContainers::CompressedRingBuffer<double> rb1(1000);
+    for (int i = 0; i < 1000; ++i) {
+        rb1.push_back(42.5);
+    }
+    assert(rb1.encoded_bytes() <= 8 + 1000 / 8);
+    for (const double value : rb1) {
+        assert(bits_of(value) == bits_of(42.5));
+    }
+
+    // a slowly changing metric compresses well below 8 bytes per sample
+    simpleContainers::CompressedRingBuffer<double> rb2(1000);
+    std::vector<double> expected;
+    for (int i = 0; i < 1000; ++i) {
+        const double value = 100.0 + static_cast<double>(i % 20) * 0.25;
+        rb2.push_back(value);
+        expected.push_back(value);
+    }
+    assert(same_bits(rb2.get_elements(), expected));
+    assert(rb2.encoded_bytes() < 1000 * sizeof(double) / 2);
+    assert(bits_of(rb2.front()) == bits_of(100.0) && bits_of(rb2.back()) == bits_of(expected.back()));
+
+    // special values: signed zeros, infinities, NaN, denormals and extremes
+    const std::vector<double> special = {0.0, -0.0, 1.0, -1.0, std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
+                                         std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::denorm_min(),
+                                         std::numeric_limits<double>::max(), std::numeric_limits<double>::lowest(),
+                                         std::numeric_limits<double>::min(), 0.1, 0.2, 0.30000000000000004, 1e300, 1e-300, 3.0, 3.0};
+    for (const std::size_t blockSize : {std::size_t{1}, std::size_t{5}}) {
+        std::vector<double> decoded;
+        if (blockSize == 1) {
+            simpleContainers::CompressedRingBuffer<double, 1> rb(special.size());
+            for (const double value : special) { rb.push_back(value); }
+            decoded = rb.get_elements();
+        }
+        else {
+            simpleContainers::CompressedRingBuffer<double, 5> rb(special.size());
+            for (const double value : special) { rb.push_back(value); }
+            decoded = rb.get_elements();
+        }
+        assert(same_bits(decoded, special));
+    }
+    assert(std::isnan(special[6]));
+}
+
+void test_compressed_ring_buffer_block_eviction() {
+    std::cout << "================= TESTING COMPRESSED RING BUFFER BLOCK EVICTION =================" << std::endl;
+
+    // capacity is rounded up to whole blocks
+    simpleContainers::CompressedRingBuffer<int, 4> rb1(7);
+    assert(rb1.capacity() == 8);
+
+    for (int i = 0; i < 8; ++i) {
+        rb1.push_back(i);
+    }
+    assert(rb1.size() == 8 && rb1.block_count() == 2);
+
+    // the 9th sample evicts the whole oldest block
+    rb1.push_back(8);
+    assert(rb1.size() == 5 && rb1.block_count() == 2);
+    assert(rb1.front() == 4 && rb1.back() == 8);
+    assert((rb1.get_elements() == std::vector<int>{4, 5, 6, 7, 8}));
+
+    for (int i = 9; i < 12; ++i) {
+        rb1.push_back(i);
+    }
+    assert(rb1.size() == 8 && (rb1.get_elements() == std::vector<int>{4, 5, 6, 7, 8, 9, 10, 11}));
+
+    std::size_t droppedCount = rb1.pop_front_block();
+    assert(droppedCount == 4);
+    assert(rb1.size() == 4 && rb1.front() == 8);
+    droppedCount = rb1.pop_front_block();
+    assert(droppedCount == 4);
+    assert(rb1.empty() && rb1.block_count() == 0);
+
+    // copies are independent
+    rb1.push_back(100);
+    rb1.push_back(200);
+    simpleContainers::CompressedRingBuffer<int, 4> rb1Cpy(rb1);
+    rb1.push_back(300);
+    assert(rb1Cpy.size() == 2 && rb1Cpy.back() == 200 && rb1.back() == 300);
+
+    simpleContainers::CompressedRingBuffer<int, 4> rb2(1);
+    assert(rb2.capacity() == 4);
+    rb2 = rb1Cpy;
+    assert((rb2.get_elements() == std::vector<int>{100, 200}));
+}
+
+void test_compressed_ring_buffer_randomized() {
+    std::cout << "================= TESTING COMPRESSED RING BUFFER AGAINST RING BUFFER =================" << std::endl;
+
+    std::mt19937_64 rng(2024);
+    std::uniform_int_distribution<int> jitterDist(-3, 3);
+    std::uniform_int_distribution<int> jumpDist(0, 99);
+    std::uniform_int_distribution<std::int64_t> anyDist(std::numeric_limits<std::int64_t>::min(), std::numeric_limits<std::int64_t>::max());
+    std::normal_distribution<double> noiseDist(0.0, 0.5);
+
+    // samples evicted by CompressedRingBuffer are whole blocks, so the last size() samples must match the reference
+    simpleContainers::CompressedRingBuffer<std::int64_t, 32> integers(100);
+    simpleContainers::CompressedRingBuffer<double, 32> doubles(100);
+    simpleContainers::RingBuffer<std::int64_t> expectedIntegers(integers.capacity());
+    simpleContainers::RingBuffer<double> expectedDoubles(doubles.capacity());
+
+    std::int64_t timestamp = 0;
+    double level = 20.0;
+    for (int i = 0; i < 5000; ++i) {
+        const int jump = jumpDist(rng);
+        timestamp += 1000 + jitterDist(rng) + (jump == 0 ? 100000 : 0);
+        const std::int64_t integer = jump == 1 ? anyDist(rng) : timestamp;
+        level += noiseDist(rng);
+        const double value = jump == 2 ? static_cast<double>(anyDist(rng)) : std::round(level * 100.0) / 100.0;
+
+        integers.push_back(integer);
+        doubles.push_back(value);
+        expectedIntegers.push_back(integer);
+        expectedDoubles.push_back(value);
+
+        // once filled, at most one block less than capacity is kept
+        assert(integers.size() <= integers.capacity());
+        assert(i < 128 || integers.size() > integers.capacity() - 32);
+        if (i % 97 == 0) {
+            const std::vector<std::int64_t> decodedIntegers = integers.get_elements();
+            const std::vector<double> decodedDoubles = doubles.get_elements();
+            const std::vector<std::int64_t> allIntegers = expectedIntegers.get_elements();
+            const std::vector<double> allDoubles = expectedDoubles.get_elements();
+            assert(std::equal(decodedIntegers.begin(), decodedIntegers.end(), allIntegers.end() - static_cast<std::ptrdiff_t>(decodedIntegers.size())));
+            assert(same_bits(decodedDoubles, std::vector<double>(allDoubles.end() - static_cast<std::ptrdiff_t>(decodedDoubles.size()), allDoubles.end())));
+            assert(integers.back() == integer && bits_of(doubles.back()) == bits_of(value));
+        }
+    }
+
+    assert(integers.encoded_bytes() < integers.size() * sizeof(std::int64_t) / 2);
+}
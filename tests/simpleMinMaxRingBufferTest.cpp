@@ -0,0 +1,181 @@
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "simpleContainers/simpleMinMaxRingBuffer.hpp"
+
+void test_min_max_ring_buffer_construction();
+void test_min_max_ring_buffer_extrema();
+void test_min_max_ring_buffer_randomized();
+
+int main() {
+    test_min_max_ring_buffer_construction();
+    test_min_max_ring_buffer_extrema();
+    test_min_max_ring_buffer_randomized();
+    return 0;
+}
+
+namespace {
+    // compare tracked extrema against a full scan of the window
+    template <typename MinMaxBuffer>
+    void check_against_brute_force(const MinMaxBuffer& rb) {
+        const auto comp = rb.value_comp();
+        const auto expectedMin = std::min_element(rb.begin(), rb.end(), comp);
+        const auto expectedMax = std::max_element(rb.begin(), rb.end(), comp);
+
+        assert(!comp(rb.window_min(), *expectedMin) && !comp(*expectedMin, rb.window_min()));
+        assert(!comp(rb.window_max(), *expectedMax) && !comp(*expectedMax, rb.window_max()));
+        assert(&rb[rb.window_min_index()] == &rb.window_min());
+        assert(&rb[rb.window_max_index()] == &rb.window_max());
+    }
+} // namespace
+
+void test_min_max_ring_buffer_construction() {
+    std::cout << "================= TESTING MIN MAX RING BUFFER CONSTRUCTION =================" << std::endl;
+
+    simpleContainers::MinMaxRingBuffer<int> rb1;
+    assert(rb1.capacity() == simpleContainers::RingBuffer<int>::defaultInitialCapacity);
+    assert(rb1.empty() && rb1.size() == 0 && !rb1.full() && rb1.begin() == rb1.end());
+
+    simpleContainers::MinMaxRingBuffer<int, std::less<int>, std::allocator<int>, simpleContainers::PowerOfTwoCapacity> rb2(5);
+    assert(rb2.capacity() == 8);
+    for (int i = 0; i < 12; ++i) { rb2.push_back(i); }
+    assert(rb2.full() && rb2.front() == 4 && rb2.back() == 11 && rb2[2] == 6 && rb2.at(7) == 11);
+    assert(rb2.elements().size() == 8 && std::equal(rb2.cbegin(), rb2.cend(), rb2.elements().begin()));
+
+    bool thrown = false;
+    try {
+        rb2.at(8);
+    }
+    catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // copies track extrema independently
+    simpleContainers::MinMaxRingBuffer<int, std::less<int>, std::allocator<int>, simpleContainers::PowerOfTwoCapacity> rb2Cpy{rb2};
+    rb2Cpy.push_back(-5);
+    assert(rb2Cpy.window_min() == -5 && rb2.window_min() == 4);
+
+    rb2.clear();
+    assert(rb2.empty());
+    rb2.push_back(100);
+    assert(rb2.window_min() == 100 && rb2.window_max() == 100 && rb2.window_min_index() == 0);
+}
+
+void test_min_max_ring_buffer_extrema() {
+    std::cout << "================= TESTING MIN MAX RING BUFFER EXTREMA =================" << std::endl;
+
+    simpleContainers::MinMaxRingBuffer<int> rb1(3);
+    rb1.push_back(5);
+    assert(rb1.window_min() == 5 && rb1.window_max() == 5);
+    rb1.push_back(1);
+    rb1.emplace_back(3);
+    // {5, 1, 3}
+    assert(rb1.window_min() == 1 && rb1.window_max() == 5);
+    rb1.push_back(4);
+    // {1, 3, 4}, previous maximum was evicted
+    assert(rb1.window_min() == 1 && rb1.window_max() == 4);
+    rb1.push_back(2);
+    // {3, 4, 2}, previous minimum was evicted
+    assert(rb1.window_min() == 2 && rb1.window_max() == 4 && rb1.window_min_index() == 2 && rb1.window_max_index() == 1);
+
+    rb1.pop_front();
+    rb1.pop_front();
+    // {2}
+    assert(rb1.size() == 1 && rb1.window_min() == 2 && rb1.window_max() == 2);
+
+    // equal elements: the newest one is reported, so it stays valid for longest
+    simpleContainers::MinMaxRingBuffer<int> rb2(4);
+    rb2.push_back(7);
+    rb2.push_back(7);
+    rb2.push_back(7);
+    assert(rb2.window_min_index() == 2 && rb2.window_max_index() == 2);
+
+    // custom comparison reverses the meaning of min and max
+    simpleContainers::MinMaxRingBuffer<std::string, std::greater<std::string>> rb3(2);
+    rb3.push_back("b");
+    rb3.push_back(std::string("c"));
+    rb3.emplace_back(std::size_t{1}, 'a');
+    // {"c", "a"}
+    assert(rb3.window_min() == "c" && rb3.window_max() == "a");
+
+    // exceptions thrown by the comparison reach the caller
+    const auto throwingCompare = [](int lhs, int rhs) -> bool {
+        if (lhs == 13 || rhs == 13) {
+            throw std::invalid_argument("13 cannot be compared");
+        }
+        return lhs < rhs;
+    };
+    simpleContainers::MinMaxRingBuffer<int, std::function<bool(int, int)>> rb4(4, throwingCompare);
+    rb4.push_back(1);
+    bool thrown = false;
+    try {
+        rb4.push_back(13);
+    }
+    catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+    rb4.clear();
+    rb4.push_back(2);
+    rb4.push_back(1);
+    assert(rb4.window_min() == 1 && rb4.window_max() == 2);
+}
+
+void test_min_max_ring_buffer_randomized() {
+    std::cout << "================= TESTING MIN MAX RING BUFFER AGAINST BRUTE FORCE =================" << std::endl;
+
+    std::mt19937 rng(31337);
+    const std::size_t capacities[] = {1, 2, 3, 10, 64, 257};
+    for (const std::size_t capacity : capacities) {
+        // small value range produces many equal elements
+        std::uniform_int_distribution<int> valueDist(-20, 20);
+        std::uniform_int_distribution<int> actionDist(0, 19);
+
+        simpleContainers::MinMaxRingBuffer<int> rb1(capacity);
+        for (int i = 0; i < 20000; ++i) {
+            const int action = actionDist(rng);
+            if (action == 0 && !rb1.empty()) {
+                rb1.pop_front();
+            }
+            else if (action == 1 && i % 1000 == 1) {
+                rb1.clear();
+            }
+            else {
+                rb1.push_back(valueDist(rng));
+            }
+
+            if (!rb1.empty()) {
+                check_against_brute_force(rb1);
+            }
+        }
+    }
+
+    // monotonic inputs are the worst case for the candidate deques
+    simpleContainers::MinMaxRingBuffer<double> rb2(100);
+    for (int i = 0; i < 1000; ++i) {
+        rb2.push_back(static_cast<double>(i));
+        check_against_brute_force(rb2);
+    }
+    for (int i = 1000; i > 0; --i) {
+        rb2.push_back(static_cast<double>(i));
+        check_against_brute_force(rb2);
+    }
+
+    std::uniform_int_distribution<std::uint64_t> wideDist;
+    simpleContainers::MinMaxRingBuffer<std::uint64_t, std::less<std::uint64_t>, std::allocator<std::uint64_t>, simpleContainers::PowerOfTwoCapacity> rb3(1000);
+    for (int i = 0; i < 10000; ++i) {
+        rb3.push_back(wideDist(rng));
+        if (i % 7 == 0) {
+            check_against_brute_force(rb3);
+        }
+    }
+}
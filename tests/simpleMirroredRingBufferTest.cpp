@@ -0,0 +1,206 @@
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "simpleContainers/simpleMirroredRingBuffer.hpp"
+
+#if SIMPLE_RING_BUFFER_HAS_MIRRORED_RING_BUFFER
+
+#include "simpleContainers/simpleRingBuffer.hpp"
+
+struct SomePodStruct {
+    std::uint32_t id;
+    double value;
+    char tag[20];   // sizeof(SomePodStruct) does not divide the page size
+};
+
+void test_mirrored_ring_buffer_construction();
+void test_mirrored_ring_buffer_insertion();
+void test_mirrored_ring_buffer_contiguity();
+void test_mirrored_ring_buffer_append();
+
+int main() {
+    test_mirrored_ring_buffer_construction();
+    test_mirrored_ring_buffer_insertion();
+    test_mirrored_ring_buffer_contiguity();
+    test_mirrored_ring_buffer_append();
+    return 0;
+}
+
+void test_mirrored_ring_buffer_construction() {
+    std::cout << "================= TESTING MIRRORED RING BUFFER CONSTRUCTION =================" << std::endl;
+
+    simpleContainers::MirroredRingBuffer<char> rb1; // default ctor, capacity is rounded up to whole pages
+    assert(rb1.capacity() >= simpleContainers::MirroredRingBuffer<char>::defaultInitialCapacity);
+    assert(rb1.capacity() % 4096 == 0);
+    assert(rb1.empty() && rb1.size() == 0 && rb1.begin() == rb1.end());
+
+    simpleContainers::MirroredRingBuffer<SomePodStruct> rb2(10);
+    assert(rb2.capacity() >= 10);
+    assert((rb2.capacity() * sizeof(SomePodStruct)) % 4096 == 0);
+
+    simpleContainers::MirroredRingBuffer<std::uint64_t> rb3(100000);
+    assert(rb3.capacity() >= 100000);
+
+    for (std::uint64_t i = 0; i < 5; ++i) { rb3.push_back(i); }
+
+    simpleContainers::MirroredRingBuffer<std::uint64_t> rb3Cpy{rb3}; // copy ctor
+    assert(rb3Cpy == rb3 && rb3Cpy.data() != rb3.data());
+
+    simpleContainers::MirroredRingBuffer<std::uint64_t> rb3Moved{std::move(rb3Cpy)}; // move ctor
+    assert(rb3Moved == rb3);
+
+    simpleContainers::MirroredRingBuffer<std::uint64_t> rbMovedFromCpy{rb3Cpy}; // copy of a moved-from buffer has no storage either
+    assert(rbMovedFromCpy.capacity() == 0 && rbMovedFromCpy.empty());
+    rbMovedFromCpy = rb3;
+    assert(rbMovedFromCpy == rb3);
+
+    simpleContainers::MirroredRingBuffer<std::uint64_t> rb4(8);
+    rb4 = rb3; // copy assignment
+    assert(rb4 == rb3 && rb4.capacity() == rb3.capacity());
+
+    rb4.push_back(100);
+    assert(rb4 != rb3 && rb3 < rb4);
+
+    rb4 = std::move(rb3Moved); // move assignment
+    assert(rb4 == rb3);
+
+    simpleContainers::MirroredRingBuffer<std::uint64_t> rb5(8);
+    rb5.push_back(42);
+    const std::uint64_t* rb5Data = rb5.data();
+    rb4.swap(rb5); // swaps mappings, no elements are copied
+    assert(rb4.size() == 1 && rb4[0] == 42 && rb4.data() == rb5Data);
+    assert(rb5 == rb3);
+}
+
+void test_mirrored_ring_buffer_insertion() {
+    std::cout << "================= TESTING MIRRORED RING BUFFER INSERTION =================" << std::endl;
+
+    simpleContainers::MirroredRingBuffer<int> rb1(1);
+    simpleContainers::RingBuffer<int> rbReference(rb1.capacity());
+
+    // go around the storage several times and compare against RingBuffer of the same capacity
+    const int elemCount = static_cast<int>(rb1.capacity()) * 3 + 17;
+    for (int i = 0; i < elemCount; ++i) {
+        if (i % 2 == 0) {
+            rb1.push_back(i);
+        }
+        else {
+            rb1.emplace_back(i);
+        }
+        rbReference.push_back(i);
+
+        if (i % 97 == 0 || i == elemCount - 1) {
+            assert(rb1.size() == rbReference.size());
+            assert(rb1.get_elements() == rbReference.get_elements());
+            assert(rb1[0] == rbReference[0] && rb1.at(rb1.size() - 1) == rbReference.at(rbReference.size() - 1));
+        }
+    }
+    assert(rb1.full());
+
+    bool thrown = false;
+    try {
+        rb1.at(rb1.size());
+    }
+    catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    rb1.clear();
+    assert(rb1.empty() && rb1.get_elements().empty());
+    rb1.push_back(5);
+    assert(rb1.size() == 1 && rb1[0] == 5);
+}
+
+void test_mirrored_ring_buffer_contiguity() {
+    std::cout << "================= TESTING MIRRORED RING BUFFER CONTIGUITY =================" << std::endl;
+
+    simpleContainers::MirroredRingBuffer<SomePodStruct> rb1(50);
+    const std::size_t capacity = rb1.capacity();
+
+    for (std::uint32_t i = 0; i < capacity + capacity / 2; ++i) {
+        SomePodStruct elem{};
+        elem.id = i;
+        elem.value = i * 0.5;
+        rb1.push_back(elem);
+    }
+
+    // the buffer has wrapped around, but all elements are still one contiguous range in insertion order
+    const SomePodStruct* ptr = rb1.data();
+    for (std::size_t i = 0; i < rb1.size(); ++i) {
+        assert(ptr[i].id == capacity / 2 + i);
+        assert(&ptr[i] == &rb1[i]);
+    }
+
+    const auto segs = rb1.segments();
+    assert(segs.first.data() == ptr && segs.first.size() == rb1.size() && segs.second.empty());
+    assert(rb1.array_one().size() == capacity && rb1.array_two().empty());
+
+    // writes through the second mapping are visible through the first one
+    rb1[rb1.size() - 1].id = 12345;
+    assert(rb1.at(rb1.size() - 1).id == 12345);
+    assert(std::distance(rb1.begin(), rb1.end()) == static_cast<std::ptrdiff_t>(rb1.size()));
+}
+
+void test_mirrored_ring_buffer_append() {
+    std::cout << "================= TESTING MIRRORED RING BUFFER APPEND =================" << std::endl;
+
+    simpleContainers::MirroredRingBuffer<std::uint16_t> rb1(1);
+    simpleContainers::RingBuffer<std::uint16_t> rbReference(rb1.capacity());
+    const std::size_t capacity = rb1.capacity();
+
+    // batch sizes around and above the capacity cover every position of the wrap point
+    const std::size_t batchSizes[] = {0, 1, 7, capacity / 3, capacity - 1, capacity, capacity + 5, 3 * capacity};
+    std::uint16_t counter = 0;
+    for (int round = 0; round < 4; ++round) {
+        for (const std::size_t batchSize : batchSizes) {
+            std::vector<std::uint16_t> batch(batchSize);
+            for (auto& elem : batch) { elem = counter++; }
+
+            rb1.append(batch.data(), batch.size());
+            rbReference.append(batch.data(), batch.size());
+
+            assert(rb1.size() == rbReference.size());
+            assert(std::equal(rb1.begin(), rb1.end(), rbReference.begin()));
+        }
+    }
+
+    // checksum over data() without any wrap handling
+    const std::uint64_t sum = std::accumulate(rb1.data(), rb1.data() + rb1.size(), std::uint64_t{0});
+    const std::uint64_t expectedSum = std::accumulate(rbReference.begin(), rbReference.end(), std::uint64_t{0});
+    assert(sum == expectedSum);
+
+    // the source may be the buffer's own elements
+    const std::vector<std::uint16_t> ownElements(rb1.data() + 1, rb1.data() + 5);
+    rb1.append(rb1.data() + 1, 4);
+    rbReference.append(ownElements.data(), ownElements.size());
+    assert(rb1.size() == rbReference.size());
+    assert(std::equal(rb1.begin(), rb1.end(), rbReference.begin()));
+
+    // the source wraps onto itself when the buffer is not full and the write goes past the free room
+    simpleContainers::MirroredRingBuffer<std::uint16_t> rb2(1);
+    simpleContainers::RingBuffer<std::uint16_t> rb2Reference(rb2.capacity());
+    for (std::size_t i = 0; i < capacity - 2; ++i) {
+        rb2.push_back(static_cast<std::uint16_t>(i));
+        rb2Reference.push_back(static_cast<std::uint16_t>(i));
+    }
+    const std::vector<std::uint16_t> rb2Elements(rb2.begin(), rb2.end());
+    rb2.append(rb2.data(), rb2.size());
+    rb2Reference.append(rb2Elements.data(), rb2Elements.size());
+    assert(rb2.full() && std::equal(rb2.begin(), rb2.end(), rb2Reference.begin()));
+}
+
+#else
+
+int main() {
+    std::cout << "================= MIRRORED RING BUFFER IS NOT AVAILABLE ON THIS PLATFORM =================" << std::endl;
+    return 0;
+}
+
+#endif // #if SIMPLE_RING_BUFFER_HAS_MIRRORED_RING_BUFFER
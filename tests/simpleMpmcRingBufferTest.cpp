@@ -0,0 +1,187 @@
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "simpleContainers/simpleMpmcRingBuffer.hpp"
+
+#include "someTestClass.hpp"
+#include "someAllocatorClass.hpp"
+
+void test_mpmc_ring_buffer_construction();
+void test_mpmc_ring_buffer_push_and_pop();
+void test_mpmc_ring_buffer_scaling();
+
+int main() {
+    test_mpmc_ring_buffer_construction();
+    test_mpmc_ring_buffer_push_and_pop();
+    test_mpmc_ring_buffer_scaling();
+    return 0;
+}
+
+void test_mpmc_ring_buffer_construction() {
+    std::cout << "================= TESTING MPMC RING BUFFER CONSTRUCTION =================" << std::endl;
+
+    simpleContainers::MpmcRingBuffer<SomeClass> rb1; // default ctor
+    assert(rb1.capacity() == simpleContainers::MpmcRingBuffer<SomeClass>::defaultInitialCapacity);
+    assert(rb1.size() == 0 && rb1.empty());
+
+    simpleContainers::MpmcRingBuffer<SomeClass> rb2(5); // capacity is rounded up to a power of two
+    assert(rb2.capacity() == 8);
+
+    simpleContainers::MpmcRingBuffer<SomeClass> rb3(1); // a single slot breaks the sequence protocol, capacity is at least 2
+    assert(rb3.capacity() == 2);
+    bool pushed = rb3.try_push(SomeClass{1});
+    pushed = rb3.try_push(SomeClass{2}) && pushed;
+    assert(pushed && rb3.size() == 2);
+    pushed = rb3.try_push(SomeClass{3});
+    assert(!pushed);
+    SomeClass popped;
+    bool wasPopped = rb3.try_pop(popped);
+    assert(wasPopped && popped == SomeClass{1});
+    wasPopped = rb3.try_pop(popped);
+    assert(wasPopped && popped == SomeClass{2});
+    wasPopped = rb3.try_pop(popped);
+    assert(!wasPopped && rb3.empty());
+    pushed = rb3.try_push(SomeClass{4});
+    wasPopped = rb3.try_pop(popped);
+    assert(pushed && wasPopped && popped == SomeClass{4});
+
+    SomeAllocatorClass<SomeClass> customAlloc;
+    simpleContainers::MpmcRingBuffer<SomeClass, SomeAllocatorClass<SomeClass>> rb1CustomAlloc(4, customAlloc); // ctor with custom allocator
+    assert(rb1CustomAlloc.capacity() == 4);
+
+    for (int i = 0; i < 3; ++i) { rb1CustomAlloc.try_push(SomeClass{i}); }
+    assert(rb1CustomAlloc.size() == 3);
+    // remaining elements are destroyed through the allocator in the dtor
+}
+
+void test_mpmc_ring_buffer_push_and_pop() {
+    std::cout << "================= TESTING MPMC RING BUFFER PUSH AND POP =================" << std::endl;
+
+    simpleContainers::MpmcRingBuffer<int> rb1(4);
+    int out = -1;
+    bool success = rb1.try_pop(out);
+    assert(!success && out == -1);
+
+    for (int i = 0; i < 4; ++i) {
+        success = rb1.try_push(i);
+        assert(success);
+    }
+    assert(rb1.size() == 4);
+    success = rb1.try_push(4); // full, nothing is overwritten
+    assert(!success && rb1.size() == 4);
+
+    // wrap around the end of the storage several times
+    int expected = 0;
+    for (int i = 4; i < 50; ++i) {
+        success = rb1.try_pop(out);
+        assert(success && out == expected);
+        ++expected;
+        success = rb1.try_emplace(i);
+        assert(success);
+    }
+
+    while (rb1.try_pop(out)) {
+        assert(out == expected);
+        ++expected;
+    }
+    assert(expected == 50 && rb1.empty());
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    // move only types
+    simpleContainers::MpmcRingBuffer<std::unique_ptr<std::string>> rbMoveOnly(2);
+    rbMoveOnly.try_push(std::unique_ptr<std::string>(new std::string{"str1"}));
+    rbMoveOnly.try_emplace(new std::string{"str2"});
+    assert(rbMoveOnly.size() == 2);
+
+    std::unique_ptr<std::string> rejected(new std::string{"str3"});
+    success = rbMoveOnly.try_push(std::move(rejected));
+    assert(!success && rejected != nullptr && *rejected == "str3"); // not moved from on failure
+
+    std::unique_ptr<std::string> outPtr;
+    success = rbMoveOnly.try_pop(outPtr);
+    assert(success && *outPtr == "str1");
+    success = rbMoveOnly.try_pop(outPtr);
+    assert(success && *outPtr == "str2");
+    assert(rbMoveOnly.empty());
+}
+
+void test_mpmc_ring_buffer_scaling() {
+    std::cout << "================= TESTING MPMC RING BUFFER SCALING =================" << std::endl;
+
+    const unsigned int maxThreads = std::max(2u, std::min(4u, std::thread::hardware_concurrency()));
+    const std::uint64_t elemsPerProducer = 20000;
+
+    for (unsigned int producerCount = 1; producerCount <= maxThreads; ++producerCount) {
+        for (unsigned int consumerCount = 1; consumerCount <= maxThreads; ++consumerCount) {
+            simpleContainers::MpmcRingBuffer<std::uint64_t> rb(256);
+            const std::uint64_t totalElems = elemsPerProducer * producerCount;
+            std::atomic<std::uint64_t> consumedCount{0};
+            // every consumer records what it received so that no element is lost or delivered twice
+            std::vector<std::vector<std::uint64_t>> received(consumerCount);
+
+            const auto start = std::chrono::steady_clock::now();
+
+            std::vector<std::thread> threads;
+            for (unsigned int p = 0; p < producerCount; ++p) {
+                threads.emplace_back([&rb, p, elemsPerProducer]() {
+                    for (std::uint64_t i = 0; i < elemsPerProducer; ++i) {
+                        while (!rb.try_push(p * elemsPerProducer + i)) { std::this_thread::yield(); }
+                    }
+                });
+            }
+
+            for (unsigned int c = 0; c < consumerCount; ++c) {
+                threads.emplace_back([&rb, &consumedCount, &received, c, totalElems]() {
+                    std::uint64_t out = 0;
+                    while (consumedCount.load(std::memory_order_relaxed) < totalElems) {
+                        if (rb.try_pop(out)) {
+                            received[c].push_back(out);
+                            consumedCount.fetch_add(1, std::memory_order_relaxed);
+                        }
+                        else {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+            }
+
+            for (auto& t : threads) { t.join(); }
+
+            const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+            std::vector<std::uint64_t> allReceived;
+            for (const auto& vec : received) {
+                // elements of one producer are claimed in insertion order, so a single consumer sees them in that order too
+                std::vector<std::uint64_t> lastSeen(producerCount, 0);
+                std::vector<bool> seenAny(producerCount, false);
+                for (std::uint64_t val : vec) {
+                    const std::vector<bool>::size_type producer = val / elemsPerProducer;
+                    assert(!seenAny[producer] || lastSeen[producer] < val);
+                    lastSeen[producer] = val;
+                    seenAny[producer] = true;
+                }
+                allReceived.insert(allReceived.end(), vec.begin(), vec.end());
+            }
+
+            assert(allReceived.size() == totalElems);
+            std::sort(allReceived.begin(), allReceived.end());
+            for (std::size_t i = 0; i < allReceived.size(); ++i) {
+                assert(allReceived[i] == i);
+            }
+            assert(rb.empty());
+
+            std::cout << producerCount << " producers, " << consumerCount << " consumers: "
+                << static_cast<double>(totalElems) * 1e9 / static_cast<double>(elapsed) << " elements/s" << std::endl;
+        }
+    }
+}
@@ -0,0 +1,170 @@
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "simpleContainers/simpleQuantileRingBuffer.hpp"
+
+void test_quantile_ring_buffer_construction();
+void test_quantile_ring_buffer_exact_range();
+void test_quantile_ring_buffer_randomized();
+
+int main() {
+    test_quantile_ring_buffer_construction();
+    test_quantile_ring_buffer_exact_range();
+    test_quantile_ring_buffer_randomized();
+    return 0;
+}
+
+namespace {
+    const double testedQuantiles[] = {0.0, 0.001, 0.1, 0.5, 0.9, 0.99, 0.999, 1.0};
+
+    // compare reported quantiles against nearest rank quantiles of the sorted window
+    template <typename QuantileBuffer>
+    void check_against_sorted(const QuantileBuffer& rb) {
+        using value_type = typename QuantileBuffer::value_type;
+
+        std::vector<value_type> sorted(rb.begin(), rb.end());
+        std::sort(sorted.begin(), sorted.end());
+
+        for (const double q : testedQuantiles) {
+            const double exactRank = std::ceil(q * static_cast<double>(sorted.size()));
+            const std::size_t rank = std::min(sorted.size(), std::max(std::size_t{1}, static_cast<std::size_t>(exactRank)));
+            const value_type exact = sorted[rank - 1];
+            const value_type reported = rb.quantile(q);
+
+            // reported value is in the same bucket as the exact one
+            assert(rb.count_up_to(reported) == rb.count_up_to(exact));
+            const double error = std::fabs(static_cast<double>(reported) - static_cast<double>(exact));
+            assert(error <= static_cast<double>(exact) * QuantileBuffer::max_relative_error());
+        }
+    }
+} // namespace
+
+void test_quantile_ring_buffer_construction() {
+    std::cout << "================= TESTING QUANTILE RING BUFFER CONSTRUCTION =================" << std::endl;
+
+    simpleContainers::QuantileRingBuffer<std::uint32_t> rb1;
+    assert(rb1.capacity() == simpleContainers::RingBuffer<std::uint32_t>::defaultInitialCapacity);
+    assert(rb1.empty() && rb1.size() == 0 && !rb1.full() && rb1.begin() == rb1.end());
+
+    // 128 exact values, then 64 buckets for each of the remaining 25 bit positions
+    assert((simpleContainers::QuantileRingBuffer<std::uint32_t, 7>::bucket_count() == 128 + 25 * 64));
+    assert((simpleContainers::QuantileRingBuffer<std::uint32_t, 7>::max_relative_error() < 0.008));
+    assert((simpleContainers::QuantileRingBuffer<std::uint32_t, 4>::bucket_count() < simpleContainers::QuantileRingBuffer<std::uint32_t, 7>::bucket_count()));
+    assert((simpleContainers::QuantileRingBuffer<std::uint64_t, 10>::histogram_bytes() ==
+        (simpleContainers::QuantileRingBuffer<std::uint64_t, 10>::bucket_count() + 56) * sizeof(std::size_t)));
+
+    simpleContainers::QuantileRingBuffer<std::uint16_t, 5, std::allocator<std::uint16_t>, simpleContainers::PowerOfTwoCapacity> rb2(5);
+    assert(rb2.capacity() == 8);
+    for (std::uint16_t i = 0; i < 12; ++i) { rb2.push_back(i); }
+    assert(rb2.full() && rb2.front() == 4 && rb2.back() == 11 && rb2[2] == 6 && rb2.at(7) == 11);
+    assert(rb2.elements().size() == 8 && std::equal(rb2.cbegin(), rb2.cend(), rb2.elements().begin()));
+
+    bool thrown = false;
+    try {
+        rb2.at(8);
+    }
+    catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    simpleContainers::QuantileRingBuffer<std::uint16_t, 5, std::allocator<std::uint16_t>, simpleContainers::PowerOfTwoCapacity> rb2Cpy{rb2};
+    rb2.clear();
+    assert(rb2.empty() && rb2.count_up_to(std::numeric_limits<std::uint16_t>::max()) == 0);
+    assert(rb2Cpy.count_up_to(std::numeric_limits<std::uint16_t>::max()) == 8 && rb2Cpy.median() == 7);
+}
+
+void test_quantile_ring_buffer_exact_range() {
+    std::cout << "================= TESTING QUANTILE RING BUFFER EXACT RANGE =================" << std::endl;
+
+    // values below 2^PrecisionBits are reported exactly
+    simpleContainers::QuantileRingBuffer<std::uint32_t, 7> rb1(100);
+    for (std::uint32_t i = 1; i <= 100; ++i) { rb1.push_back(i); }
+    assert(rb1.quantile(0.0) == 1 && rb1.quantile(0.01) == 1 && rb1.quantile(0.015) == 2);
+    assert(rb1.median() == 50 && rb1.quantile(0.99) == 99 && rb1.quantile(1.0) == 100);
+    assert(rb1.count_up_to(0) == 0 && rb1.count_up_to(10) == 10 && rb1.count_up_to(1000) == 100);
+
+    // evictions are removed from the histogram
+    for (std::uint32_t i = 0; i < 50; ++i) { rb1.push_back(0); }
+    assert(rb1.median() == 0 && rb1.quantile(0.51) == 51 && rb1.quantile(1.0) == 100);
+
+    rb1.pop_front();
+    assert(rb1.size() == 99 && rb1.count_up_to(51) == 50);
+
+    // all elements in one wide bucket are reported as its middle
+    simpleContainers::QuantileRingBuffer<std::uint32_t, 2> rb2(10);
+    rb2.push_back(1024);
+    rb2.push_back(1100);
+    // buckets at this magnitude are [1024, 1535] and [1536, 2047]
+    assert(rb2.median() == 1279 && rb2.quantile(1.0) == 1279);
+    rb2.push_back(2047);
+    assert(rb2.quantile(1.0) == 1791);
+
+    // extreme values of the type
+    simpleContainers::QuantileRingBuffer<std::uint8_t, 3> rb3(4);
+    rb3.push_back(255);
+    rb3.push_back(0);
+    assert(rb3.quantile(0.0) == 0 && rb3.quantile(1.0) >= 224);
+
+    simpleContainers::QuantileRingBuffer<std::uint64_t> rb4(4);
+    rb4.push_back(std::numeric_limits<std::uint64_t>::max());
+    rb4.push_back(1);
+    check_against_sorted(rb4);
+}
+
+void test_quantile_ring_buffer_randomized() {
+    std::cout << "================= TESTING QUANTILE RING BUFFER AGAINST SORTED WINDOW =================" << std::endl;
+
+    std::mt19937_64 rng(4242);
+
+    // latency-like distribution: most values are small, some are orders of magnitude larger
+    std::lognormal_distribution<double> latencyDist(6.0, 1.5);
+    std::uniform_int_distribution<int> actionDist(0, 29);
+
+    simpleContainers::QuantileRingBuffer<std::uint32_t> rb1(1000);
+    simpleContainers::QuantileRingBuffer<std::uint32_t, 3> rb2(1000);
+    simpleContainers::QuantileRingBuffer<std::uint32_t, 12> rb3(1000);
+    for (int i = 0; i < 30000; ++i) {
+        if (actionDist(rng) == 0 && !rb1.empty()) {
+            rb1.pop_front();
+            rb2.pop_front();
+            rb3.pop_front();
+        }
+        else {
+            const std::uint32_t value = static_cast<std::uint32_t>(std::min(latencyDist(rng), 4e9));
+            rb1.push_back(value);
+            rb2.push_back(value);
+            rb3.push_back(value);
+        }
+
+        if (!rb1.empty() && i % 97 == 0) {
+            check_against_sorted(rb1);
+            check_against_sorted(rb2);
+            check_against_sorted(rb3);
+        }
+    }
+
+    std::uniform_int_distribution<std::uint64_t> wideDist;
+    simpleContainers::QuantileRingBuffer<std::uint64_t, 8> rb4(257);
+    for (int i = 0; i < 5000; ++i) {
+        rb4.push_back(wideDist(rng) >> (i % 64));
+        if (i % 13 == 0) {
+            check_against_sorted(rb4);
+        }
+    }
+
+    simpleContainers::QuantileRingBuffer<std::uint16_t, 1> rb5(50);
+    std::uniform_int_distribution<std::uint16_t> shortDist;
+    for (int i = 0; i < 2000; ++i) {
+        rb5.push_back(shortDist(rng));
+        check_against_sorted(rb5);
+    }
+}
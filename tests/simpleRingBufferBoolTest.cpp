@@ -0,0 +1,323 @@
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "simpleContainers/simpleRingBuffer.hpp"
+
+#include "someTaggedAllocatorClass.hpp"
+
+void test_bool_ring_buffer_construction();
+void test_bool_ring_buffer_overflow_policies();
+void test_bool_ring_buffer_iterators();
+void test_bool_ring_buffer_popcount();
+void test_bool_ring_buffer_randomized();
+
+int main() {
+    test_bool_ring_buffer_construction();
+    test_bool_ring_buffer_overflow_policies();
+    test_bool_ring_buffer_iterators();
+    test_bool_ring_buffer_popcount();
+    test_bool_ring_buffer_randomized();
+    return 0;
+}
+
+namespace {
+    template <typename BoolBuffer>
+    void check_against_deque(const BoolBuffer& rb, const std::deque<bool>& expected) {
+        assert(rb.size() == expected.size());
+        assert(std::equal(rb.cbegin(), rb.cend(), expected.begin()));
+        assert(rb.count() == static_cast<std::size_t>(std::count(expected.begin(), expected.end(), true)));
+    }
+} // namespace
+
+void test_bool_ring_buffer_construction() {
+    std::cout << "================= TESTING BOOL RING BUFFER CONSTRUCTION =================" << std::endl;
+
+    simpleContainers::RingBuffer<bool> rb1;
+    assert(rb1.capacity() == simpleContainers::RingBuffer<bool>::defaultInitialCapacity);
+    assert(rb1.empty() && rb1.size() == 0 && !rb1.full() && rb1.begin() == rb1.end());
+    // 64 flags in a single word instead of 64 bytes
+    assert(rb1.storage_bytes() == 8 && rb1.count() == 0);
+
+    simpleContainers::RingBuffer<bool> rb2(100, true);
+    assert(rb2.full() && rb2.count() == 100 && rb2.storage_bytes() == 16);
+
+    simpleContainers::RingBuffer<bool> rb3{true, false, false, true, true};
+    assert(rb3.capacity() == 5 && rb3.size() == 5 && rb3.count() == 3);
+    assert(rb3.front() && !rb3[1] && !rb3.at(2) && rb3.back());
+
+    const std::vector<bool> vec{false, true, false};
+    simpleContainers::RingBuffer<bool> rb4(vec);
+    assert(rb4.get_elements() == vec);
+
+    simpleContainers::RingBuffer<bool> rb5(vec.begin(), vec.end());
+    assert(rb4 == rb5 && !(rb4 != rb5));
+
+    // proxy references write through to the bits
+    rb3[1] = true;
+    rb3.front() = false;
+    rb3.back().flip();
+    rb3[4] = rb3[1];
+    assert((rb3.get_elements() == std::vector<bool>{false, true, false, true, true}));
+    assert(~rb3[0] && !~rb3[1]);
+
+    bool thrown = false;
+    try {
+        rb3.at(5);
+    }
+    catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    const simpleContainers::RingBuffer<bool>& constRb3 = rb3;
+    static_assert(std::is_same<decltype(constRb3[0]), bool>::value, "const access returns bool by value");
+    assert(!constRb3.front() && constRb3.back() && constRb3.at(1));
+
+    // copy, move and swap
+    simpleContainers::RingBuffer<bool> rb3Cpy(rb3);
+    rb3.clear();
+    assert(rb3.empty() && rb3Cpy.size() == 5 && rb3Cpy.count() == 3);
+
+    simpleContainers::RingBuffer<bool> rb6(std::move(rb3Cpy));
+    assert(rb6.size() == 5 && rb3Cpy.empty() && rb3Cpy.capacity() == 5);
+    // moved-from buffer allocates new storage when used again
+    rb3Cpy.push_back(true);
+    assert(rb3Cpy.size() == 1 && rb3Cpy.front());
+
+    rb3 = rb6;
+    assert(rb3 == rb6);
+    rb3.swap(rb1);
+    assert(rb1.size() == 5 && rb3.empty() && rb3.capacity() == 64);
+    rb3 = std::move(rb1);
+    assert(rb3.size() == 5 && rb3.count() == 3);
+
+    // storage always stays with the allocator it came from when allocators do not propagate
+    {
+        using NonPropagatingRingBuffer = simpleContainers::RingBuffer<bool, TaggedAllocator<bool, false>>;
+        using TaggedAlloc = TaggedAllocator<bool, false>;
+        NonPropagatingRingBuffer rbA(3, TaggedAlloc{1});
+        NonPropagatingRingBuffer rbB(70, TaggedAlloc{2});
+        rbB.push_back(true);
+
+        rbA = rbB;
+        assert(rbA.get_allocator().mId == 1 && rbA.capacity() == 70 && rbA.size() == 1 && rbA.front());
+        NonPropagatingRingBuffer rbC(5, TaggedAlloc{3});
+        rbC.push_back(false);
+        rbC.push_back(true);
+        rbA = std::move(rbC); // unequal allocators, bits are copied into storage from rbA's allocator
+        assert(rbA.get_allocator().mId == 1 && rbA.capacity() == 5 && rbA.size() == 2 && rbA.back());
+        NonPropagatingRingBuffer rbD(8, TaggedAlloc{1});
+        rbA = std::move(rbD); // equal allocators, storage is taken over
+        assert(rbA.capacity() == 8 && rbA.empty());
+        NonPropagatingRingBuffer rbE(1, TaggedAlloc{1});
+        rbA.swap(rbE);
+        assert(rbA.get_allocator().mId == 1 && rbA.capacity() == 1 && rbE.capacity() == 8);
+    }
+    for (const auto& idAndCount : TaggedAllocator<std::uint64_t, false>::live_blocks()) { assert(idAndCount.second == 0); }
+
+    // comparisons are lexicographical, false < true
+    const simpleContainers::RingBuffer<bool> lhs{false, true};
+    const simpleContainers::RingBuffer<bool> rhs{true, false};
+    const simpleContainers::RingBuffer<bool> prefix{false};
+    assert(lhs < rhs && lhs <= rhs && rhs > lhs && rhs >= lhs && prefix < lhs && !(lhs < prefix));
+
+    // change_capacity keeps the newest elements
+    simpleContainers::RingBuffer<bool> rb7(10);
+    for (int i = 0; i < 15; ++i) {
+        rb7.push_back(i % 3 == 0);
+    }
+    rb7.change_capacity(4);
+    assert(rb7.capacity() == 4 && (rb7.get_elements() == std::vector<bool>{false, true, false, false}));
+    rb7.change_capacity(200);
+    assert(rb7.capacity() == 200 && rb7.size() == 4 && rb7.count() == 1);
+
+    rb7.pop_back();
+    rb7.pop_front();
+    assert((rb7.get_elements() == std::vector<bool>{true, false}));
+    rb7.pop_front(2);
+    assert(rb7.empty());
+}
+
+void test_bool_ring_buffer_overflow_policies() {
+    std::cout << "================= TESTING BOOL RING BUFFER POLICIES =================" << std::endl;
+
+    simpleContainers::RingBuffer<bool, std::allocator<bool>, simpleContainers::PowerOfTwoCapacity> rb1(100);
+    assert(rb1.capacity() == 128 && rb1.storage_bytes() == 16);
+    for (int i = 0; i < 300; ++i) {
+        rb1.push_back(i % 2 == 0);
+    }
+    assert(rb1.full() && rb1.count() == 64 && rb1.front() && !rb1.back());
+
+    simpleContainers::RingBuffer<bool, std::allocator<bool>, simpleContainers::ExactCapacity, simpleContainers::RejectNew> rb2(3);
+    rb2.push_back(true);
+    rb2.push_back(false);
+    rb2.push_back(true);
+    rb2.push_back(false);
+    assert(rb2.size() == 3 && rb2.count() == 2 && rb2.back());
+
+    simpleContainers::RingBuffer<bool, std::allocator<bool>, simpleContainers::ExactCapacity, simpleContainers::CountRejectedNew> rb3(2);
+    const bool pushedFirst = rb3.try_push_back(true);
+    const bool pushedSecond = rb3.try_push_back(true);
+    const bool pushedThird = rb3.try_push_back(false);
+    assert(pushedFirst && pushedSecond && !pushedThird);
+    rb3.push_back(false);
+    assert(rb3.overflow_policy().rejected_count() == 2 && rb3.count() == 2);
+
+    // try_push_back never overwrites, even with OverwriteOldest
+    simpleContainers::RingBuffer<bool> rb4(1);
+    const bool pushedIntoEmpty = rb4.try_push_back(false);
+    const bool pushedIntoFull = rb4.try_push_back(true);
+    assert(pushedIntoEmpty && !pushedIntoFull && !rb4.front());
+    rb4.push_back(true);
+    assert(rb4.front() && rb4.count() == 1);
+}
+
+void test_bool_ring_buffer_iterators() {
+    std::cout << "================= TESTING BOOL RING BUFFER ITERATORS =================" << std::endl;
+
+    using BoolBuffer = simpleContainers::RingBuffer<bool>;
+    static_assert((std::is_same<std::iterator_traits<BoolBuffer::iterator>::iterator_category, std::random_access_iterator_tag>::value), "");
+    static_assert((std::is_same<BoolBuffer::iterator::reference, BoolBuffer::reference>::value), "");
+    static_assert((std::is_same<BoolBuffer::const_iterator::reference, bool>::value), "");
+
+    BoolBuffer rb1(70);
+    for (int i = 0; i < 100; ++i) {
+        rb1.push_back(i % 5 == 0);
+    }
+    // elements 30..99, wrapped around the end of the storage
+
+    std::size_t seen = 0;
+    for (const auto& flag : rb1) {
+        if (flag) {
+            ++seen;
+        }
+    }
+    assert(seen == 14 && rb1.count() == 14);
+
+    for (auto&& flag : rb1) {
+        flag = !flag;
+    }
+    assert(rb1.count() == 56);
+
+    auto it = rb1.begin();
+    assert(rb1.end() - it == 70 && std::distance(rb1.cbegin(), rb1.cend()) == 70);
+    assert(!it[0] && it[1] && !*(it + 5) && !*(5 + it));
+    it += 10;
+    assert(!*it && *(it - 1));
+    --it;
+    it--;
+    ++it;
+    it++;
+    it -= 5;
+    assert(!*it && it > rb1.begin() && it >= rb1.begin() && it < rb1.end() && it <= rb1.end() && it != rb1.end());
+
+    BoolBuffer::const_iterator cit = it;
+    assert(!*cit && cit == BoolBuffer::const_iterator(rb1.begin() + 5));
+
+    // standard algorithms work through the proxy
+    assert(std::count(rb1.cbegin(), rb1.cend(), true) == 56);
+    assert(std::find(rb1.begin(), rb1.end(), false) - rb1.begin() == 0);
+    std::fill(rb1.begin(), rb1.begin() + 35, true);
+    assert(rb1.count() == 63 && rb1.count(0, 35) == 35);
+}
+
+void test_bool_ring_buffer_popcount() {
+    std::cout << "================= TESTING BOOL RING BUFFER POPCOUNT =================" << std::endl;
+
+    assert(simpleContainers::detail::popcount64(0) == 0);
+    assert(simpleContainers::detail::popcount64(~std::uint64_t{0}) == 64);
+    assert(simpleContainers::detail::popcount64(0x8000000000000001ULL) == 2);
+    assert(simpleContainers::detail::low_bits_mask(0) == 0 && simpleContainers::detail::low_bits_mask(64) == ~std::uint64_t{0});
+
+    std::mt19937_64 rng(23);
+    std::vector<std::uint64_t> words(37);
+    std::size_t expected = 0;
+    for (std::uint64_t& word : words) {
+        word = rng();
+        for (int bit = 0; bit < 64; ++bit) {
+            expected += (word >> bit) & 1;
+        }
+    }
+    // the POPCNT kernel, if the CPU has it, and the portable kernel give the same result for every tail length
+    for (std::size_t count = 0; count <= words.size(); ++count) {
+        std::size_t portable = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            portable += simpleContainers::detail::popcount64(words[i]);
+        }
+        assert(simpleContainers::detail::popcount_words(words.data(), count) == portable);
+    }
+    assert(simpleContainers::detail::popcount_words(words.data(), words.size()) == expected);
+
+    // windows that start and end inside words, on word boundaries and across the end of the storage
+    simpleContainers::RingBuffer<bool> rb1(256);
+    for (int i = 0; i < 256 + 100; ++i) {
+        rb1.push_back(i % 3 == 0);
+    }
+    std::deque<bool> reference;
+    for (int i = 100; i < 356; ++i) {
+        reference.push_back(i % 3 == 0);
+    }
+    for (std::size_t pos = 0; pos <= 256; pos += 7) {
+        for (std::size_t n = 0; pos + n <= 256; n += 13) {
+            const std::size_t expectedCount = static_cast<std::size_t>(std::count(reference.begin() + static_cast<std::ptrdiff_t>(pos),
+                reference.begin() + static_cast<std::ptrdiff_t>(pos + n), true));
+            assert(rb1.count(pos, n) == expectedCount);
+        }
+    }
+    assert(rb1.count_last(0) == 0 && rb1.count_last(3) == 1 && rb1.count_last(256) == rb1.count());
+}
+
+void test_bool_ring_buffer_randomized() {
+    std::cout << "================= TESTING BOOL RING BUFFER AGAINST STD::DEQUE =================" << std::endl;
+
+    std::mt19937 rng(1337);
+    std::uniform_int_distribution<int> actionDist(0, 19);
+    std::bernoulli_distribution flagDist(0.3);
+
+    const std::size_t capacities[] = {1, 63, 64, 65, 200, 1000};
+    for (const std::size_t capacity : capacities) {
+        simpleContainers::RingBuffer<bool> rb(capacity);
+        std::deque<bool> expected;
+
+        for (int i = 0; i < 5000; ++i) {
+            const int action = actionDist(rng);
+            if (action == 0 && !expected.empty()) {
+                rb.pop_front();
+                expected.pop_front();
+            }
+            else if (action == 1 && !expected.empty()) {
+                rb.pop_back();
+                expected.pop_back();
+            }
+            else if (action == 2) {
+                const std::size_t n = std::min<std::size_t>(expected.size(), static_cast<std::size_t>(i % 70));
+                rb.pop_front(n);
+                expected.erase(expected.begin(), expected.begin() + static_cast<std::ptrdiff_t>(n));
+            }
+            else {
+                const bool flag = flagDist(rng);
+                rb.push_back(flag);
+                expected.push_back(flag);
+                if (expected.size() > capacity) {
+                    expected.pop_front();
+                }
+            }
+
+            const std::size_t k = expected.empty() ? 0 : static_cast<std::size_t>(i) % (expected.size() + 1);
+            assert(rb.count_last(k) == static_cast<std::size_t>(std::count(expected.end() - static_cast<std::ptrdiff_t>(k), expected.end(), true)));
+            if (i % 17 == 0) {
+                check_against_deque(rb, expected);
+            }
+        }
+    }
+}
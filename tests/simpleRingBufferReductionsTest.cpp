@@ -0,0 +1,206 @@
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "simpleContainers/simpleRingBuffer.hpp"
+#include "simpleContainers/simpleRingBufferReductions.hpp"
+
+void test_ring_buffer_reductions_dispatch();
+void test_ring_buffer_reductions_double();
+void test_ring_buffer_reductions_int64();
+void test_ring_buffer_reductions_other_types();
+void test_ring_buffer_reductions_dot();
+
+int main() {
+    test_ring_buffer_reductions_dispatch();
+    test_ring_buffer_reductions_double();
+    test_ring_buffer_reductions_int64();
+    test_ring_buffer_reductions_other_types();
+    test_ring_buffer_reductions_dot();
+    return 0;
+}
+
+namespace {
+    const simpleContainers::SimdLevel allLevels[] = {simpleContainers::SimdLevel::Scalar, simpleContainers::SimdLevel::Sse2, simpleContainers::SimdLevel::Avx2};
+
+    bool nearly_equal(const double lhs, const double rhs) {
+        return std::fabs(lhs - rhs) <= 1e-9 * std::max(1.0, std::max(std::fabs(lhs), std::fabs(rhs)));
+    }
+
+    // fill rb so that its oldest element is wrapOffset positions into the storage
+    template <typename T, typename Generator>
+    simpleContainers::RingBuffer<T> make_wrapped_ring_buffer(const std::size_t capacity, const std::size_t wrapOffset, Generator gen) {
+        simpleContainers::RingBuffer<T> rb(capacity);
+        for (std::size_t i = 0; i < capacity + wrapOffset; ++i) {
+            rb.push_back(gen());
+        }
+        return rb;
+    }
+} // namespace
+
+void test_ring_buffer_reductions_dispatch() {
+    std::cout << "================= TESTING RING BUFFER REDUCTIONS DISPATCH =================" << std::endl;
+
+    const simpleContainers::SimdLevel level = simpleContainers::detected_simd_level();
+    assert(level == simpleContainers::detected_simd_level());
+
+#if SIMPLE_RING_BUFFER_HAS_X86_SIMD
+    assert(level >= simpleContainers::SimdLevel::Sse2);
+#else
+    assert(level == simpleContainers::SimdLevel::Scalar);
+#endif // #if SIMPLE_RING_BUFFER_HAS_X86_SIMD
+
+    // requesting a level the CPU does not support falls back to the detected one
+    simpleContainers::RingBuffer<double> rb1(4);
+    for (double i = 1.0; i <= 6.0; i += 1.0) { rb1.push_back(i); }
+    assert(nearly_equal(simpleContainers::window_sum(rb1, simpleContainers::SimdLevel::Avx2), 18.0));
+    assert(nearly_equal(simpleContainers::window_sum(rb1, simpleContainers::SimdLevel::Scalar), 18.0));
+
+    simpleContainers::RingBuffer<double> rb2(10);
+    assert(nearly_equal(simpleContainers::window_sum(rb2), 0.0));
+}
+
+void test_ring_buffer_reductions_double() {
+    std::cout << "================= TESTING RING BUFFER REDUCTIONS FOR DOUBLE =================" << std::endl;
+
+    std::mt19937_64 rng(12345);
+    std::uniform_real_distribution<double> dist(-1000.0, 1000.0);
+
+    // sizes around the register widths and unroll factors, wrap points at the start, middle and end of the storage
+    const std::size_t capacities[] = {1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33, 100, 1001};
+    for (const std::size_t capacity : capacities) {
+        const std::size_t wrapOffsets[] = {0, 1, capacity / 2, capacity - 1};
+        for (const std::size_t wrapOffset : wrapOffsets) {
+            const simpleContainers::RingBuffer<double> rb = make_wrapped_ring_buffer<double>(capacity, wrapOffset, [&]() { return dist(rng); });
+            const std::vector<double> elems = rb.get_elements();
+
+            const double expectedSum = std::accumulate(elems.begin(), elems.end(), 0.0);
+            const double expectedMin = *std::min_element(elems.begin(), elems.end());
+            const double expectedMax = *std::max_element(elems.begin(), elems.end());
+
+            for (const simpleContainers::SimdLevel level : allLevels) {
+                assert(nearly_equal(simpleContainers::window_sum(rb, level), expectedSum));
+                assert(nearly_equal(simpleContainers::window_mean(rb, level), expectedSum / static_cast<double>(capacity)));
+                assert(nearly_equal(simpleContainers::window_min(rb, level), expectedMin));
+                assert(nearly_equal(simpleContainers::window_max(rb, level), expectedMax));
+            }
+        }
+    }
+
+    // partially filled RingBuffer has only one segment
+    simpleContainers::RingBuffer<double> rb1(64);
+    for (int i = 0; i < 20; ++i) { rb1.push_back(static_cast<double>(i) - 10.0); }
+    for (const simpleContainers::SimdLevel level : allLevels) {
+        assert(nearly_equal(simpleContainers::window_sum(rb1, level), -10.0));
+        assert(nearly_equal(simpleContainers::window_min(rb1, level), -10.0));
+        assert(nearly_equal(simpleContainers::window_max(rb1, level), 9.0));
+        assert(nearly_equal(simpleContainers::window_mean(rb1, level), -0.5));
+    }
+}
+
+void test_ring_buffer_reductions_int64() {
+    std::cout << "================= TESTING RING BUFFER REDUCTIONS FOR INT64 =================" << std::endl;
+
+    std::mt19937_64 rng(54321);
+    std::uniform_int_distribution<std::int64_t> dist(-1000000000000LL, 1000000000000LL);
+
+    const std::size_t capacities[] = {1, 3, 4, 7, 8, 9, 16, 17, 63, 64, 65, 500};
+    for (const std::size_t capacity : capacities) {
+        const std::size_t wrapOffsets[] = {0, 1, capacity / 3, capacity - 1};
+        for (const std::size_t wrapOffset : wrapOffsets) {
+            const simpleContainers::RingBuffer<std::int64_t> rb = make_wrapped_ring_buffer<std::int64_t>(capacity, wrapOffset, [&]() { return dist(rng); });
+            const std::vector<std::int64_t> elems = rb.get_elements();
+
+            const std::int64_t expectedSum = std::accumulate(elems.begin(), elems.end(), std::int64_t{0});
+            const std::int64_t expectedMin = *std::min_element(elems.begin(), elems.end());
+            const std::int64_t expectedMax = *std::max_element(elems.begin(), elems.end());
+
+            // integer addition is associative, so every kernel must give exactly the scalar result
+            for (const simpleContainers::SimdLevel level : allLevels) {
+                assert(simpleContainers::window_sum(rb, level) == expectedSum);
+                assert(simpleContainers::window_min(rb, level) == expectedMin);
+                assert(simpleContainers::window_max(rb, level) == expectedMax);
+            }
+        }
+    }
+
+    // extremes of the type in the first and the second segment
+    simpleContainers::RingBuffer<std::int64_t> rb1(40);
+    for (std::int64_t i = 0; i < 50; ++i) { rb1.push_back(i); }
+    rb1[3] = INT64_MIN;
+    rb1[35] = INT64_MAX;
+    for (const simpleContainers::SimdLevel level : allLevels) {
+        assert(simpleContainers::window_min(rb1, level) == INT64_MIN);
+        assert(simpleContainers::window_max(rb1, level) == INT64_MAX);
+    }
+}
+
+void test_ring_buffer_reductions_other_types() {
+    std::cout << "================= TESTING RING BUFFER REDUCTIONS FOR OTHER TYPES =================" << std::endl;
+
+    // types without a vectorized kernel use the scalar one at every level
+    simpleContainers::RingBuffer<int> rb1(10);
+    for (int i = 1; i <= 15; ++i) { rb1.push_back(i * (i % 2 == 0 ? 1 : -1)); }
+    const std::vector<int> elems1 = rb1.get_elements();
+    for (const simpleContainers::SimdLevel level : allLevels) {
+        assert(simpleContainers::window_sum(rb1, level) == std::accumulate(elems1.begin(), elems1.end(), 0));
+        assert(simpleContainers::window_min(rb1, level) == -15);
+        assert(simpleContainers::window_max(rb1, level) == 14);
+    }
+
+    simpleContainers::RingBuffer<float, std::allocator<float>, simpleContainers::PowerOfTwoCapacity> rb2(5);
+    for (int i = 0; i < 11; ++i) { rb2.push_back(static_cast<float>(i) * 0.5f); }
+    assert(rb2.capacity() == 8);
+    assert(nearly_equal(static_cast<double>(simpleContainers::window_sum(rb2)), 26.0));
+    assert(nearly_equal(static_cast<double>(simpleContainers::window_min(rb2)), 1.5));
+    assert(nearly_equal(static_cast<double>(simpleContainers::window_max(rb2)), 5.0));
+    assert(nearly_equal(simpleContainers::window_mean(rb2), 3.25));
+
+    simpleContainers::RingBuffer<std::uint8_t> rb3(3);
+    rb3.push_back(200);
+    rb3.push_back(100);
+    // the sum does not fit in std::uint8_t, but the mean is still correct
+    assert(nearly_equal(simpleContainers::window_mean(rb3), 150.0));
+}
+
+void test_ring_buffer_reductions_dot() {
+    std::cout << "================= TESTING RING BUFFER REDUCTIONS DOT PRODUCT =================" << std::endl;
+
+    std::mt19937_64 rng(777);
+    std::uniform_real_distribution<double> dist(-10.0, 10.0);
+
+    // lhs and rhs wrap at different positions, so the products are computed over up to three chunks
+    const std::size_t capacities[] = {1, 5, 8, 13, 64, 257};
+    for (const std::size_t capacity : capacities) {
+        const simpleContainers::RingBuffer<double> lhs = make_wrapped_ring_buffer<double>(capacity, capacity / 3, [&]() { return dist(rng); });
+        const simpleContainers::RingBuffer<double> rhs = make_wrapped_ring_buffer<double>(capacity, capacity - 1, [&]() { return dist(rng); });
+        const std::vector<double> lhsElems = lhs.get_elements();
+        const std::vector<double> rhsElems = rhs.get_elements();
+        const double expected = std::inner_product(lhsElems.begin(), lhsElems.end(), rhsElems.begin(), 0.0);
+
+        for (const simpleContainers::SimdLevel level : allLevels) {
+            assert(nearly_equal(simpleContainers::window_dot(lhs, rhs, level), expected));
+        }
+    }
+
+    simpleContainers::RingBuffer<std::int64_t> lhs(4);
+    simpleContainers::RingBuffer<std::int64_t, std::allocator<std::int64_t>, simpleContainers::PowerOfTwoCapacity> rhs(4);
+    for (std::int64_t i = 0; i < 6; ++i) {
+        lhs.push_back(i);
+        rhs.push_back(i < 4 ? 0 : i);
+    }
+    rhs.push_back(1);
+    rhs.push_back(2);
+    // lhs is {2, 3, 4, 5}, rhs is {4, 5, 1, 2}
+    assert(simpleContainers::window_dot(lhs, rhs) == 2 * 4 + 3 * 5 + 4 * 1 + 5 * 2);
+
+    const simpleContainers::RingBuffer<double> empty1(3);
+    const simpleContainers::RingBuffer<double> empty2(7);
+    assert(nearly_equal(simpleContainers::window_dot(empty1, empty2), 0.0));
+}
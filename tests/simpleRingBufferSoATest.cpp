@@ -0,0 +1,263 @@
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "simpleContainers/simpleRingBuffer.hpp"
+#include "simpleContainers/simpleRingBufferSoA.hpp"
+
+void test_ring_buffer_soa_construction();
+void test_ring_buffer_soa_columns();
+void test_ring_buffer_soa_iterators();
+void test_ring_buffer_soa_randomized();
+
+int main() {
+    test_ring_buffer_soa_construction();
+    test_ring_buffer_soa_columns();
+    test_ring_buffer_soa_iterators();
+    test_ring_buffer_soa_randomized();
+    return 0;
+}
+
+namespace {
+    struct Record {
+        std::uint64_t timestamp;
+        std::int64_t price;
+        std::uint32_t qty;
+        std::uint8_t flags;
+    };
+
+    using RecordBuffer = simpleContainers::RingBufferSoA<std::uint64_t, std::int64_t, std::uint32_t, std::uint8_t>;
+
+    template <typename T>
+    std::vector<T> joined(const std::pair<simpleContainers::Segment<const T>, simpleContainers::Segment<const T>>& parts) {
+        std::vector<T> result(parts.first.begin(), parts.first.end());
+        result.insert(result.end(), parts.second.begin(), parts.second.end());
+        return result;
+    }
+
+    // every column of rb must match the same field of the records in expected, in the same order
+    void check_against_records(const RecordBuffer& rb, const simpleContainers::RingBuffer<Record>& expected) {
+        assert(rb.size() == expected.size());
+
+        const std::vector<std::uint64_t> timestamps = joined(rb.column<0>());
+        const std::vector<std::int64_t> prices = joined(rb.column<1>());
+        const std::vector<std::uint32_t> quantities = joined(rb.column<2>());
+        const std::vector<std::uint8_t> flags = joined(rb.column<3>());
+
+        for (std::size_t pos = 0; pos < expected.size(); ++pos) {
+            assert(timestamps[pos] == expected[pos].timestamp && prices[pos] == expected[pos].price);
+            assert(quantities[pos] == expected[pos].qty && flags[pos] == expected[pos].flags);
+            assert(rb.field<1>(pos) == expected[pos].price);
+            assert(std::get<2>(rb[pos]) == expected[pos].qty);
+        }
+    }
+} // namespace
+
+void test_ring_buffer_soa_construction() {
+    std::cout << "================= TESTING RING BUFFER SOA CONSTRUCTION =================" << std::endl;
+
+    simpleContainers::RingBufferSoA<int, double> rb1;
+    assert(rb1.capacity() == (simpleContainers::RingBufferSoA<int, double>::defaultInitialCapacity));
+    assert((simpleContainers::RingBufferSoA<int, double>::columnCount == 2));
+    assert(rb1.empty() && rb1.size() == 0 && !rb1.full() && rb1.begin() == rb1.end());
+
+    simpleContainers::RingBufferSoA<int, char> rb2(3);
+    rb2.push_back(1, 'a');
+    rb2.push_back(std::make_tuple(2, 'b'));
+    rb2.push_back(3, 'c');
+    assert(rb2.full() && rb2.size() == 3);
+    assert(rb2.front() == std::make_tuple(1, 'a') && rb2.back() == std::make_tuple(3, 'c'));
+    assert(std::get<1>(rb2[1]) == 'b' && std::get<0>(rb2.at(2)) == 3);
+
+    // overwriting moves every column together
+    rb2.push_back(4, 'd');
+    assert(rb2.size() == 3 && rb2.front() == std::make_tuple(2, 'b') && rb2.back() == std::make_tuple(4, 'd'));
+
+    // proxy references write through to the columns
+    std::get<0>(rb2.front()) = 20;
+    rb2[2] = std::make_tuple(40, 'D');
+    rb2.field<1>(1) = 'C';
+    assert(rb2[0] == std::make_tuple(20, 'b') && rb2[1] == std::make_tuple(3, 'C') && rb2[2] == std::make_tuple(40, 'D'));
+
+    bool thrown = false;
+    try {
+        rb2.at(3);
+    }
+    catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // copies are independent, assignment replaces capacity as well
+    simpleContainers::RingBufferSoA<int, char> rb2Cpy(rb2);
+    rb2.clear();
+    assert(rb2.empty() && rb2.capacity() == 3);
+    assert(rb2Cpy.size() == 3 && rb2Cpy.front() == std::make_tuple(20, 'b') && rb2Cpy.back() == std::make_tuple(40, 'D'));
+
+    simpleContainers::RingBufferSoA<int, char> rb3(10);
+    rb3 = rb2Cpy;
+    assert(rb3.capacity() == 3 && rb3.size() == 3 && rb3[1] == std::make_tuple(3, 'C'));
+
+    simpleContainers::RingBufferSoA<int, char> rb4(std::move(rb3));
+    assert(rb4.size() == 3 && rb3.empty() && rb3.capacity() == 0);
+    rb3 = std::move(rb4);
+    assert(rb3.size() == 3 && rb3.back() == std::make_tuple(40, 'D'));
+
+    rb3.swap(rb2);
+    assert(rb3.empty() && rb2.size() == 3);
+
+    rb2.pop_front();
+    assert(rb2.size() == 2 && rb2.front() == std::make_tuple(3, 'C'));
+    rb2.pop_front(2);
+    assert(rb2.empty());
+    rb2.push_back(5, 'e');
+    assert(rb2.size() == 1 && rb2.front() == rb2.back());
+
+    // single column buffer
+    simpleContainers::RingBufferSoA<double> rb5(2);
+    rb5.push_back(1.5);
+    rb5.push_back(std::make_tuple(2.5));
+    assert(std::get<0>(rb5.back()) > 2.0 && rb5.column<0>().first.size() == 2);
+}
+
+void test_ring_buffer_soa_columns() {
+    std::cout << "================= TESTING RING BUFFER SOA COLUMNS =================" << std::endl;
+
+    simpleContainers::RingBufferSoA<int, long long> rb1(5);
+    auto empty = rb1.column<0>();
+    assert(empty.first.empty() && empty.second.empty());
+
+    for (int i = 0; i < 3; ++i) {
+        rb1.push_back(i, i * 100LL);
+    }
+    // not wrapped: one contiguous view per column
+    auto linear = rb1.column<1>();
+    assert(linear.first.size() == 3 && linear.second.empty());
+    assert((joined<long long>(linear) == std::vector<long long>{0, 100, 200}));
+
+    for (int i = 3; i < 8; ++i) {
+        rb1.push_back(i, i * 100LL);
+    }
+    // elements 3..7 stored as {5, 6, 7, 3, 4}
+    const simpleContainers::RingBufferSoA<int, long long>& constRb1 = rb1;
+    const auto wrapped = constRb1.column<0>();
+    assert(wrapped.first.size() == 2 && wrapped.second.size() == 3);
+    assert((joined(wrapped) == std::vector<int>{3, 4, 5, 6, 7}));
+
+    // both columns wrap at the same position
+    const auto wrappedPrices = constRb1.column<1>();
+    assert(wrappedPrices.first.size() == wrapped.first.size() && wrappedPrices.second.size() == wrapped.second.size());
+    assert((joined(wrappedPrices) == std::vector<long long>{300, 400, 500, 600, 700}));
+
+    long long sum = 0;
+    for (const long long price : wrappedPrices.first) { sum += price; }
+    for (const long long price : wrappedPrices.second) { sum += price; }
+    assert(sum == 2500);
+
+    // mutable columns
+    auto mutableColumn = rb1.column<0>();
+    for (int& value : mutableColumn.first) { value = -value; }
+    for (int& value : mutableColumn.second) { value = -value; }
+    assert(rb1.front() == std::make_tuple(-3, 300LL) && rb1.back() == std::make_tuple(-7, 700LL));
+
+    // O(1) removal from the front keeps views consistent
+    rb1.pop_front(3);
+    const auto afterPop = constRb1.column<0>();
+    assert(afterPop.first.size() == 2 && afterPop.second.empty());
+    assert((joined(afterPop) == std::vector<int>{-6, -7}));
+}
+
+void test_ring_buffer_soa_iterators() {
+    std::cout << "================= TESTING RING BUFFER SOA ITERATORS =================" << std::endl;
+
+    static_assert((std::is_same<std::iterator_traits<simpleContainers::RingBufferSoA<int, char>::iterator>::iterator_category, std::random_access_iterator_tag>::value), "");
+    static_assert((std::is_same<simpleContainers::RingBufferSoA<int, char>::iterator::reference, std::tuple<int&, char&>>::value), "");
+    static_assert((std::is_same<simpleContainers::RingBufferSoA<int, char>::const_iterator::reference, std::tuple<const int&, const char&>>::value), "");
+
+    simpleContainers::RingBufferSoA<int, char> rb1(4);
+    for (int i = 0; i < 6; ++i) {
+        rb1.push_back(i, static_cast<char>('a' + i));
+    }
+
+    // range-for over proxy references
+    std::vector<int> seen;
+    for (auto&& record : rb1) {
+        seen.push_back(std::get<0>(record));
+        std::get<1>(record) = static_cast<char>(std::get<1>(record) - 'a' + 'A');
+    }
+    assert((seen == std::vector<int>{2, 3, 4, 5}));
+
+    const simpleContainers::RingBufferSoA<int, char>& constRb1 = rb1;
+    std::vector<char> letters;
+    for (const auto& record : constRb1) {
+        letters.push_back(std::get<1>(record));
+    }
+    assert((letters == std::vector<char>{'C', 'D', 'E', 'F'}));
+
+    // random access
+    auto it = rb1.begin();
+    assert(rb1.end() - it == 4 && std::distance(rb1.cbegin(), rb1.cend()) == 4);
+    assert(std::get<0>(it[3]) == 5 && std::get<0>(*(it + 2)) == 4 && std::get<0>(*(2 + it)) == 4);
+    it += 3;
+    assert(std::get<0>(*it) == 5 && std::get<0>(*(it - 1)) == 4);
+    --it;
+    it--;
+    ++it;
+    it++;
+    it -= 1;
+    assert(std::get<0>(*it) == 4 && it > rb1.begin() && it >= rb1.begin() && it < rb1.end() && it <= rb1.end() && it != rb1.end());
+
+    simpleContainers::RingBufferSoA<int, char>::const_iterator cit = it;
+    assert(std::get<1>(*cit) == 'E');
+
+    // standard algorithms work through the proxy
+    const auto found = std::find_if(rb1.cbegin(), rb1.cend(), [](simpleContainers::RingBufferSoA<int, char>::const_reference record) {
+        return std::get<1>(record) == 'D';
+    });
+    assert(found - rb1.cbegin() == 1);
+    assert(std::count_if(rb1.begin(), rb1.end(), [](simpleContainers::RingBufferSoA<int, char>::reference record) { return std::get<0>(record) % 2 == 0; }) == 2);
+}
+
+void test_ring_buffer_soa_randomized() {
+    std::cout << "================= TESTING RING BUFFER SOA AGAINST ARRAY OF STRUCTURES =================" << std::endl;
+
+    std::mt19937_64 rng(2022);
+    std::uniform_int_distribution<int> actionDist(0, 9);
+    std::uniform_int_distribution<std::int64_t> priceDist(-1000000, 1000000);
+
+    RecordBuffer rb1(37);
+    simpleContainers::RingBuffer<Record> expected(37);
+    for (std::uint64_t i = 0; i < 20000; ++i) {
+        const int action = actionDist(rng);
+        if (action == 0 && !rb1.empty()) {
+            rb1.pop_front();
+            expected.pop_front();
+        }
+        else if (action == 1) {
+            const std::size_t n = std::min<std::size_t>(rb1.size(), i % 5);
+            rb1.pop_front(n);
+            expected.pop_front(n);
+        }
+        else {
+            const Record record{i, priceDist(rng), static_cast<std::uint32_t>(i * 7), static_cast<std::uint8_t>(i)};
+            rb1.push_back(record.timestamp, record.price, record.qty, record.flags);
+            expected.push_back(record);
+        }
+
+        if (i % 11 == 0) {
+            check_against_records(rb1, expected);
+        }
+    }
+
+    RecordBuffer rb1Cpy(rb1);
+    check_against_records(rb1Cpy, expected);
+}
@@ -1,11 +1,18 @@
 #include <algorithm>
 #include <cassert>
+#include <deque>
 #include <exception>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <list>
 #include <numeric>
 #include <random>
 #include <set>
+#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 #include "simpleContainers/simpleRingBuffer.hpp"
@@ -13,21 +20,62 @@
 #include "someTestClass.hpp"
 #include "someTemplateTestClass.hpp"
 #include "someAllocatorClass.hpp"
+#include "someCountingAllocatorClass.hpp"
+#include "someTaggedAllocatorClass.hpp"
+
+// can only be constructed, never assigned, and counts how many times that happens
+struct NonAssignableClass {
+    static int constructionCount;
+
+    NonAssignableClass(const int id, std::string name) : mId{id}, mName{new std::string{std::move(name)}} { ++constructionCount; }
+    NonAssignableClass(NonAssignableClass&& other) noexcept : mId{other.mId}, mName{std::move(other.mName)} { ++constructionCount; }
+    NonAssignableClass& operator=(const NonAssignableClass&) = delete;
+    NonAssignableClass& operator=(NonAssignableClass&&) = delete;
+
+    const int mId;
+    std::unique_ptr<std::string> mName;
+};
+
+int NonAssignableClass::constructionCount = 0;
+
+// element that owns heap memory, all of which is allocated through SomeCountingAllocatorClass
+struct HistoryEntry {
+    HistoryEntry() : mName{}, mValues{} {}
+
+    std::basic_string<char, std::char_traits<char>, SomeCountingAllocatorClass<char>> mName;
+    std::vector<int, SomeCountingAllocatorClass<int>> mValues;
+};
 
 void test_ring_buffer_construction();
 void test_ring_buffer_member_functions();
 void test_ring_buffer_insertion();
+void test_ring_buffer_capacity_policies();
+void test_ring_buffer_overflow_policies();
+void test_ring_buffer_bulk_insertion();
+void test_ring_buffer_segments();
+void test_ring_buffer_linearize();
+void test_ring_buffer_pop_and_erase();
+void test_ring_buffer_recycling();
 void test_ring_buffer_iterators();
 void test_ring_buffer_in_stl_containers();
 void test_ring_buffer_in_stl_algorithms();
+void test_ring_buffer_segment_algorithms();
 
 int main() {
     test_ring_buffer_construction();
     test_ring_buffer_member_functions();
     test_ring_buffer_insertion();
+    test_ring_buffer_capacity_policies();
+    test_ring_buffer_overflow_policies();
+    test_ring_buffer_bulk_insertion();
+    test_ring_buffer_segments();
+    test_ring_buffer_linearize();
+    test_ring_buffer_pop_and_erase();
+    test_ring_buffer_recycling();
     test_ring_buffer_iterators();
     test_ring_buffer_in_stl_containers();
     test_ring_buffer_in_stl_algorithms();
+    test_ring_buffer_segment_algorithms();
     return 0;
 }
 
@@ -95,6 +143,48 @@ void test_ring_buffer_construction() {
     rb5 = std::move(rb4); // move assignment
     assert(rb5.capacity() == tmpRb1InitialCapacity);
     assert(rb5.size() == 0);
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    // allocators only move between RingBuffers when they propagate on the operation
+    {
+        using PropagatingRingBuffer = simpleContainers::RingBuffer<std::string, TaggedAllocator<std::string, true>>;
+        using TaggedAlloc = TaggedAllocator<std::string, true>;
+        PropagatingRingBuffer rbA(3, TaggedAlloc{1});
+        PropagatingRingBuffer rbB(3, TaggedAlloc{2});
+        rbB.push_back("b");
+
+        rbA = rbB;
+        assert(rbA.get_allocator().mId == 2 && rbA.size() == 1 && rbA[0] == "b");
+        rbA = PropagatingRingBuffer(4, TaggedAlloc{3});
+        assert(rbA.get_allocator().mId == 3 && rbA.capacity() == 4 && rbA.empty());
+        rbA.swap(rbB);
+        assert(rbA.get_allocator().mId == 2 && rbB.get_allocator().mId == 3 && rbA[0] == "b");
+    }
+    {
+        using NonPropagatingRingBuffer = simpleContainers::RingBuffer<std::string, TaggedAllocator<std::string, false>>;
+        using TaggedAlloc = TaggedAllocator<std::string, false>;
+        NonPropagatingRingBuffer rbA(3, TaggedAlloc{11});
+        NonPropagatingRingBuffer rbB(3, TaggedAlloc{12});
+        rbB.push_back("b");
+
+        rbA = rbB;
+        assert(rbA.get_allocator().mId == 11 && rbA.size() == 1 && rbA[0] == "b");
+        NonPropagatingRingBuffer rbC(2, TaggedAlloc{13});
+        rbC.push_back("c1");
+        rbC.push_back("c2");
+        rbA = std::move(rbC); // unequal allocators, elements are moved into storage from rbA's allocator
+        assert(rbA.get_allocator().mId == 11 && rbA.capacity() == 2 && rbA[0] == "c1" && rbA[1] == "c2");
+        NonPropagatingRingBuffer rbD(5, TaggedAlloc{11});
+        rbD.push_back("d");
+        rbA = std::move(rbD); // equal allocators, storage is taken over
+        assert(rbA.get_allocator().mId == 11 && rbA.capacity() == 5 && rbA[0] == "d");
+        NonPropagatingRingBuffer rbE(1, TaggedAlloc{11});
+        rbA.swap(rbE);
+        assert(rbA.capacity() == 1 && rbE.capacity() == 5 && rbE[0] == "d");
+    }
+    for (const auto& idAndCount : TaggedAllocator<std::string, true>::live_blocks()) { assert(idAndCount.second == 0); }
+    for (const auto& idAndCount : TaggedAllocator<std::string, false>::live_blocks()) { assert(idAndCount.second == 0); }
 }
 
 void test_ring_buffer_member_functions() {
@@ -189,6 +279,45 @@ void test_ring_buffer_member_functions() {
     assert(rbResize.get_elements() == rbResizeExpectedResult);
     assert(rbResize.full());
 
+    // shrinking a buffer that is not full keeps its newest elements
+    simpleContainers::RingBuffer<int> rbResizeNotFull(10);
+    for (int i = 0; i < 6; ++i) { rbResizeNotFull.emplace_back(i); }
+    rbResizeNotFull.change_capacity(4);
+    rbResizeExpectedResult = {2, 3, 4, 5};
+    assert(rbResizeNotFull.get_elements() == rbResizeExpectedResult && rbResizeNotFull.full());
+    rbResizeNotFull.change_capacity(8); // shrinking to a capacity above the size keeps everything
+    rbResizeNotFull.change_capacity(6);
+    assert(rbResizeNotFull.get_elements() == rbResizeExpectedResult && rbResizeNotFull.capacity() == 6);
+
+    // shrinking keeps the memory of the internal vector, so growing back within it does not reallocate
+    simpleContainers::RingBuffer<int> rbResizeInPlace(100);
+    for (int i = 0; i < 150; ++i) { rbResizeInPlace.emplace_back(i); } // wraps around
+    const int* dataBeforeResizing = rbResizeInPlace.data();
+    rbResizeInPlace.change_capacity(60);
+    assert(rbResizeInPlace.data() == dataBeforeResizing && rbResizeInPlace.is_linearized());
+    assert(rbResizeInPlace.size() == 60 && rbResizeInPlace[0] == 90 && rbResizeInPlace[59] == 149);
+    for (int i = 150; i < 175; ++i) { rbResizeInPlace.emplace_back(i); } // wraps around again
+    rbResizeInPlace.change_capacity(100);
+    assert(rbResizeInPlace.data() == dataBeforeResizing && rbResizeInPlace.is_linearized());
+    assert(rbResizeInPlace.size() == 60 && rbResizeInPlace[0] == 115 && rbResizeInPlace[59] == 174);
+    for (int i = 175; i < 215; ++i) { rbResizeInPlace.emplace_back(i); }
+    assert(rbResizeInPlace.full() && rbResizeInPlace[0] == 115 && rbResizeInPlace[99] == 214);
+
+    rbResizeInPlace.change_capacity(20);
+    rbResizeInPlace.shrink_to_fit(); // moves elements to a smaller allocation
+    for (int i = 215; i < 225; ++i) { rbResizeInPlace.emplace_back(i); }
+    rbResizeExpectedResult = {205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224};
+    assert(rbResizeInPlace.get_elements() == rbResizeExpectedResult);
+
+    // move only types can be resized, elements are moved and not copied
+    simpleContainers::RingBuffer<std::unique_ptr<int>> rbResizeMoveOnly(3);
+    for (int i = 0; i < 5; ++i) { rbResizeMoveOnly.push_back(std::unique_ptr<int>(new int{i})); }
+    rbResizeMoveOnly.change_capacity(6);
+    assert(rbResizeMoveOnly.size() == 3 && *rbResizeMoveOnly[0] == 2 && *rbResizeMoveOnly[2] == 4);
+    rbResizeMoveOnly.push_back(std::unique_ptr<int>(new int{5}));
+    rbResizeMoveOnly.change_capacity(2);
+    assert(rbResizeMoveOnly.size() == 2 && *rbResizeMoveOnly[0] == 4 && *rbResizeMoveOnly[1] == 5);
+
     std::cout << "------------------------------------------------------" << std::endl;
 
     // test erasure when ring buffer is not full
@@ -426,6 +555,598 @@ void test_ring_buffer_insertion() {
     assert(rbCmp1 == rbCmp2);
     assert(rbCmp2 == rbCmp3);
     assert(rbCmp1 == rbCmp3);
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    // overwriting destroys the oldest element and move constructs the new one into its slot, nothing is assigned
+    simpleContainers::RingBuffer<NonAssignableClass> rb6(3);
+    NonAssignableClass::constructionCount = 0;
+    for (int i = 0; i < 10; ++i) {
+        rb6.emplace_back(i, std::to_string(i));
+    }
+    // 3 elements constructed in place, 7 overwrites built as a temporary and moved
+    assert(NonAssignableClass::constructionCount == 3 + 2 * 7);
+    assert(rb6.full() && rb6[0].mId == 7 && rb6[2].mId == 9 && *rb6[1].mName == "8");
+
+    rb6.push_back(NonAssignableClass{10, "10"}); // move-only
+    assert(rb6[0].mId == 8 && rb6[2].mId == 10 && *rb6[2].mName == "10");
+
+    rb6.push_back(std::move(rb6[0])); // oldest element becomes the newest one
+    assert(rb6[0].mId == 9 && rb6[2].mId == 8 && *rb6[2].mName == "8");
+
+    simpleContainers::RingBuffer<std::string> rb7(3);
+    rb7.push_back("a");
+    rb7.push_back("b");
+    rb7.push_back("c");
+    rb7.push_back(rb7[0]); // copy of the element that is being overwritten
+    rb7.push_back(rb7[1]);
+    const std::vector<std::string> expectedStrings = {"c", "a", "c"};
+    assert(rb7.get_elements() == expectedStrings);
+
+    // arguments of emplace_back may refer to the element that is being overwritten,
+    // strings are long enough to own heap memory that is released when the element is destroyed
+    const std::string longA(40, 'a');
+    const std::string longB(40, 'b');
+    simpleContainers::RingBuffer<std::string> rb8(2);
+    rb8.push_back(longA);
+    rb8.push_back(longB);
+    rb8.emplace_back(rb8.front());
+    rb8.emplace_back(rb8.front().c_str());
+    rb8.emplace_back(rb8.front(), std::size_t{0}, std::size_t{20});
+    const std::vector<std::string> expectedEmplacedStrings = {longB, longA.substr(0, 20)};
+    assert(rb8.get_elements() == expectedEmplacedStrings);
+}
+
+void test_ring_buffer_capacity_policies() {
+    std::cout << "================= TESTING RING BUFFER CAPACITY POLICIES =================" << std::endl;
+
+    using Pow2RingBuffer = simpleContainers::RingBuffer<int, std::allocator<int>, simpleContainers::PowerOfTwoCapacity>;
+
+    Pow2RingBuffer rb1; // default capacity is already a power of two
+    assert(rb1.capacity() == Pow2RingBuffer::defaultInitialCapacity);
+
+    Pow2RingBuffer rb2(5); // capacity is rounded up to the next power of two
+    assert(rb2.capacity() == 8 && rb2.empty());
+
+    Pow2RingBuffer rb3(1);
+    assert(rb3.capacity() == 1);
+
+    Pow2RingBuffer rb4{1, 2, 3}; // initializer list leaves the rounded up slots free
+    assert(rb4.capacity() == 4 && rb4.size() == 3 && !rb4.full());
+    rb4.push_back(4);
+    rb4.push_back(5);
+    std::vector<int> expectedResult = {2, 3, 4, 5};
+    assert(rb4.get_elements() == expectedResult);
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    // wrap around many times and compare against the default exact capacity buffer with the same capacity
+    simpleContainers::RingBuffer<int> rbExact(8);
+    for (int i = 0; i < 100; ++i) {
+        rb2.push_back(i);
+        rbExact.push_back(i);
+
+        assert(rb2.size() == rbExact.size());
+        for (std::size_t j = 0; j < rb2.size(); ++j) {
+            assert(rb2[j] == rbExact[j] && rb2.at(j) == rbExact.at(j));
+        }
+        assert(rb2.get_elements() == rbExact.get_elements());
+        assert(std::equal(rb2.begin(), rb2.end(), rbExact.begin()));
+    }
+    assert(rb2[0] == 92 && rb2[rb2.size() - 1] == 99);
+
+    bool thrown = false;
+    try {
+        rb2.at(rb2.size());
+    }
+    catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    rb2.change_capacity(3); // rounded up to 4, last 4 elements are kept
+    assert(rb2.capacity() == 4 && rb2.size() == 4);
+    expectedResult = {96, 97, 98, 99};
+    assert(rb2.get_elements() == expectedResult);
+
+    rb2.change_capacity(9); // rounded up to 16
+    assert(rb2.capacity() == 16 && rb2.size() == 4);
+    for (int i = 100; i < 120; ++i) { rb2.push_back(i); }
+    assert(rb2.full() && rb2[0] == 104 && rb2[rb2.size() - 1] == 119);
+
+    // exact capacity keeps the requested value
+    simpleContainers::RingBuffer<int> rbExact2(5);
+    assert(rbExact2.capacity() == 5);
+    rbExact2.change_capacity(9);
+    assert(rbExact2.capacity() == 9);
+}
+
+void test_ring_buffer_overflow_policies() {
+    std::cout << "================= TESTING RING BUFFER OVERFLOW POLICIES =================" << std::endl;
+
+    // try_ functions never overwrite, even with the default policy
+    simpleContainers::RingBuffer<int> rb1(3);
+    bool inserted = rb1.try_push_back(1);
+    inserted = rb1.try_emplace_back(2) && inserted;
+    assert(inserted);
+    const int three = 3;
+    inserted = rb1.try_push_back(three);
+    assert(inserted && rb1.full());
+    inserted = rb1.try_push_back(4);
+    assert(!inserted);
+    inserted = rb1.try_emplace_back(5);
+    assert(!inserted);
+    std::vector<int> expectedResult = {1, 2, 3};
+    assert(rb1.get_elements() == expectedResult);
+    rb1.push_back(4); // still overwrites
+    expectedResult = {2, 3, 4};
+    assert(rb1.get_elements() == expectedResult);
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    using RejectingRingBuffer = simpleContainers::RingBuffer<std::string, std::allocator<std::string>, simpleContainers::ExactCapacity, simpleContainers::RejectNew>;
+    RejectingRingBuffer rb2(3);
+    for (int i = 0; i < 5; ++i) { rb2.push_back(std::to_string(i)); }
+    std::vector<std::string> expectedStrings = {"0", "1", "2"};
+    assert(rb2.full() && rb2.get_elements() == expectedStrings);
+
+    std::string rejected = "rejected";
+    rb2.push_back(std::move(rejected));
+    inserted = rb2.try_push_back(std::move(rejected));
+    assert(!inserted && rejected == "rejected"); // not moved from when rejected
+    rb2.emplace_back("emplaced");
+    assert(rb2.get_elements() == expectedStrings);
+
+    rb2.pop_front();
+    rb2.emplace_back("3");
+    expectedStrings = {"1", "2", "3"};
+    assert(rb2.get_elements() == expectedStrings);
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    // construction is skipped entirely for rejected elements
+    using RejectingNonAssignable = simpleContainers::RingBuffer<NonAssignableClass, std::allocator<NonAssignableClass>, simpleContainers::PowerOfTwoCapacity, simpleContainers::RejectNew>;
+    RejectingNonAssignable rb3(2);
+    NonAssignableClass::constructionCount = 0;
+    for (int i = 0; i < 10; ++i) { rb3.emplace_back(i, "x"); }
+    assert(NonAssignableClass::constructionCount == 2 && rb3[1].mId == 1);
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    using CountingRingBuffer = simpleContainers::RingBuffer<int, std::allocator<int>, simpleContainers::PowerOfTwoCapacity, simpleContainers::CountRejectedNew>;
+    CountingRingBuffer rb4(4);
+    for (int i = 0; i < 6; ++i) { rb4.push_back(i); }
+    assert(rb4.overflow_policy().rejected_count() == 2);
+    inserted = rb4.try_emplace_back(6);
+    assert(!inserted);
+    assert(rb4.overflow_policy().rejected_count() == 3);
+
+    rb4.pop_front();
+    rb4.pop_front();
+    const std::vector<int> batch = {10, 11, 12, 13, 14};
+    rb4.append(batch.data(), batch.size()); // two fit, three are rejected
+    expectedResult = {2, 3, 10, 11};
+    assert(rb4.get_elements() == expectedResult);
+    assert(rb4.overflow_policy().rejected_count() == 6);
+
+    std::list<int> batchList = {15, 16};
+    rb4.push_back(batchList.begin(), batchList.end());
+    std::istringstream iss{"17 18 19"};
+    rb4.push_back(std::istream_iterator<int>{iss}, std::istream_iterator<int>{});
+    assert(rb4.get_elements() == expectedResult && rb4.overflow_policy().rejected_count() == 11);
+
+    CountingRingBuffer rb4Cpy{rb4}; // counter is copied with the elements
+    assert(rb4Cpy.overflow_policy().rejected_count() == 11);
+    rb4.overflow_policy().reset_rejected_count();
+    assert(rb4.overflow_policy().rejected_count() == 0 && rb4Cpy.overflow_policy().rejected_count() == 11);
+}
+
+void test_ring_buffer_bulk_insertion() {
+    std::cout << "================= TESTING RING BUFFER BULK INSERTION =================" << std::endl;
+
+    simpleContainers::RingBuffer<int> rb1(5);
+    std::vector<int> input = {0, 1, 2};
+    rb1.push_back(input.begin(), input.end()); // fits without overwriting
+    std::vector<int> expectedResult = {0, 1, 2};
+    assert(rb1.get_elements() == expectedResult);
+
+    input = {3, 4, 5, 6};
+    rb1.push_back(input.begin(), input.end()); // fills the buffer and overwrites the two oldest elements
+    expectedResult = {2, 3, 4, 5, 6};
+    assert(rb1.full() && rb1.get_elements() == expectedResult);
+
+    input = {7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18};
+    rb1.append(input.data(), input.size()); // only the last capacity() elements are kept
+    expectedResult = {14, 15, 16, 17, 18};
+    assert(rb1.get_elements() == expectedResult);
+
+    rb1.append(input.data(), 0);
+    assert(rb1.get_elements() == expectedResult);
+
+    // the source may overlap the storage that is being overwritten
+    simpleContainers::RingBuffer<int> rbOverlap(8);
+    for (int i = 0; i < 8; ++i) { rbOverlap.push_back(i); }
+    rbOverlap.append(&rbOverlap[1], 4);
+    expectedResult = {4, 5, 6, 7, 1, 2, 3, 4};
+    assert(rbOverlap.get_elements() == expectedResult);
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    // compare against one push_back per element for every batch size and starting position, with both capacity policies
+    std::mt19937 rng{42};
+    std::uniform_int_distribution<int> dist(0, 1000);
+    for (std::size_t batchSize = 0; batchSize < 20; ++batchSize) {
+        simpleContainers::RingBuffer<int> rbBulk(7);
+        simpleContainers::RingBuffer<int> rbSingle(7);
+        simpleContainers::RingBuffer<int, std::allocator<int>, simpleContainers::PowerOfTwoCapacity> rbBulkPow2(7);
+        simpleContainers::RingBuffer<int, std::allocator<int>, simpleContainers::PowerOfTwoCapacity> rbSinglePow2(7);
+
+        for (int round = 0; round < 10; ++round) {
+            std::vector<int> batch(batchSize);
+            for (auto& elem : batch) { elem = dist(rng); }
+
+            rbBulk.push_back(batch.begin(), batch.end());
+            rbBulkPow2.append(batch.data(), batch.size());
+            for (const auto elem : batch) {
+                rbSingle.push_back(elem);
+                rbSinglePow2.push_back(elem);
+            }
+
+            assert(rbBulk == rbSingle);
+            assert(rbBulkPow2 == rbSinglePow2);
+            // one single element insertion between batches moves the starting position
+            rbBulk.push_back(round);
+            rbSingle.push_back(round);
+            rbBulkPow2.push_back(round);
+            rbSinglePow2.push_back(round);
+        }
+    }
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    // types that are not trivially copyable and iterators that are not pointers
+    simpleContainers::RingBuffer<std::string> rb2(3);
+    std::list<std::string> strList = {"a", "b", "c", "d"};
+    rb2.push_back(strList.begin(), strList.end());
+    std::vector<std::string> expectedStrings = {"b", "c", "d"};
+    assert(rb2.get_elements() == expectedStrings);
+
+    const std::string strArr[] = {"e", "f"};
+    rb2.append(strArr, 2);
+    expectedStrings = {"d", "e", "f"};
+    assert(rb2.get_elements() == expectedStrings);
+
+    // input iterators
+    simpleContainers::RingBuffer<int> rb3(4);
+    std::istringstream iss{"1 2 3 4 5 6"};
+    rb3.push_back(std::istream_iterator<int>{iss}, std::istream_iterator<int>{});
+    expectedResult = {3, 4, 5, 6};
+    assert(rb3.get_elements() == expectedResult);
+}
+
+void test_ring_buffer_segments() {
+    std::cout << "================= TESTING RING BUFFER SEGMENTS =================" << std::endl;
+
+    simpleContainers::RingBuffer<int> rb1(5);
+    assert(rb1.array_one().empty() && rb1.array_two().empty());
+
+    for (int i = 0; i < 3; ++i) { rb1.push_back(i); }
+    // not wrapped around yet, all elements are in the first segment
+    assert(rb1.array_one().size() == 3 && rb1.array_two().empty());
+    assert(rb1.array_one()[0] == 0 && rb1.array_one()[2] == 2);
+
+    for (int i = 3; i < 7; ++i) { rb1.push_back(i); }
+    // true order in the container is {5, 6, 2, 3, 4}
+    simpleContainers::Segment<int> first = rb1.array_one();
+    simpleContainers::Segment<int> second = rb1.array_two();
+    assert(first.size() == 3 && second.size() == 2);
+    assert(first[0] == 2 && first[1] == 3 && first[2] == 4);
+    assert(second[0] == 5 && second[1] == 6);
+
+    // segments point into the container, no copies are made
+    assert(first.data() == &rb1[0] && second.data() == &rb1[3]);
+    first[0] = 20;
+    assert(rb1[0] == 20);
+
+    std::vector<int> joined(first.begin(), first.end());
+    joined.insert(joined.end(), second.begin(), second.end());
+    assert(joined == rb1.get_elements());
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    const simpleContainers::RingBuffer<int>& rbConstRef = rb1;
+    const std::pair<simpleContainers::Segment<const int>, simpleContainers::Segment<const int>> segs = rbConstRef.segments();
+    assert(segs.first.data() == first.data() && segs.first.size() == first.size());
+    assert(segs.second.data() == second.data() && segs.second.size() == second.size());
+
+    simpleContainers::Segment<const int> constView = first; // views of T convert to views of const T
+    assert(constView.data() == first.data() && constView.size() == first.size());
+
+    // after every insertion the two segments hold the elements in insertion order
+    simpleContainers::RingBuffer<std::string, std::allocator<std::string>, simpleContainers::PowerOfTwoCapacity> rb2(6);
+    for (int i = 0; i < 30; ++i) {
+        rb2.push_back(std::to_string(i));
+
+        const auto parts = rb2.segments();
+        assert(parts.first.size() + parts.second.size() == rb2.size());
+        assert(!parts.first.empty());
+        assert(std::equal(parts.first.begin(), parts.first.end(), rb2.begin()));
+        assert(std::equal(parts.second.begin(), parts.second.end(), rb2.begin() + static_cast<std::ptrdiff_t>(parts.first.size())));
+    }
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    // views of a subrange are split at the end of the storage only if the subrange wraps around
+    for (std::size_t pos = 0; pos <= rb2.size(); ++pos) {
+        for (std::size_t count = 0; pos + count <= rb2.size(); ++count) {
+            const auto parts = rb2.segments(pos, count);
+            assert(parts.first.size() + parts.second.size() == count);
+            assert(parts.second.empty() || parts.second.data() == rb2.array_two().data());
+            assert(std::equal(parts.first.begin(), parts.first.end(), rb2.begin() + static_cast<std::ptrdiff_t>(pos)));
+            assert(std::equal(parts.second.begin(), parts.second.end(), rb2.begin() + static_cast<std::ptrdiff_t>(pos + parts.first.size())));
+        }
+    }
+    assert(rbConstRef.segments(0, rbConstRef.size()).first.data() == first.data());
+}
+
+void test_ring_buffer_linearize() {
+    std::cout << "================= TESTING RING BUFFER LINEARIZE =================" << std::endl;
+
+    simpleContainers::RingBuffer<int> rb1(5);
+    assert(rb1.is_linearized());
+
+    for (int i = 0; i < 5; ++i) { rb1.push_back(i); }
+    assert(rb1.is_linearized()); // full, but the oldest element is still at the start of the storage
+    const int* dataBefore = rb1.data();
+    int* ptr = rb1.linearize();
+    assert(ptr == dataBefore);
+
+    rb1.push_back(5);
+    rb1.push_back(6);
+    assert(!rb1.is_linearized());
+    assert(rb1.array_two().size() == 2);
+
+    ptr = rb1.linearize();
+    assert(rb1.is_linearized() && ptr == rb1.data() && ptr == dataBefore); // rotated in place, no reallocation
+    std::vector<int> expectedResult = {2, 3, 4, 5, 6};
+    assert(std::vector<int>(ptr, ptr + rb1.size()) == expectedResult);
+    assert(rb1.get_elements() == expectedResult);
+    assert(rb1.array_one().size() == 5 && rb1.array_two().empty());
+
+    // insertion continues from the correct position
+    rb1.push_back(7);
+    expectedResult = {3, 4, 5, 6, 7};
+    assert(rb1.get_elements() == expectedResult && !rb1.is_linearized());
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    simpleContainers::RingBuffer<std::string, std::allocator<std::string>, simpleContainers::PowerOfTwoCapacity> rb2(4);
+    for (int i = 0; i < 11; ++i) {
+        rb2.push_back(std::to_string(i));
+        const std::vector<std::string> expectedStrings = rb2.get_elements();
+        const std::string* strPtr = rb2.linearize();
+        assert(std::equal(expectedStrings.begin(), expectedStrings.end(), strPtr));
+        assert(rb2.get_elements() == expectedStrings);
+    }
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    // not full, wrapped around, with unused slots between the two segments
+    simpleContainers::RingBuffer<std::string> rb3(6);
+    for (int i = 0; i < 8; ++i) { rb3.push_back(std::to_string(i)); }
+    rb3.pop_front();
+    rb3.pop_back(); // storage is {"6", -, "3", "4", "5", -}
+    assert(!rb3.is_linearized() && rb3.array_one().size() == 3 && rb3.array_two().size() == 1);
+    const std::vector<std::string> expectedStrings = {"3", "4", "5", "6"};
+    const std::string* strPtr = rb3.linearize();
+    assert(rb3.is_linearized() && std::equal(expectedStrings.begin(), expectedStrings.end(), strPtr));
+    rb3.push_back("7");
+    rb3.push_back("8");
+    rb3.push_back("9");
+    const std::vector<std::string> expectedAfterPush = {"4", "5", "6", "7", "8", "9"};
+    assert(rb3.full() && rb3.get_elements() == expectedAfterPush);
+}
+
+void test_ring_buffer_pop_and_erase() {
+    std::cout << "================= TESTING RING BUFFER POP AND ERASE =================" << std::endl;
+
+    simpleContainers::RingBuffer<int> rb1(4);
+    for (int i = 0; i < 6; ++i) { rb1.push_back(i); } // {2, 3, 4, 5}
+    rb1.pop_front();
+    std::vector<int> expectedResult = {3, 4, 5};
+    assert(rb1.size() == 3 && rb1.get_elements() == expectedResult);
+    rb1.pop_back();
+    expectedResult = {3, 4};
+    assert(rb1.size() == 2 && rb1.get_elements() == expectedResult);
+
+    rb1.push_back(6);
+    rb1.push_back(7); // full again, no element is overwritten
+    expectedResult = {3, 4, 6, 7};
+    assert(rb1.full() && rb1.get_elements() == expectedResult);
+    rb1.push_back(8);
+    expectedResult = {4, 6, 7, 8};
+    assert(rb1.get_elements() == expectedResult);
+
+    while (!rb1.empty()) { rb1.pop_front(); }
+    rb1.push_back(9);
+    assert(rb1.size() == 1 && rb1[0] == 9);
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    // used as a bounded FIFO queue
+    simpleContainers::RingBuffer<std::string> rbQueue(5);
+    for (int i = 0; i < 7; ++i) { rbQueue.push_back(std::to_string(i)); } // {2, 3, 4, 5, 6}, wrapped around
+    assert(rbQueue.front() == "2" && rbQueue.back() == "6");
+    rbQueue.front() = "two";
+    rbQueue.back() = "six";
+    const simpleContainers::RingBuffer<std::string>& rbQueueConstRef = rbQueue;
+    assert(rbQueueConstRef.front() == "two" && rbQueueConstRef.back() == "six");
+
+    std::vector<std::string> drained;
+    std::size_t popped = rbQueue.pop_n(std::back_inserter(drained), 4); // crosses the end of the storage
+    std::vector<std::string> expectedStrings = {"two", "3", "4", "5"};
+    assert(popped == 4 && drained == expectedStrings);
+    assert(rbQueue.size() == 1 && rbQueue.front() == "six" && rbQueue.back() == "six");
+
+    for (int i = 7; i < 10; ++i) { rbQueue.push_back(std::to_string(i)); }
+    std::string drainedArr[10];
+    popped = rbQueue.pop_n(drainedArr, 10); // asking for more than there is
+    assert(popped == 4 && drainedArr[0] == "six" && drainedArr[3] == "9" && rbQueue.empty());
+    popped = rbQueue.pop_n(drainedArr, 3);
+    assert(popped == 0);
+
+    // producer and consumer taking turns, compared against std::deque
+    simpleContainers::RingBuffer<int, std::allocator<int>, simpleContainers::PowerOfTwoCapacity> rbIntQueue(16);
+    std::deque<int> referenceQueue;
+    std::vector<int> drainedInts(16);
+    int counter = 0;
+    for (int round = 0; round < 200; ++round) {
+        const int pushCount = round % 7 + 1;
+        for (int i = 0; i < pushCount; ++i) {
+            rbIntQueue.push_back(counter);
+            referenceQueue.push_back(counter++);
+            if (referenceQueue.size() > rbIntQueue.capacity()) { referenceQueue.pop_front(); }
+        }
+
+        const std::size_t popCount = static_cast<std::size_t>(round % 5);
+        const std::size_t poppedInts = rbIntQueue.pop_n(drainedInts.begin(), popCount);
+        assert(poppedInts == std::min(popCount, poppedInts + rbIntQueue.size()));
+        assert(std::equal(drainedInts.begin(), drainedInts.begin() + static_cast<std::ptrdiff_t>(poppedInts), referenceQueue.begin()));
+        referenceQueue.erase(referenceQueue.begin(), referenceQueue.begin() + static_cast<std::ptrdiff_t>(poppedInts));
+        assert(std::equal(referenceQueue.begin(), referenceQueue.end(), rbIntQueue.begin()));
+        assert(rbIntQueue.empty() || (rbIntQueue.front() == referenceQueue.front() && rbIntQueue.back() == referenceQueue.back()));
+    }
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    // erase near the front, near the back and in the middle of a wrapped buffer, compared against std::deque
+    std::mt19937 rng{1234};
+    for (int round = 0; round < 300; ++round) {
+        simpleContainers::RingBuffer<std::string> rb2(13);
+        std::deque<std::string> reference;
+
+        const int pushCount = std::uniform_int_distribution<int>(1, 40)(rng);
+        for (int i = 0; i < pushCount; ++i) {
+            rb2.push_back(std::to_string(i));
+            reference.push_back(std::to_string(i));
+            if (reference.size() > rb2.capacity()) { reference.pop_front(); }
+        }
+
+        while (!reference.empty()) {
+            const std::size_t first = std::uniform_int_distribution<std::size_t>(0, reference.size() - 1)(rng);
+            const std::size_t count = std::uniform_int_distribution<std::size_t>(0, std::min<std::size_t>(3, reference.size() - first))(rng);
+            const auto firstIt = rb2.begin() + static_cast<std::ptrdiff_t>(first);
+            const auto rbIt = rb2.erase(firstIt, firstIt + static_cast<std::ptrdiff_t>(count));
+            const auto refFirstIt = reference.begin() + static_cast<std::ptrdiff_t>(first);
+            reference.erase(refFirstIt, refFirstIt + static_cast<std::ptrdiff_t>(count));
+
+            assert(rbIt - rb2.begin() == static_cast<std::ptrdiff_t>(first));
+            assert(rb2.size() == reference.size());
+            assert(std::equal(reference.begin(), reference.end(), rb2.begin()));
+
+            // keep inserting between erasures so that the oldest element moves around the storage
+            if (round % 2 == 0) {
+                rb2.push_back("new");
+                reference.push_back("new");
+                if (reference.size() > rb2.capacity()) { reference.pop_front(); }
+                rb2.erase(rb2.end() - 1);
+                reference.pop_back();
+            }
+            if (count == 0) {
+                rb2.pop_front();
+                reference.pop_front();
+            }
+        }
+        assert(rb2.empty());
+    }
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    // removing several oldest elements at once, with trivially and non-trivially destructible elements
+    simpleContainers::RingBuffer<int> rb3(5);
+    for (int i = 0; i < 7; ++i) { rb3.push_back(i); }
+    rb3.pop_front(0);
+    assert(rb3.size() == 5 && rb3.front() == 2);
+    rb3.pop_front(3);
+    assert(rb3.size() == 2 && rb3.front() == 5 && rb3.back() == 6);
+    rb3.push_back(7);
+    rb3.pop_front(3);
+    assert(rb3.empty());
+    for (int i = 0; i < 5; ++i) { rb3.push_back(i); }
+    rb3.pop_front(5);
+    assert(rb3.empty());
+    rb3.push_back(42);
+    assert(rb3.size() == 1 && rb3.front() == 42);
+
+    simpleContainers::RingBuffer<std::string, std::allocator<std::string>, simpleContainers::PowerOfTwoCapacity> rb4(4);
+    for (int i = 0; i < 6; ++i) { rb4.push_back(std::string(20, static_cast<char>('a' + i))); }
+    rb4.pop_front(3);
+    assert(rb4.size() == 1 && rb4.front() == std::string(20, 'f'));
+    rb4.push_back("g");
+    assert(rb4.size() == 2 && rb4[1] == "g");
+}
+
+void test_ring_buffer_recycling() {
+    std::cout << "================= TESTING RING BUFFER RECYCLING =================" << std::endl;
+
+    simpleContainers::RingBuffer<int> rb1(3);
+    rb1.recycle_back() = 1; // not full, a value initialized element is constructed
+    rb1.push_back_reuse([](int& elem) { elem = 2; });
+    rb1.push_back(3);
+    std::vector<int> expectedResult = {1, 2, 3};
+    assert(rb1.get_elements() == expectedResult);
+
+    int& recycled = rb1.recycle_back();
+    assert(recycled == 1 && &recycled == &rb1[2]); // the evicted element keeps its old value until it is refilled
+    recycled = 4;
+    expectedResult = {2, 3, 4};
+    assert(rb1.get_elements() == expectedResult);
+
+    bool thrown = false;
+    try {
+        rb1.push_back_reuse([](int&) { throw std::runtime_error{"fill failed"}; });
+    }
+    catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown && rb1.get_elements() == expectedResult);
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    // in steady state, refilling the evicted element in place does not allocate
+    using HistoryRingBuffer = simpleContainers::RingBuffer<HistoryEntry, SomeCountingAllocatorClass<HistoryEntry>>;
+    HistoryRingBuffer rb2(16);
+    const auto fillEntry = [](HistoryEntry& entry, const int i) {
+        entry.mName.assign("history entry that does not fit into the small string buffer ");
+        entry.mName.push_back(static_cast<char>('a' + i % 26));
+        entry.mValues.assign(32, i);
+    };
+
+    for (int i = 0; i < 16; ++i) {
+        rb2.push_back_reuse([&fillEntry, i](HistoryEntry& entry) { fillEntry(entry, i); });
+    }
+    assert(rb2.full());
+
+    AllocationCounter::allocation_count() = 0;
+    for (int i = 16; i < 1000; ++i) {
+        if (i % 2 == 0) {
+            rb2.push_back_reuse([&fillEntry, i](HistoryEntry& entry) { fillEntry(entry, i); });
+        }
+        else {
+            fillEntry(rb2.recycle_back(), i);
+        }
+    }
+    assert(AllocationCounter::allocation_count() == 0);
+    assert(rb2[0].mValues[0] == 984 && rb2[15].mValues[31] == 999 && rb2[15].mName.back() == 'a' + 999 % 26);
+
+    // push_back of a new element pays for its allocations
+    HistoryEntry newEntry;
+    fillEntry(newEntry, 1000);
+    const std::size_t allocationsForNewEntry = AllocationCounter::allocation_count();
+    rb2.push_back(newEntry);
+    assert(AllocationCounter::allocation_count() - allocationsForNewEntry == 2);
 }
 
 void test_ring_buffer_iterators() {
@@ -641,6 +1362,48 @@ void test_ring_buffer_iterators() {
     assert(rb3rait2 > rb3rait1);
     assert(rb3rait1 <= rb3rait2 && (rb3rait1 <= rb3rait2) == !(rb3rait1 > rb3rait2));
     assert(rb3rait2 >= rb3rait1 && (rb3rait2 >= rb3rait1) == !(rb3rait2 < rb3rait1));
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    // iterators point directly into the storage and wrap around its end, check them against operator[] for every
+    // starting position of the oldest element, both for a full buffer and for one with unused slots
+    for (int pushCount = 7; pushCount < 21; ++pushCount) {
+        simpleContainers::RingBuffer<int> rb4(7);
+        for (int i = 0; i < pushCount; ++i) { rb4.push_back(i); }
+        if (pushCount % 2 == 0) {
+            rb4.pop_front();
+            rb4.pop_back();
+        }
+        const simpleContainers::RingBuffer<int>& rb4ConstRef = rb4;
+        const std::ptrdiff_t rb4Size = static_cast<std::ptrdiff_t>(rb4.size());
+
+        std::ptrdiff_t pos = 0;
+        for (const int elem : rb4) {
+            assert(elem == rb4[static_cast<std::size_t>(pos)]);
+            ++pos;
+        }
+        assert(pos == rb4Size);
+
+        auto rb4RevIt = rb4ConstRef.cend();
+        for (pos = rb4Size - 1; pos >= 0; --pos) {
+            --rb4RevIt;
+            assert(&*rb4RevIt == &rb4[static_cast<std::size_t>(pos)]);
+        }
+        assert(rb4RevIt == rb4ConstRef.cbegin());
+
+        for (std::ptrdiff_t from = 0; from <= rb4Size; ++from) {
+            for (std::ptrdiff_t to = 0; to <= rb4Size; ++to) {
+                const auto itFrom = rb4.begin() + from;
+                const auto itTo = itFrom + (to - from);
+                assert(itTo == rb4.begin() + to && itTo - itFrom == to - from);
+                assert(itTo - (to - from) == itFrom);
+                if (to < rb4Size) {
+                    assert(&itFrom[to - from] == &rb4[static_cast<std::size_t>(to)]);
+                    assert(*itTo == rb4[static_cast<std::size_t>(to)]);
+                }
+            }
+        }
+    }
 }
 
 void test_ring_buffer_in_stl_containers() {
@@ -770,3 +1533,83 @@ void test_ring_buffer_in_stl_algorithms() {
 
     assert(4950 == std::accumulate(std::begin(rb1Cpy), std::end(rb1Cpy), long(0), [](long acc, long x) { return acc + x; }));
 }
+
+void test_ring_buffer_segment_algorithms() {
+    std::cout << "================= TESTING RING BUFFER SEGMENT ALGORITHMS =================" << std::endl;
+
+    simpleContainers::RingBuffer<long> rb1(6);
+    for (long i = 0; i < 9; ++i) { rb1.push_back(i * 10); } // {30, 40, 50, 60, 70, 80}, wrapped around
+
+    std::size_t segmentCount = 0;
+    std::size_t elementCount = 0;
+    simpleContainers::for_each_segment(rb1, [&segmentCount, &elementCount](simpleContainers::Segment<long> segment) {
+        ++segmentCount;
+        elementCount += segment.size();
+        for (long& elem : segment) { elem += 1; }
+    });
+    assert(segmentCount == 2 && elementCount == 6);
+
+    std::vector<long> copied;
+    simpleContainers::copy(rb1, std::back_inserter(copied));
+    std::vector<long> expectedResult = {31, 41, 51, 61, 71, 81};
+    assert(copied == expectedResult && copied == rb1.get_elements());
+
+    assert(simpleContainers::find(rb1, 41L) == rb1.begin() + 1);
+    assert(simpleContainers::find(rb1, 81L) == rb1.end() - 1); // in the second segment
+    assert(simpleContainers::find(rb1, 5L) == rb1.end());
+    const simpleContainers::RingBuffer<long>& rb1ConstRef = rb1;
+    assert(simpleContainers::find(rb1ConstRef, 71L) == rb1ConstRef.cbegin() + 4);
+
+    assert(simpleContainers::accumulate(rb1, 0L) == std::accumulate(rb1.begin(), rb1.end(), 0L));
+    assert(simpleContainers::accumulate(rb1, 1L, [](long acc, long elem) { return acc * (elem % 7); }) == 1L * 3 * 6 * 2 * 5 * 1 * 4);
+
+    simpleContainers::fill(rb1, 7L);
+    assert(simpleContainers::count(rb1, 7L) == 6 && simpleContainers::count(rb1, 8L) == 0);
+
+    // empty buffer
+    simpleContainers::RingBuffer<long> rbEmpty(3);
+    segmentCount = 0;
+    simpleContainers::for_each_segment(rbEmpty, [&segmentCount](simpleContainers::Segment<const long>) { ++segmentCount; });
+    assert(segmentCount == 0 && simpleContainers::find(rbEmpty, 1L) == rbEmpty.end() && simpleContainers::accumulate(rbEmpty, 3L) == 3L);
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    // equal and lexicographical_compare must agree with the iterator based algorithms for every combination of wrap points,
+    // with memcmp (int, unsigned char) and without it (std::string)
+    std::mt19937 rng{7};
+    for (int round = 0; round < 500; ++round) {
+        std::uniform_int_distribution<int> sizeDist(1, 8);
+        std::uniform_int_distribution<int> valueDist(0, 2);
+        simpleContainers::RingBuffer<int> rbInt1(static_cast<std::size_t>(sizeDist(rng)));
+        simpleContainers::RingBuffer<int, std::allocator<int>, simpleContainers::PowerOfTwoCapacity> rbInt2(static_cast<std::size_t>(sizeDist(rng)));
+        simpleContainers::RingBuffer<unsigned char> rbByte1(rbInt1.capacity());
+        simpleContainers::RingBuffer<unsigned char> rbByte2(rbInt2.capacity());
+        simpleContainers::RingBuffer<std::string> rbStr1(rbInt1.capacity());
+        simpleContainers::RingBuffer<std::string> rbStr2(rbInt2.capacity());
+
+        const int pushCount1 = sizeDist(rng) + sizeDist(rng);
+        for (int i = 0; i < pushCount1; ++i) {
+            const int value = valueDist(rng);
+            rbInt1.push_back(value);
+            rbByte1.push_back(static_cast<unsigned char>(value));
+            rbStr1.push_back(std::to_string(value));
+        }
+        const int pushCount2 = sizeDist(rng) + sizeDist(rng);
+        for (int i = 0; i < pushCount2; ++i) {
+            const int value = valueDist(rng);
+            rbInt2.push_back(value);
+            rbByte2.push_back(static_cast<unsigned char>(value));
+            rbStr2.push_back(std::to_string(value));
+        }
+
+        const bool expectedEqual = rbInt1.size() == rbInt2.size() && std::equal(rbInt1.begin(), rbInt1.end(), rbInt2.begin());
+        const bool expectedLess = std::lexicographical_compare(rbInt1.begin(), rbInt1.end(), rbInt2.begin(), rbInt2.end());
+        const bool expectedGreater = std::lexicographical_compare(rbInt2.begin(), rbInt2.end(), rbInt1.begin(), rbInt1.end());
+
+        assert(simpleContainers::equal(rbInt1, rbInt2) == expectedEqual);
+        assert(simpleContainers::lexicographical_compare(rbInt1, rbInt2) == expectedLess);
+        assert(simpleContainers::lexicographical_compare(rbInt2, rbInt1) == expectedGreater);
+        assert((rbByte1 == rbByte2) == expectedEqual && (rbByte1 < rbByte2) == expectedLess && (rbByte2 < rbByte1) == expectedGreater);
+        assert((rbStr1 == rbStr2) == expectedEqual && (rbStr1 < rbStr2) == expectedLess && (rbStr1 > rbStr2) == expectedGreater);
+    }
+}
@@ -0,0 +1,179 @@
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "simpleContainers/simpleSpscRingBuffer.hpp"
+
+#include "someTestClass.hpp"
+#include "someAllocatorClass.hpp"
+
+void test_spsc_ring_buffer_construction();
+void test_spsc_ring_buffer_push_and_pop();
+void test_spsc_ring_buffer_two_thread_throughput();
+void test_spsc_ring_buffer_two_thread_latency();
+
+int main() {
+    test_spsc_ring_buffer_construction();
+    test_spsc_ring_buffer_push_and_pop();
+    test_spsc_ring_buffer_two_thread_throughput();
+    test_spsc_ring_buffer_two_thread_latency();
+    return 0;
+}
+
+void test_spsc_ring_buffer_construction() {
+    std::cout << "================= TESTING SPSC RING BUFFER CONSTRUCTION =================" << std::endl;
+
+    simpleContainers::SpscRingBuffer<SomeClass> rb1; // default ctor
+    assert(rb1.capacity() == simpleContainers::SpscRingBuffer<SomeClass>::defaultInitialCapacity);
+    assert(rb1.size() == 0 && rb1.empty());
+
+    SomeAllocatorClass<SomeClass> customAlloc;
+    simpleContainers::SpscRingBuffer<SomeClass, SomeAllocatorClass<SomeClass>> rb1CustomAlloc(5, customAlloc); // ctor with custom allocator
+    assert(rb1CustomAlloc.capacity() == 5);
+    assert(rb1CustomAlloc.size() == 0);
+
+    for (int i = 0; i < 3; ++i) { rb1CustomAlloc.try_push(SomeClass{i}); }
+    assert(rb1CustomAlloc.size() == 3);
+    // remaining elements are destroyed through the allocator in the dtor
+}
+
+void test_spsc_ring_buffer_push_and_pop() {
+    std::cout << "================= TESTING SPSC RING BUFFER PUSH AND POP =================" << std::endl;
+
+    simpleContainers::SpscRingBuffer<int> rb1(4);
+    int out = -1;
+    bool success = rb1.try_pop(out);
+    assert(!success && out == -1);
+    assert(rb1.front() == nullptr);
+
+    for (int i = 0; i < 4; ++i) {
+        success = rb1.try_push(i);
+        assert(success);
+    }
+    assert(rb1.size() == 4);
+    success = rb1.try_push(4); // full, nothing is overwritten
+    assert(!success && rb1.size() == 4);
+
+    success = rb1.try_pop(out);
+    assert(success && out == 0);
+    success = rb1.try_push(4);
+    assert(success);
+    success = rb1.try_push(5);
+    assert(!success);
+
+    // wrap around the end of the storage several times
+    int expected = 1;
+    for (int i = 5; i < 50; ++i) {
+        success = rb1.try_pop(out);
+        assert(success && out == expected);
+        ++expected;
+        success = rb1.try_emplace(i);
+        assert(success);
+    }
+
+    assert(rb1.front() != nullptr && *rb1.front() == expected);
+    rb1.pop();
+    ++expected;
+    while (rb1.try_pop(out)) {
+        assert(out == expected);
+        ++expected;
+    }
+    assert(expected == 50 && rb1.empty());
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    // move only types
+    simpleContainers::SpscRingBuffer<std::unique_ptr<std::string>> rbMoveOnly(2);
+    rbMoveOnly.try_push(std::unique_ptr<std::string>(new std::string{"str1"}));
+    rbMoveOnly.try_emplace(new std::string{"str2"});
+    assert(rbMoveOnly.size() == 2);
+
+    std::unique_ptr<std::string> rejected(new std::string{"str3"});
+    success = rbMoveOnly.try_push(std::move(rejected));
+    assert(!success && rejected != nullptr && *rejected == "str3"); // not moved from on failure
+
+    std::unique_ptr<std::string> outPtr;
+    success = rbMoveOnly.try_pop(outPtr);
+    assert(success && *outPtr == "str1");
+    success = rbMoveOnly.try_pop(outPtr);
+    assert(success && *outPtr == "str2");
+    assert(rbMoveOnly.empty());
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    simpleContainers::SpscRingBuffer<SomeClass> rbSomeClass(3);
+    for (int i = 0; i < 3; ++i) { rbSomeClass.try_emplace(i); }
+    SomeClass scOut;
+    success = rbSomeClass.try_pop(scOut);
+    assert(success && scOut == SomeClass{0});
+}
+
+void test_spsc_ring_buffer_two_thread_throughput() {
+    std::cout << "================= TESTING SPSC RING BUFFER TWO THREAD THROUGHPUT =================" << std::endl;
+
+    const std::uint64_t elemCount = 1000000;
+    simpleContainers::SpscRingBuffer<std::uint64_t> rb(1024);
+
+    const auto start = std::chrono::steady_clock::now();
+
+    std::thread producer([&rb, elemCount]() {
+        for (std::uint64_t i = 0; i < elemCount; ++i) {
+            while (!rb.try_push(i)) { std::this_thread::yield(); }
+        }
+    });
+
+    std::uint64_t expected = 0;
+    std::uint64_t out = 0;
+    while (expected < elemCount) {
+        if (rb.try_pop(out)) {
+            assert(out == expected); // elements must arrive in insertion order
+            ++expected;
+        }
+        else {
+            std::this_thread::yield();
+        }
+    }
+
+    producer.join();
+    assert(rb.empty());
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "transferred " << elemCount << " elements in " << elapsed / 1000000 << " ms ("
+        << static_cast<double>(elemCount) * 1e9 / static_cast<double>(elapsed) << " elements/s)" << std::endl;
+}
+
+void test_spsc_ring_buffer_two_thread_latency() {
+    std::cout << "================= TESTING SPSC RING BUFFER TWO THREAD LATENCY =================" << std::endl;
+
+    // ping-pong between two buffers, every round trip is two handoffs between threads
+    const int roundTrips = 10000;
+    simpleContainers::SpscRingBuffer<int> ping(16);
+    simpleContainers::SpscRingBuffer<int> pong(16);
+
+    std::thread echo([&ping, &pong, roundTrips]() {
+        int val = 0;
+        for (int i = 0; i < roundTrips; ++i) {
+            while (!ping.try_pop(val)) { std::this_thread::yield(); }
+            while (!pong.try_push(val)) { std::this_thread::yield(); }
+        }
+    });
+
+    const auto start = std::chrono::steady_clock::now();
+
+    int val = 0;
+    for (int i = 0; i < roundTrips; ++i) {
+        while (!ping.try_push(i)) { std::this_thread::yield(); }
+        while (!pong.try_pop(val)) { std::this_thread::yield(); }
+        assert(val == i);
+    }
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    echo.join();
+
+    std::cout << "average round trip latency over " << roundTrips << " round trips: " << elapsed / roundTrips << " ns" << std::endl;
+}
@@ -0,0 +1,266 @@
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "simpleContainers/simpleStaticRingBuffer.hpp"
+
+#include "someTestClass.hpp"
+#include "someTemplateTestClass.hpp"
+
+void test_static_ring_buffer_construction();
+void test_static_ring_buffer_member_functions();
+void test_static_ring_buffer_insertion();
+void test_static_ring_buffer_iterators();
+void test_static_ring_buffer_in_stl_containers_and_algorithms();
+
+int main() {
+    test_static_ring_buffer_construction();
+    test_static_ring_buffer_member_functions();
+    test_static_ring_buffer_insertion();
+    test_static_ring_buffer_iterators();
+    test_static_ring_buffer_in_stl_containers_and_algorithms();
+    return 0;
+}
+
+void test_static_ring_buffer_construction() {
+    std::cout << "================= TESTING STATIC RING BUFFER CONSTRUCTION =================" << std::endl;
+
+    // elements live inside the object itself
+    static_assert(sizeof(simpleContainers::StaticRingBuffer<int, 16>) >= 16 * sizeof(int), "StaticRingBuffer must store elements inline");
+    static_assert(alignof(simpleContainers::StaticRingBuffer<double, 4>) >= alignof(double), "StaticRingBuffer storage must be aligned for T");
+
+    simpleContainers::StaticRingBuffer<SomeClass, 5> rb1; // default ctor
+    assert(rb1.capacity() == 5 && rb1.size() == 0 && rb1.empty());
+
+    simpleContainers::StaticRingBuffer<SomeClass, 5> rb2 = rb1;  // copy ctor
+    assert(rb2.capacity() == rb1.capacity() && rb2.size() == rb1.size());
+
+    simpleContainers::StaticRingBuffer<char, 5> rbFill('a');      // fill ctor
+    assert(rbFill.full());
+    std::vector<char> rbFillExpected(5, 'a');
+    assert(rbFill.get_elements() == rbFillExpected);
+
+    simpleContainers::StaticRingBuffer<int, 4> rbFromInitList{1, 2, 3};     // ctor from initializer list
+    assert(rbFromInitList.size() == 3 && rbFromInitList.capacity() == 4);
+
+    simpleContainers::StaticRingBuffer<int, 4> rbFromLongInitList{1, 2, 3, 4, 5, 6};     // only the last 4 are kept
+    std::vector<int> rbFromLongInitListExpected{3, 4, 5, 6};
+    assert(rbFromLongInitList.get_elements() == rbFromLongInitListExpected);
+
+    std::vector<int> tmpVec{1, 2, 3, 4, 5};
+    simpleContainers::StaticRingBuffer<int, 8> rbFromIterators(tmpVec.begin(), tmpVec.end());   // iterator pair ctor
+    assert(rbFromIterators.get_elements() == tmpVec);
+
+    simpleContainers::StaticRingBuffer<std::string, 3> rbStr1{"a", "b", "c", "d"};
+    simpleContainers::StaticRingBuffer<std::string, 3> rbStr2 = rbStr1;  // copy of a wrapped buffer
+    assert(rbStr1 == rbStr2);
+
+    simpleContainers::StaticRingBuffer<std::string, 3> rbStr3 = std::move(rbStr2); // move ctor
+    assert(rbStr3 == rbStr1 && rbStr2.empty());
+
+    rbStr2 = rbStr3; // copy assignment
+    assert(rbStr2 == rbStr3);
+
+    rbStr2 = simpleContainers::StaticRingBuffer<std::string, 3>{"x"}; // move assignment
+    std::vector<std::string> rbStr2Expected{"x"};
+    assert(rbStr2.get_elements() == rbStr2Expected);
+}
+
+void test_static_ring_buffer_member_functions() {
+    std::cout << "================= TESTING STATIC RING BUFFER MEMBER FUNCTIONS =================" << std::endl;
+
+    simpleContainers::StaticRingBuffer<std::string, 5> rbSwap1;
+    for (int i = 0; i < 7; ++i) { rbSwap1.emplace_back(std::to_string(i)); }
+    std::vector<std::string> rbSwap1ExpectedContents{"2", "3", "4", "5", "6"};
+    assert(rbSwap1.get_elements() == rbSwap1ExpectedContents);
+
+    simpleContainers::StaticRingBuffer<std::string, 5> rbSwap2;
+    for (int i = 7; i < 10; ++i) { rbSwap2.emplace_back(std::to_string(i)); }
+    std::vector<std::string> rbSwap2ExpectedContents{"7", "8", "9"};
+
+    rbSwap1.swap(rbSwap2);
+    assert(rbSwap1.get_elements() == rbSwap2ExpectedContents);
+    assert(rbSwap2.get_elements() == rbSwap1ExpectedContents);
+
+    std::swap(rbSwap1, rbSwap2);
+    assert(rbSwap1.get_elements() == rbSwap1ExpectedContents);
+    assert(rbSwap2.get_elements() == rbSwap2ExpectedContents);
+
+    assert(rbSwap1.full());
+    rbSwap1.clear();
+    assert(rbSwap1.empty());
+
+    std::cout << "------------------------------------------------------" << std::endl;
+
+    // test subscript operators on a non power of two and a power of two capacity
+    simpleContainers::StaticRingBuffer<int, 6> rbSubscript;
+    for (int i = 0; i < 9; ++i) { rbSubscript.emplace_back(i); }
+    std::vector<int> rbSubscriptExpected = {3, 4, 5, 6, 7, 8};       // actual order in storage {6, 7, 8, 3, 4, 5}
+    assert(rbSubscript.get_elements() == rbSubscriptExpected);
+    assert(rbSubscript[0] == 3 && rbSubscript[2] == 5 && rbSubscript[3] == 6 && rbSubscript[5] == 8);
+    assert(rbSubscript.at(0) == 3 && rbSubscript.at(2) == 5 && rbSubscript.at(3) == 6 && rbSubscript.at(5) == 8);
+
+    simpleContainers::StaticRingBuffer<int, 8> rbSubscriptPow2;
+    for (int i = 0; i < 11; ++i) { rbSubscriptPow2.emplace_back(i); }
+    for (std::size_t i = 0; i < rbSubscriptPow2.size(); ++i) {
+        assert(rbSubscriptPow2[i] == static_cast<int>(i) + 3);
+        assert(rbSubscriptPow2.at(i) == static_cast<int>(i) + 3);
+    }
+
+    rbSubscriptPow2[2] = 0;
+    rbSubscriptPow2.at(7) = 0;
+    std::vector<int> rbSubscriptPow2Expected = {3, 4, 0, 6, 7, 8, 9, 0};
+    assert(rbSubscriptPow2.get_elements() == rbSubscriptPow2Expected);
+
+    bool thrown = false;
+    try {
+        simpleContainers::StaticRingBuffer<int, 8> rbAtEmpty;
+        rbAtEmpty.at(0) = 1;
+    }
+    catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+}
+
+void test_static_ring_buffer_insertion() {
+    std::cout << "================= TESTING STATIC RING BUFFER INSERTION =================" << std::endl;
+
+    simpleContainers::StaticRingBuffer<int, 5> rb1;
+
+    for (int i = 0; i < 50; ++i) {
+        rb1.push_back(i);
+
+        if (i == 3) {
+            std::vector<int> expectedResult = {0, 1, 2, 3};
+            assert(rb1.get_elements() == expectedResult);
+        }
+        else if (i == 5) {
+            std::vector<int> expectedResult = {1, 2, 3, 4, 5};
+            assert(rb1.get_elements() == expectedResult);
+        }
+        else if (i == 38) {
+            std::vector<int> expectedResult = {34, 35, 36, 37, 38};
+            assert(rb1.get_elements() == expectedResult);
+        }
+    }
+
+    simpleContainers::StaticRingBuffer<SomeClass, 4> rb2;
+    for (int i = 0; i < 10; ++i) {
+        std::cout << "-------" << std::endl;
+        rb2.push_back(SomeClass{i});
+        std::cout << "-------" << std::endl;
+    }
+
+    simpleContainers::StaticRingBuffer<SomeClass, 4> rb3;
+    for (int i = 0; i < 10; ++i) {
+        std::cout << "-------" << std::endl;
+        rb3.emplace_back(i);
+        std::cout << "-------" << std::endl;
+    }
+    assert(rb2 == rb3);
+
+    simpleContainers::StaticRingBuffer<SomeTemplateClass<std::string>, 3> rbWithTemplateClass;
+    rbWithTemplateClass.push_back(SomeTemplateClass<std::string>{"someStr1"});
+    rbWithTemplateClass.emplace_back("someStr2");
+    assert(rbWithTemplateClass.size() == 2);
+
+    // test comparison operators
+    simpleContainers::StaticRingBuffer<int, 4> rbCmp1{1, 2, 3};
+    simpleContainers::StaticRingBuffer<int, 4> rbCmp2{1, 2, 3};
+    assert(rbCmp1 == rbCmp2 && rbCmp1 <= rbCmp2 && rbCmp1 >= rbCmp2);
+    assert(!(rbCmp1 < rbCmp2) && !(rbCmp1 > rbCmp2));
+
+    rbCmp2 = {2, 3, 4, 5};
+    assert(rbCmp1 != rbCmp2);
+    assert(rbCmp1 < rbCmp2 && !(rbCmp2 < rbCmp1) && rbCmp2 > rbCmp1);
+
+    rbCmp2 = {0, 0, 1, 2, 3}; // only {0, 1, 2, 3} is kept
+    assert(rbCmp2.size() == 4);
+    rbCmp1.push_back(0);
+    rbCmp1.push_back(1); // {2, 3, 0, 1}
+    assert(rbCmp2 < rbCmp1);
+}
+
+void test_static_ring_buffer_iterators() {
+    std::cout << "================= TESTING STATIC RING BUFFER ITERATORS =================" << std::endl;
+
+    simpleContainers::StaticRingBuffer<int, 10> rb1;
+    assert(rb1.begin() == rb1.end());
+
+    for (int i = 0; i < 15; ++i) { rb1.emplace_back(i); }
+
+    std::size_t elemCnt = 0;
+    std::for_each(rb1.begin(), rb1.end(), [&elemCnt](const int){ ++elemCnt; });
+    assert(elemCnt == 10);
+    assert(*(rb1.begin()) == 5);
+
+    auto itrb1Find = std::find(rb1.begin(), rb1.end(), 12);
+    assert(itrb1Find != rb1.end() && *itrb1Find == 12 && itrb1Find - rb1.begin() == 7);
+
+    for (auto& elem : rb1) { elem = 0; }
+    for (auto it = rb1.cbegin(); it != rb1.cend(); ++it) { assert(*it == 0); }
+
+    simpleContainers::StaticRingBuffer<int, 10>::const_iterator rb1ConstItFromNonConstIt = rb1.begin();
+    assert(*rb1ConstItFromNonConstIt == *rb1.begin());
+
+    std::cout << "------------------------------------------------------" << std::endl;
+    // testing random access for iterators
+
+    simpleContainers::StaticRingBuffer<int, 5> rb3;
+    for (int i = 1; i < 8; ++i) { rb3.emplace_back(i); }
+    std::vector<int> rb3Expected{3, 4, 5, 6, 7};
+    assert(rb3.get_elements() == rb3Expected); // actual order in storage {6, 7, 3, 4, 5}
+
+    auto rb3rait1 = rb3.begin();      assert(*rb3rait1 == 3);
+    assert(rb3.begin() + 5 == rb3.end());
+    rb3rait1 += 3;                     assert(*rb3rait1 == 6);
+    rb3rait1 += (-1);                  assert(*rb3rait1 == 5);
+    assert(rb3rait1 + 1 == 1 + rb3rait1 && *(rb3rait1 + 1) == *(1 + rb3rait1));
+    rb3rait1 -= 1;                     assert(*rb3rait1 == 4);
+    assert(rb3rait1[-1] == 3 && rb3rait1[0] == 4 && rb3rait1[1] == 5);
+    rb3rait1--;                        assert(*rb3rait1 == 3 && rb3rait1 == rb3.begin());
+
+    auto rb3rait2 = rb3.end();
+    assert(static_cast<std::size_t>(rb3rait2 - rb3rait1) == rb3.size());
+    assert(rb3rait1 < rb3rait2 && rb3rait2 > rb3rait1 && rb3rait1 <= rb3rait2 && rb3rait2 >= rb3rait1);
+}
+
+void test_static_ring_buffer_in_stl_containers_and_algorithms() {
+    std::cout << "================= TESTING STATIC RING BUFFER IN STL CONTAINERS AND ALGORITHMS =================" << std::endl;
+
+    std::vector<simpleContainers::StaticRingBuffer<SomeClass, 8>> vectorOfRingBuffers(5);
+    for (auto& vecRb : vectorOfRingBuffers) {
+        for (int i = 0; i < 5; ++i) { vecRb.emplace_back(i); }
+    }
+    vectorOfRingBuffers.resize(10); // relocation of the inline storage
+    for (std::size_t i = 0; i < vectorOfRingBuffers.size(); ++i) {
+        assert(vectorOfRingBuffers[i].size() == (i < 5 ? 5u : 0u));
+    }
+
+    std::set<simpleContainers::StaticRingBuffer<int, 3>> setOfRingBuffers;
+    setOfRingBuffers.insert(simpleContainers::StaticRingBuffer<int, 3>{3, 4, 5});
+    setOfRingBuffers.insert(simpleContainers::StaticRingBuffer<int, 3>{1, 2, 3});
+    setOfRingBuffers.insert(simpleContainers::StaticRingBuffer<int, 3>{0, 1, 2, 3});
+    assert(setOfRingBuffers.size() == 2);
+    assert(setOfRingBuffers.begin()->get_elements() == std::vector<int>({1, 2, 3}));
+
+    simpleContainers::StaticRingBuffer<long, 7> rb1{262, 3426, -123, 552, -91, 251, 673};
+    assert(std::count(rb1.cbegin(), rb1.cend(), 552) == 1);
+
+    auto rb1Cpy = rb1;
+    std::sort(rb1Cpy.begin(), rb1Cpy.end());
+    assert(std::is_sorted(rb1Cpy.begin(), rb1Cpy.end()));
+    assert(*std::min_element(rb1Cpy.begin(), rb1Cpy.end()) == -123);
+    assert(4950 == std::accumulate(rb1Cpy.begin(), rb1Cpy.end(), 0L));
+
+    std::reverse(rb1.begin(), rb1.end());
+    std::vector<long> rb1Expected = {673, 251, -91, 552, -123, 3426, 262};
+    assert(rb1.get_elements() == rb1Expected);
+}
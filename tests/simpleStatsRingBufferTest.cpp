@@ -0,0 +1,229 @@
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "simpleContainers/simpleStatsRingBuffer.hpp"
+
+void test_compensated_sum();
+void test_stats_ring_buffer_construction();
+void test_stats_ring_buffer_window_statistics();
+void test_stats_ring_buffer_ewma();
+void test_stats_ring_buffer_precision();
+
+int main() {
+    test_compensated_sum();
+    test_stats_ring_buffer_construction();
+    test_stats_ring_buffer_window_statistics();
+    test_stats_ring_buffer_ewma();
+    test_stats_ring_buffer_precision();
+    return 0;
+}
+
+namespace {
+    bool nearly_equal(const double lhs, const double rhs, const double relativeTolerance = 1e-9) {
+        return std::fabs(lhs - rhs) <= relativeTolerance * std::max(1.0, std::max(std::fabs(lhs), std::fabs(rhs)));
+    }
+
+    // statistics calculated from scratch with two passes, used as reference
+    template <typename Container>
+    void check_against_two_pass(const Container& stats) {
+        const std::vector<double> elems(stats.begin(), stats.end());
+        const double count = static_cast<double>(elems.size());
+        const double expectedMean = std::accumulate(elems.begin(), elems.end(), 0.0) / count;
+        double squaredDeviations = 0.0;
+        for (const double elem : elems) {
+            squaredDeviations += (elem - expectedMean) * (elem - expectedMean);
+        }
+
+        assert(nearly_equal(stats.sum(), expectedMean * count));
+        assert(nearly_equal(stats.mean(), expectedMean));
+        assert(nearly_equal(stats.variance(), squaredDeviations / count));
+        assert(nearly_equal(stats.stddev(), std::sqrt(squaredDeviations / count)));
+        if (elems.size() > 1) {
+            assert(nearly_equal(stats.sample_variance(), squaredDeviations / (count - 1.0)));
+        }
+    }
+} // namespace
+
+void test_compensated_sum() {
+    std::cout << "================= TESTING COMPENSATED SUM =================" << std::endl;
+
+    simpleContainers::CompensatedSum sum1;
+    assert(nearly_equal(sum1.value(), 0.0));
+
+    // every 1.0 is lost when added to 1e16 with plain summation
+    sum1.add(1e16);
+    for (int i = 0; i < 1000; ++i) { sum1.add(1.0); }
+    sum1.add(-1e16);
+    assert(nearly_equal(sum1.value(), 1000.0));
+
+    double plainSum = 0.0;
+    simpleContainers::CompensatedSum sum2;
+    for (int i = 0; i < 10000000; ++i) {
+        plainSum += 0.1;
+        sum2.add(0.1);
+    }
+    assert(std::fabs(sum2.value() - 1000000.0) < std::fabs(plainSum - 1000000.0));
+    assert(nearly_equal(sum2.value(), 1000000.0, 1e-15));
+
+    sum2.reset();
+    assert(nearly_equal(sum2.value(), 0.0));
+}
+
+void test_stats_ring_buffer_construction() {
+    std::cout << "================= TESTING STATS RING BUFFER CONSTRUCTION =================" << std::endl;
+
+    simpleContainers::StatsRingBuffer<double> stats1;
+    assert(stats1.capacity() == simpleContainers::RingBuffer<double>::defaultInitialCapacity);
+    assert(stats1.empty() && stats1.size() == 0 && !stats1.full());
+    assert(nearly_equal(stats1.sum(), 0.0));
+    assert(nearly_equal(stats1.ewma_alpha(), simpleContainers::StatsRingBuffer<double>::defaultEwmaAlpha));
+
+    simpleContainers::StatsRingBuffer<int, std::allocator<int>, simpleContainers::PowerOfTwoCapacity> stats2(5, 0.5);
+    assert(stats2.capacity() == 8 && nearly_equal(stats2.ewma_alpha(), 0.5));
+
+    for (int i = 1; i <= 10; ++i) { stats2.push_back(i); }
+    assert(stats2.full() && stats2.size() == 8);
+    assert(stats2.front() == 3 && stats2.back() == 10 && stats2[1] == 4 && stats2.at(7) == 10);
+    assert(stats2.elements().size() == 8 && stats2.elements()[0] == 3);
+    assert(std::equal(stats2.cbegin(), stats2.cend(), stats2.elements().begin()));
+
+    bool thrown = false;
+    try {
+        stats2.at(8);
+    }
+    catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // copies carry the statistics with them
+    simpleContainers::StatsRingBuffer<int, std::allocator<int>, simpleContainers::PowerOfTwoCapacity> stats2Cpy{stats2};
+    assert(nearly_equal(stats2Cpy.sum(), 52.0) && nearly_equal(stats2Cpy.mean(), 6.5));
+
+    stats2.clear();
+    assert(stats2.empty() && nearly_equal(stats2.sum(), 0.0));
+    assert(nearly_equal(stats2Cpy.sum(), 52.0));
+}
+
+void test_stats_ring_buffer_window_statistics() {
+    std::cout << "================= TESTING STATS RING BUFFER WINDOW STATISTICS =================" << std::endl;
+
+    simpleContainers::StatsRingBuffer<double> stats1(4);
+    stats1.push_back(2.0);
+    assert(nearly_equal(stats1.mean(), 2.0) && nearly_equal(stats1.variance(), 0.0));
+    stats1.emplace_back(4.0);
+    stats1.push_back(4.0);
+    stats1.push_back(4.0);
+    // {2, 4, 4, 4}
+    assert(nearly_equal(stats1.sum(), 14.0) && nearly_equal(stats1.mean(), 3.5));
+    assert(nearly_equal(stats1.variance(), 0.75) && nearly_equal(stats1.sample_variance(), 1.0));
+    stats1.push_back(5.0);
+    // {4, 4, 4, 5}
+    assert(nearly_equal(stats1.sum(), 17.0) && nearly_equal(stats1.variance(), 0.1875));
+
+    stats1.pop_front();
+    stats1.pop_front();
+    // {4, 5}
+    assert(stats1.size() == 2 && nearly_equal(stats1.mean(), 4.5) && nearly_equal(stats1.stddev(), 0.5));
+    stats1.pop_front();
+    stats1.pop_front();
+    assert(stats1.empty() && nearly_equal(stats1.sum(), 0.0));
+
+    // sums start over relative to a new first element
+    stats1.push_back(-100.0);
+    stats1.push_back(100.0);
+    assert(nearly_equal(stats1.mean(), 0.0) && nearly_equal(stats1.variance(), 10000.0));
+
+    // randomized inserts and pops against two-pass statistics
+    std::mt19937 rng(2024);
+    std::uniform_real_distribution<double> valueDist(-50.0, 150.0);
+    std::uniform_int_distribution<int> actionDist(0, 9);
+
+    simpleContainers::StatsRingBuffer<double> stats2(37);
+    for (int i = 0; i < 20000; ++i) {
+        if (actionDist(rng) == 0 && !stats2.empty()) {
+            stats2.pop_front();
+        }
+        else {
+            stats2.push_back(valueDist(rng));
+        }
+
+        if (!stats2.empty() && i % 50 == 0) {
+            check_against_two_pass(stats2);
+        }
+    }
+
+    simpleContainers::StatsRingBuffer<std::int16_t> stats3(100);
+    for (int i = 0; i < 1000; ++i) {
+        stats3.push_back(static_cast<std::int16_t>((i * 7919) % 30000 - 15000));
+    }
+    check_against_two_pass(stats3);
+
+    stats3.recalculate();
+    check_against_two_pass(stats3);
+}
+
+void test_stats_ring_buffer_ewma() {
+    std::cout << "================= TESTING STATS RING BUFFER EWMA =================" << std::endl;
+
+    simpleContainers::StatsRingBuffer<double> stats1(2, 0.5);
+    stats1.push_back(8.0);
+    assert(nearly_equal(stats1.ewma(), 8.0));
+    stats1.push_back(4.0);
+    assert(nearly_equal(stats1.ewma(), 6.0));
+    stats1.push_back(0.0);
+    // evicted elements still contribute to the EWMA
+    assert(nearly_equal(stats1.ewma(), 3.0) && nearly_equal(stats1.mean(), 2.0));
+
+    stats1.pop_front();
+    stats1.pop_front();
+    assert(nearly_equal(stats1.ewma(), 3.0));
+    stats1.push_back(5.0);
+    assert(nearly_equal(stats1.ewma(), 4.0));
+
+    stats1.clear();
+    stats1.push_back(10.0);
+    assert(nearly_equal(stats1.ewma(), 10.0));
+
+    // alpha of 1 only follows the newest value
+    simpleContainers::StatsRingBuffer<int> stats2(10, 1.0);
+    for (int i = 0; i < 5; ++i) { stats2.push_back(i * 3); }
+    assert(nearly_equal(stats2.ewma(), 12.0));
+
+    // EWMA of a constant signal converges to it
+    simpleContainers::StatsRingBuffer<float> stats3(16, 0.2);
+    stats3.push_back(0.0f);
+    for (int i = 0; i < 200; ++i) { stats3.push_back(1.0f); }
+    assert(nearly_equal(stats3.ewma(), 1.0, 1e-12));
+}
+
+void test_stats_ring_buffer_precision() {
+    std::cout << "================= TESTING STATS RING BUFFER PRECISION =================" << std::endl;
+
+    // large offset with small spread, naive sum of squares would cancel catastrophically
+    simpleContainers::StatsRingBuffer<double> stats1(1000);
+    std::mt19937_64 rng(99);
+    std::normal_distribution<double> dist(1e9, 0.5);
+    for (int i = 0; i < 200000; ++i) {
+        stats1.push_back(dist(rng));
+    }
+    check_against_two_pass(stats1);
+    assert(stats1.stddev() > 0.4 && stats1.stddev() < 0.6);
+
+    // after millions of insertions and evictions the window sum is still exact for values with a short binary representation
+    simpleContainers::StatsRingBuffer<double> stats2(100);
+    for (int i = 0; i < 5000000; ++i) {
+        stats2.push_back(static_cast<double>(i % 1000) * 0.1);
+    }
+    // window holds 0.1 * {900, ..., 999}
+    assert(nearly_equal(stats2.sum(), 0.1 * (900.0 + 999.0) * 50.0, 1e-14));
+    check_against_two_pass(stats2);
+}
@@ -0,0 +1,221 @@
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "simpleContainers/simpleTimedRingBuffer.hpp"
+
+/// @brief Clock that only moves when told to, so tests do not depend on real time
+struct ManualClock {
+    using rep = std::int64_t;
+    using period = std::milli;
+    using duration = std::chrono::duration<rep, period>;
+    using time_point = std::chrono::time_point<ManualClock>;
+    static constexpr bool is_steady = true;
+
+    static time_point now() noexcept { return time_point{duration{currentMs}}; }
+
+    static rep currentMs;
+};
+
+constexpr bool ManualClock::is_steady;
+ManualClock::rep ManualClock::currentMs = 0;
+
+using Milliseconds = ManualClock::duration;
+using TimePoint = ManualClock::time_point;
+
+void test_timed_ring_buffer_construction();
+void test_timed_ring_buffer_expiration();
+void test_timed_ring_buffer_range_queries();
+void test_timed_ring_buffer_randomized();
+
+int main() {
+    test_timed_ring_buffer_construction();
+    test_timed_ring_buffer_expiration();
+    test_timed_ring_buffer_range_queries();
+    test_timed_ring_buffer_randomized();
+    return 0;
+}
+
+namespace {
+    TimePoint at_ms(const std::int64_t ms) {
+        return TimePoint{Milliseconds{ms}};
+    }
+
+    template <typename T>
+    std::vector<T> joined(const std::pair<simpleContainers::Segment<const T>, simpleContainers::Segment<const T>>& parts) {
+        std::vector<T> result(parts.first.begin(), parts.first.end());
+        result.insert(result.end(), parts.second.begin(), parts.second.end());
+        return result;
+    }
+} // namespace
+
+void test_timed_ring_buffer_construction() {
+    std::cout << "================= TESTING TIMED RING BUFFER CONSTRUCTION =================" << std::endl;
+
+    simpleContainers::TimedRingBuffer<int> rb1;
+    assert(rb1.capacity() == simpleContainers::RingBuffer<int>::defaultInitialCapacity);
+    assert(rb1.empty() && rb1.size() == 0 && !rb1.full() && rb1.begin() == rb1.end());
+
+    // real clock
+    rb1.push_back(1);
+    rb1.push_back(2);
+    assert(rb1.size() == 2 && !(rb1.newest_timestamp() < rb1.oldest_timestamp()));
+    const std::size_t expiredCount = rb1.expire_older_than(std::chrono::steady_clock::now() + std::chrono::hours{1});
+    assert(expiredCount == 2 && rb1.empty());
+
+    simpleContainers::TimedRingBuffer<std::string, ManualClock, std::allocator<std::string>, simpleContainers::PowerOfTwoCapacity> rb2(3);
+    assert(rb2.capacity() == 4);
+
+    ManualClock::currentMs = 10;
+    rb2.push_back("a");
+    std::string b = "b";
+    rb2.push_back(b, at_ms(20));
+    rb2.push_back(std::string("c"), at_ms(20));
+    rb2.emplace_back(at_ms(30), std::size_t{3}, 'd');
+    assert(rb2.full() && rb2.front() == "a" && rb2.back() == "ddd" && rb2[1] == "b" && rb2.at(2) == "c");
+    assert(rb2.oldest_timestamp() == at_ms(10) && rb2.newest_timestamp() == at_ms(30) && rb2.timestamp(2) == at_ms(20));
+
+    // values can be modified in place, timestamps stay
+    rb2.front() = "A";
+    rb2[3] += "!";
+    assert(rb2.values()[0] == "A" && rb2.back() == "ddd!" && rb2.timestamps()[0] == at_ms(10));
+
+    // overwriting the oldest element drops its timestamp as well
+    rb2.push_back("e", at_ms(40));
+    assert(rb2.size() == 4 && rb2.front() == "b" && rb2.oldest_timestamp() == at_ms(20));
+
+    bool thrown = false;
+    try {
+        rb2.at(4);
+    }
+    catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    auto rb2Cpy = rb2;
+    rb2.clear();
+    assert(rb2.empty() && rb2.timestamps().empty());
+    assert(rb2Cpy.size() == 4 && std::equal(rb2Cpy.cbegin(), rb2Cpy.cend(), rb2Cpy.values().begin()));
+}
+
+void test_timed_ring_buffer_expiration() {
+    std::cout << "================= TESTING TIMED RING BUFFER EXPIRATION =================" << std::endl;
+
+    simpleContainers::TimedRingBuffer<int, ManualClock> rb1(8);
+    std::size_t expiredCount = rb1.expire_older_than(at_ms(100));
+    assert(expiredCount == 0);
+
+    // timestamps 0, 10, ..., 110, the buffer wraps around
+    for (int i = 0; i < 12; ++i) {
+        rb1.push_back(i, at_ms(i * 10));
+    }
+    assert(rb1.size() == 8 && rb1.front() == 4);
+    assert(!rb1.values().array_two().empty());
+
+    expiredCount = rb1.expire_older_than(at_ms(40));
+    assert(expiredCount == 0);
+    expiredCount = rb1.expire_older_than(at_ms(41));
+    assert(expiredCount == 1 && rb1.front() == 5);
+    // cutoff in the second segment
+    expiredCount = rb1.expire_older_than(at_ms(95));
+    assert(expiredCount == 5 && rb1.front() == 10 && rb1.size() == 2);
+    expiredCount = rb1.expire_older_than(at_ms(1000));
+    assert(expiredCount == 2 && rb1.empty());
+
+    // equal timestamps are expired together
+    simpleContainers::TimedRingBuffer<int, ManualClock> rb2(10);
+    rb2.push_back(1, at_ms(5));
+    rb2.push_back(2, at_ms(5));
+    rb2.push_back(3, at_ms(5));
+    rb2.push_back(4, at_ms(6));
+    assert(rb2.lower_bound(at_ms(5)) == 0 && rb2.lower_bound(at_ms(6)) == 3 && rb2.lower_bound(at_ms(7)) == 4);
+    expiredCount = rb2.expire_older_than(at_ms(6));
+    assert(expiredCount == 3 && rb2.size() == 1 && rb2.front() == 4);
+
+    rb2.pop_front();
+    assert(rb2.empty());
+
+    // sliding window of the last 60 seconds
+    simpleContainers::TimedRingBuffer<std::string, ManualClock> rb3(1000);
+    for (ManualClock::currentMs = 0; ManualClock::currentMs < 300000; ManualClock::currentMs += 700) {
+        rb3.push_back(std::to_string(ManualClock::currentMs));
+        rb3.expire_older_than(ManualClock::now() - std::chrono::seconds{60});
+        assert(ManualClock::now() - rb3.oldest_timestamp() < std::chrono::seconds{60});
+        assert(rb3.size() <= 86);
+    }
+}
+
+void test_timed_ring_buffer_range_queries() {
+    std::cout << "================= TESTING TIMED RING BUFFER RANGE QUERIES =================" << std::endl;
+
+    simpleContainers::TimedRingBuffer<int, ManualClock> rb1(6);
+    for (int i = 0; i < 9; ++i) {
+        rb1.push_back(i, at_ms(i * 100));
+    }
+    // elements 3..8, timestamps 300..800, stored as {6, 7, 8, 3, 4, 5}
+
+    assert(rb1.count_in(at_ms(0), at_ms(10000)) == 6);
+    assert(rb1.count_in(at_ms(350), at_ms(350)) == 0);
+    assert(rb1.count_in(at_ms(800), at_ms(300)) == 0);
+
+    const auto wrapping = rb1.range(at_ms(350), at_ms(701));
+    assert((joined(wrapping) == std::vector<int>{4, 5, 6, 7}));
+    assert(wrapping.first.size() == 2 && wrapping.second.size() == 2);
+    assert(wrapping.second.data() == rb1.values().array_two().data());
+
+    const auto firstOnly = rb1.range(at_ms(300), at_ms(500));
+    assert((joined(firstOnly) == std::vector<int>{3, 4}) && firstOnly.second.empty());
+
+    const auto secondOnly = rb1.range(at_ms(600), at_ms(900));
+    assert((joined(secondOnly) == std::vector<int>{6, 7, 8}) && secondOnly.second.empty());
+
+    const auto none = rb1.range(at_ms(900), at_ms(1000));
+    assert(none.first.empty() && none.second.empty());
+
+    const auto timestamps = rb1.timestamp_range(at_ms(350), at_ms(701));
+    assert((joined(timestamps) == std::vector<TimePoint>{at_ms(400), at_ms(500), at_ms(600), at_ms(700)}));
+}
+
+void test_timed_ring_buffer_randomized() {
+    std::cout << "================= TESTING TIMED RING BUFFER AGAINST LINEAR SCAN =================" << std::endl;
+
+    std::mt19937 rng(777);
+    std::uniform_int_distribution<int> stepDist(0, 3);
+    std::uniform_int_distribution<int> actionDist(0, 9);
+
+    simpleContainers::TimedRingBuffer<std::uint64_t, ManualClock> rb1(50);
+    std::int64_t now = 0;
+    for (int i = 0; i < 20000; ++i) {
+        now += stepDist(rng);
+        rb1.push_back(static_cast<std::uint64_t>(i), at_ms(now));
+
+        const std::int64_t t0 = now - std::uniform_int_distribution<std::int64_t>(0, 80)(rng);
+        const std::int64_t t1 = t0 + std::uniform_int_distribution<std::int64_t>(0, 40)(rng);
+
+        std::vector<std::uint64_t> expected;
+        for (std::size_t pos = 0; pos < rb1.size(); ++pos) {
+            if (!(rb1.timestamp(pos) < at_ms(t0)) && rb1.timestamp(pos) < at_ms(t1)) {
+                expected.push_back(rb1[pos]);
+            }
+        }
+        assert(joined(rb1.range(at_ms(t0), at_ms(t1))) == expected);
+        assert(rb1.count_in(at_ms(t0), at_ms(t1)) == expected.size());
+
+        if (actionDist(rng) == 0) {
+            const std::size_t expectedExpired = static_cast<std::size_t>(
+                std::count_if(rb1.timestamps().begin(), rb1.timestamps().end(), [t0](const TimePoint t) { return t < at_ms(t0); }));
+            const std::size_t expiredCount = rb1.expire_older_than(at_ms(t0));
+            assert(expiredCount == expectedExpired);
+            assert(rb1.empty() || !(rb1.oldest_timestamp() < at_ms(t0)));
+        }
+    }
+}
@@ -0,0 +1,52 @@
+#ifndef SOME_COUNTING_ALLOCATOR_CLASS_HPP
+#define SOME_COUNTING_ALLOCATOR_CLASS_HPP
+
+#include <cstddef>
+#include <new>
+
+// Counts every allocation made through any instance of SomeCountingAllocatorClass, regardless of its value_type
+// The counters are function-local statics, so including this header in several translation units does not define them twice
+struct AllocationCounter {
+    static std::size_t& allocation_count() noexcept {
+        static std::size_t count = 0;
+        return count;
+    }
+
+    static std::size_t& deallocation_count() noexcept {
+        static std::size_t count = 0;
+        return count;
+    }
+};
+
+template <typename T>
+class SomeCountingAllocatorClass {
+public:
+    using value_type = T;
+
+    SomeCountingAllocatorClass() noexcept = default;
+
+    template <typename U>
+    SomeCountingAllocatorClass(const SomeCountingAllocatorClass<U>&) noexcept {}
+
+    T* allocate(std::size_t n) {
+        ++AllocationCounter::allocation_count();
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, std::size_t) noexcept {
+        ++AllocationCounter::deallocation_count();
+        ::operator delete(p);
+    }
+
+    template <typename U>
+    friend bool operator==(const SomeCountingAllocatorClass&, const SomeCountingAllocatorClass<U>&) noexcept {
+        return true;
+    }
+
+    template <typename U>
+    friend bool operator!=(const SomeCountingAllocatorClass&, const SomeCountingAllocatorClass<U>&) noexcept {
+        return false;
+    }
+};
+
+#endif // #ifndef SOME_COUNTING_ALLOCATOR_CLASS_HPP
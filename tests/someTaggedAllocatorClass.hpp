@@ -0,0 +1,48 @@
+#ifndef SOME_TAGGED_ALLOCATOR_CLASS_HPP
+#define SOME_TAGGED_ALLOCATOR_CLASS_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <map>
+#include <new>
+#include <type_traits>
+
+// stateful allocator, instances with different ids are unequal. Every allocation must be released by an instance with the same id
+template <typename T, bool Propagate>
+struct TaggedAllocator {
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::integral_constant<bool, Propagate>;
+    using propagate_on_container_move_assignment = std::integral_constant<bool, Propagate>;
+    using propagate_on_container_swap = std::integral_constant<bool, Propagate>;
+
+    template <typename U>
+    struct rebind { using other = TaggedAllocator<U, Propagate>; };
+
+    explicit TaggedAllocator(const int id) noexcept : mId{id} {}
+    template <typename U>
+    TaggedAllocator(const TaggedAllocator<U, Propagate>& other) noexcept : mId{other.mId} {}
+
+    // number of blocks allocated and not yet released by each id
+    static std::map<int, int>& live_blocks() {
+        static std::map<int, int> liveBlocks;
+        return liveBlocks;
+    }
+
+    T* allocate(const std::size_t n) {
+        ++live_blocks()[mId];
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, std::size_t) noexcept {
+        assert(live_blocks()[mId] > 0);
+        --live_blocks()[mId];
+        ::operator delete(p);
+    }
+
+    friend bool operator==(const TaggedAllocator& lhs, const TaggedAllocator& rhs) noexcept { return lhs.mId == rhs.mId; }
+    friend bool operator!=(const TaggedAllocator& lhs, const TaggedAllocator& rhs) noexcept { return lhs.mId != rhs.mId; }
+
+    int mId;
+};
+
+#endif // #ifndef SOME_TAGGED_ALLOCATOR_CLASS_HPP